@@ -59,22 +59,55 @@
 // (it is harmless to keep this on even if not used)
 #define WIRE_ENABLED            0       // 1 to enable, 0 to disable
 
+//-----------------------------------------------------------------------------
+// Fixed point measurement path, Teensy++ 2.0 with AD8307 only.  Sample 4x faster,
+// integer only per sample, floating point values for display and USB derived every 100ms
+#define FIXEDPOINT_ENABLED      1       // 1 to enable, 0 to disable
+#if defined(__MK20DX256__) || !AD8307_INSTALLED
+#undef  FIXEDPOINT_ENABLED
+#define FIXEDPOINT_ENABLED      0
+#endif
+
 //-----------------------------------------------------------------------------
 // Defaults for Teensy 3.1
 #if defined(__MK20DX256__)
 //If Teensy 3.1, then make use of the additional RAM and speed,
-                                        // Sample the AD inputs 500 times per second
-#define SAMPLE_TIME             2       // Time between samples, milliseconds
-#define PEP_BUFFER              2500    // PEP Buffer size, can hold up to 5 second PEP
-#define BUF_SHORT               50      // Buffer size for 100ms Peak
-#define AVG_BUF                 500     // Buffer size for 1s Average measurement
+                                        // Sample the AD inputs 1000 times per second
+#define SAMPLE_TIME             1       // Time between samples, milliseconds
+#define SAMPLE_TIMER            1000    // Interrupt timer, in microseconds (SAMPLE_TIME x 1000)
+#define PEP_BUFFER              5000    // PEP Buffer size, can hold up to 5 second PEP
+#define BUF_SHORT               100     // Buffer size for 100ms Peak
+#define AVG_BUF                 1000    // Buffer size for 1s Average measurement
+#define AD_RING_DEPTH           512     // Samples buffered between interrupt and main loop, power of two
 //-----------------------------------------------------------------------------
 // Defaults for Teensy++ 2.0 (and can probably also be coerced to work with Arduino Mega 2560)
+#elif FIXEDPOINT_ENABLED                // Sample the ADs 800 times per second
+#define SAMPLE_TIME             5       // Unit of the PEP period and LCD pacing, milliseconds
+#define SAMPLE_TIMER            1250    // Interrupt timer, in microseconds
+#define PEP_BUFFER              4000    // PEP Buffer size, can hold up to 5 second PEP
+#define BUF_SHORT               80      // Buffer size for 100ms Peak
+#define AVG_BLOCKS              10      // 100ms blocks in the 1s Average measurement
+#define AD_RING_DEPTH           128     // Samples buffered between interrupt and main loop, power of two
 #else                                   // Sample the ADs 200 times per second
 #define SAMPLE_TIME             5       // Time between samples, milliseconds
+#define SAMPLE_TIMER            5000    // Interrupt timer, in microseconds (SAMPLE_TIME x 1000)
 #define PEP_BUFFER              1000    // PEP Buffer size, can hold up to 5 second PEP
 #define BUF_SHORT               20      // Buffer size for 100ms Peak
 #define AVG_BUF                 200     // Buffer size for 1s Average measurement
+#define AD_RING_DEPTH           64      // Samples buffered between interrupt and main loop, power of two
+#endif
+
+//-----------------------------------------------------------------------------
+// LONG max hold window, fed with one max value per second
+#define LONG_BLOCKS             30      // LONG window in seconds, 30 seconds
+
+//-----------------------------------------------------------------------------
+// RAM budget for the measurement buffers: sample ring, sliding windows and
+// average buffers.  Checked at compile time, reported by the $ramstat USB command
+#if defined(__MK20DX256__)
+#define RAM_BUDGET              16384   // Bytes, out of 64 kB SRAM
+#else
+#define RAM_BUDGET              2048    // Bytes, out of 8 kB SRAM
 #endif
 
 //-----------------------------------------------------------------------------
@@ -108,6 +141,7 @@
 //-----------------------------------------------------------------------------
 // PEP envelope sample size for 1, 2.5 or 5 second sample time
 #define PEP_PERIOD 2500/SAMPLE_TIME    // 2.5 seconds = Default
+#define PEP_BLOCKS(period)  ((uint32_t) (period) * SAMPLE_TIME / 100) // 100ms blocks in a PEP period
 
 //-----------------------------------------------------------------------------
 // DEFS for SWR Alarm
@@ -198,7 +232,8 @@
 // None, or only one of the three below should be selected
 #define FAST_LOOP_THRU_LED        0    // Blink the builtin led on Microprocessor every time, when going through the mainloop *OR*
 #define	MS_LOOP_THRU_LED          1    // Blink the builtin led on Microprocessor when going through the mainloop *OR*
-#define SLOW_LOOP_THRU_LED        0    // Blink the builtin led on Microprocessor every 100ms, when going through the mainloop
+#define SLOW_LOOP_THRU_LED        0    // Blink the builtin led on Microprocessor every 100ms, when going through the mainloop *OR*
+#define INTR_LOOP_THRU_LED        0    // Blink the builtin led on Microprocessor every time going through the sample interrupt
 
 //-----------------------------------------------------------------------------
 // Definitions for Rotary Encoder and Pushbutton
@@ -270,6 +305,13 @@ const int Pref               =   A1;
 //-----------------------------------------------------------------------------
 // Structures and Unions
 
+// Sliding window and average buffer entries, dBm x 100 if AD8307, else milliwatts
+#if AD8307_INSTALLED
+typedef int16_t window_t;
+#else
+typedef int32_t window_t;
+#endif
+
 typedef struct {
           int16_t  db10m;                     // Calibrate, value in dBm x 10
           int16_t  Fwd;                       // corresponding A/D value for AD8307 Forward output
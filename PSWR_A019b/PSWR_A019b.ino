@@ -33,14 +33,23 @@
 #include <Metro.h>
 #include <EEPROM.h>
 #include <Encoder.h>
+#include <TimerOne.h>
 
 #include "_EEPROMAnything.h"
 #include "PSWR_A.h"
+#include "PSWR_A_Window.h"
+#include "PSWR_A_Lookup.h"
+#include "PSWR_A_FastMath.h"
+#include "PSWR_A_Ring.h"
 
 #if WIRE_ENABLED
 #include <Wire.h>                    // I2C Comms, if enabled
 #endif
 
+SpscRing<uint32_t, AD_RING_DEPTH> measure; // Ring buffer carrying the sampled adc-input pairs
+                                     // from the interrupt function to the main loop,
+                                     // Forward in lower and Reverse in upper 16 bits
+
 modeflags   mode;                    // Display and Menu Mode flags
 flags       flag;                    // Various op flags
 uint8_t     Menu_disp_timer;         // Used for a timed display when returning from Menu
@@ -53,12 +62,15 @@ uint8_t     Reverse;                 // BOOL: True if reverse power is greater t
 #if AD8307_INSTALLED
 double      ad8307_FdBm;             // Measured AD8307 forward voltage in dBm
 double      ad8307_RdBm;             // Measured AD8307 reverse current in dBm
+int16_t     ad8307_Fdb100;           // Measured AD8307 forward voltage in dBm x 100
+int16_t     ad8307_Rdb100;           // Measured AD8307 reverse current in dBm x 100
 double      fwd_power_mw;            // Calculated forward power in mW
 double      ref_power_mw;            // Calculated reflected power in mW
 double      power_mw;                // Calculated power in mW
 double      power_mw_pep;            // Calculated PEP power in mW
 double      power_mw_pk;             // Calculated 100ms peak power in mW
 double      power_mw_avg;            // Calculated AVG power in mW
+double      power_mw_long;           // Calculated LONG (30s) max power in mW
 #else
 int32_t     fwd_power_mw;            // Calculated forward power in mW
 int32_t     ref_power_mw;            // Calculated reflected power in mW
@@ -66,6 +78,7 @@ int32_t     power_mw;                // Calculated power in mW
 int32_t     power_mw_pep;            // Calculated PEP power in mW
 int32_t     power_mw_pk;             // Calculated 100ms peak power in mW
 int32_t     power_mw_avg;            // Calculated AVG power in mW
+int32_t     power_mw_long;           // Calculated LONG (30s) max power in mW
 #endif
 
 double      fwd_power_db;            // Calculated forward power in dBm
@@ -74,6 +87,7 @@ double      power_db;                // Calculated power in dBm
 double      power_db_pep;            // Calculated PEP power in dBm
 double      power_db_pk;             // Calculated 100ms peak power in dBm
 double      power_db_avg;            // Calculated AVG power in dBm
+double      power_db_long;           // Calculated LONG (30s) max power in dBm
 
 //double    modulation_index;        // Modulation index
 double      swr=1.0;                 // SWR as an absolute value
@@ -104,7 +118,7 @@ var_t  R  = {
               SWR_THRESHOLD,            // Default SWR Alarm power threshold defined in PSWR_A.h
               0,                        // USB Continuous reporting off
               1,                        // USB Reporting type, 1=Instantaneous Power (raw format) and SWR to USB 
-              PEP_PERIOD,               // PEP envelope sampling time in 5ms increments (200=1s, 500=2.5s, 1000=5s)
+              PEP_PERIOD,               // PEP envelope sampling time in SAMPLE_TIME increments (1s, 2.5s or 5s)
               {  
                 SCALE_RANGE1,           // User definable Scale Ranges, up to 3 ranges per decade
                 SCALE_RANGE2,           // e.g. ... 6W 12W 24W 60W 120W 240W ...
@@ -123,8 +137,7 @@ Encoder   Enc(EncI, EncQ);
 
 //-----------------------------------------------------------------------------------------
 // Timers for various tasks:
-Metro     pswrMetro = Metro(SAMPLE_TIME);   // AD Sample timer for Power and SWR measurements
-                                            // Also used to pace out characters to the LCD,
+Metro     lcdMetro = Metro(SAMPLE_TIME);    // Timer to pace out characters to the LCD,
                                             // three characters per millisecond.
 Metro     buttonMetro = Metro(5);           // 5ms timer to scan the pushbutton
 
@@ -134,6 +147,20 @@ Metro     slowMetro = Metro(100);           // 100 millisecond timer for various
 // initialize the LCD
 LiquidCrystalFast lcd(LCD_RS, LCD_RW, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
 
+//
+//-----------------------------------------------------------------------------------------
+// Forward & Reverse Voltage Measure and collect Function ( Interrupt driven )
+//-----------------------------------------------------------------------------------------
+//
+void powerSampler(void)
+{
+  #if INTR_LOOP_THRU_LED                    // Blink LED every time going through here 
+  digitalWrite(X_Led,X_LedState ^= 1);      // Blink a led
+  #endif
+
+  adc_poll_and_feed_circular();             // Read fwd and Rev AD, external or internal and feed ring buffer
+}
+
 //
 //-----------------------------------------------------------------------------------------
 // Top level task
@@ -154,25 +181,24 @@ void loop()
   digitalWrite(X_Led,X_LedState ^= 1);      // Blink a led
   #endif
 
+  //-------------------------------------------------------------------------------
+  // Process all samples collected by the interrupt function since last time
+  //-------------------------------------------------------------------------------
+  #if WIRE_ENABLED
+  if (ad7991_addr) ad7991_poll();           // AD7991 is read here, not in the interrupt function
+  #endif
+  pswr_sync_from_interrupt();
+
   //-------------------------------------------------------------------------------
   // Here we do routines which are to be accessed once every SAMPLE_TIME milliseconds
   //-------------------------------------------------------------------------------
-  // AD sample  Loop timer.
-  if (pswrMetro.check() == TRUE)            // check if the metro has passed its interval .
+  // LCD print Loop timer.
+  if (lcdMetro.check() == TRUE)             // check if the metro has passed its interval .
   {
     #if MS_LOOP_THRU_LED                    // Blink LED every time going through here 
     digitalWrite(X_Led,X_LedState ^= 1);    // Blink a led
     #endif
 
-    adc_poll();                             // Read AD, external or internal
-    #if AD8307_INSTALLED
-    pswr_determine_dBm();                   // Convert raw A/D values to dBm
-    pswr_calc_Power();                      // Calculate all kinds of Power
-    #else
-    measure_power_and_swr();                // Calculate power and swr, diode detector
-    calculate_pep_and_pk(power_mw);         // Calculate all kinds of power
-    #endif    
-    
     //-------------------------------------------------------------------
     // Print from virtual LCD to real LCD, approx one char per millisecond
     // (a typical HD44780 LCD is measured to use approx 15us per character)
@@ -241,6 +267,13 @@ void loop()
       flag.mode_display = TRUE;
     }
 
+    #if FIXEDPOINT_ENABLED
+    //-------------------------------------------------------------------
+    // Floating point Power and SWR values for display and USB
+    //
+    pswr_calc_Derived();
+    #endif
+
     //-------------------------------------------------------------------
     // Various Menu (rotary encoder) selectable display/function modes
     //
@@ -339,10 +372,18 @@ void setup()
   {
     EEPROM_readAnything(1,R);                    // Read the stored data
   }
+  // PEP period is stored in SAMPLE_TIME units, re-establish default if sample rate has changed
+  if ((R.PEP_period != 1000/SAMPLE_TIME) && (R.PEP_period != 2500/SAMPLE_TIME) && (R.PEP_period != 5000/SAMPLE_TIME))
+  {
+    R.PEP_period = PEP_PERIOD;
+    EEPROM_writeAnything(1,R);
+  }
 
   #if WIRE_ENABLED
   uint8_t i2c_status = I2C_Init();               // Initialize I2C comms
   #endif
+
+  pswr_window_init();                            // Init Peak and PEP sliding windows
   
   //------------------------------------------
   // LCD Print Version and I2C information (6 seconds in total during startup)
@@ -379,6 +420,9 @@ void setup()
   flag.mode_display = TRUE;
 
   virt_lcd_clear();                              // Prep for going live: LCD clear using the Virtual LCD code
-                                                 // for paced print, in order not to interfere with AD sample timing 
+                                                 // for paced print, in order not to hog the main loop
+
+  Timer1.initialize(SAMPLE_TIMER);               // Init the adc sample timer interrupt function
+  Timer1.attachInterrupt(powerSampler);          // Start the works
 }
 
@@ -0,0 +1,111 @@
+//*********************************************************************************
+//**
+//** Fast single precision exp10 and log10, for the conversions between dB and
+//** linear power which are done for every sample or every display update.
+//**
+//** The argument is split into its binary exponent and a mantissa, by way of the
+//** IEEE 754 bit pattern, and the mantissa is handled by a minimax polynomial:
+//**
+//**   fast_log2()       absolute error within 1.7e-5
+//**   fast_exp2()       relative error within 6e-6
+//**   fast_log10()      absolute error within 6e-6
+//**   fast_exp10()      relative error within 1.2e-5, |x| up to 37
+//**   fast_lin_to_db()  10 x log10(x), error within 6e-5 dB
+//**   fast_db_to_lin()  10^(x/10), error within 4e-5 dB, |x| up to 370 dB
+//**
+//** (measured against libm double precision over the full range)
+//**
+//** Zero, negative and denormal input to the log functions is treated as the
+//** smallest normal float, fast_log2() returns -126 rather than -inf or NaN.
+//** Results of the exp functions saturate at 2^-126 and 2^127.
+//**
+//** Header only, C or C++, no libm.
+//**
+//** Shared by all three firmwares.  This file, common/fastmath.h, is the source;
+//** PSWRfastmath.h, PSWR_A_FastMath.h and PM_FastMath.h are byte identical copies,
+//** as each sketch and project builds from its own folder.  Edit this one, then
+//** "cmake --build <dir> --target sync_common", the host tests check the copies.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.x, Teensy++ 2.0 and AT90usb1286 (all three firmwares)
+//**
+//*********************************************************************************
+
+#ifndef _fastmath_h_
+#define _fastmath_h_
+
+#include <stdint.h>
+
+typedef union {
+          float    f;
+          uint32_t i;
+               }  fast_float_t;
+
+//------------------------------------------------------------------------------
+// log2(x), x > 0.  The mantissa is folded into sqrt(0.5) to sqrt(2), for a
+// 5th order polynomial in (m - 1)
+static inline float fast_log2(float x)
+{
+  fast_float_t u;
+  int16_t e;
+  float   t;
+
+  u.f = x;
+  if (!(u.f >= 1.17549435e-38f)) return -126.0f;  // Zero, negative, denormal or NaN
+  e = (int16_t) ((u.i >> 23) & 0xff) - 127;
+  u.i = (u.i & 0x007fffff) | 0x3f800000;          // Mantissa, 1.0 to 2.0
+  if (u.f > 1.41421356f)
+  {
+    u.f *= 0.5f;
+    e++;
+  }
+  t = u.f - 1.0f;
+  return e + t * (1.44257800f + t * (-0.720241816f + t * (0.486686462f
+               + t * (-0.394575075f + t * 0.252658062f))));
+}
+
+//------------------------------------------------------------------------------
+// 2^x.  4th order polynomial for the fraction, the integer part is added
+// straight into the exponent bits
+static inline float fast_exp2(float x)
+{
+  fast_float_t u;
+  int16_t n;
+  float   f;
+
+  if (x <= -126.0f) x = -126.0f;
+  if (x >= 127.0f)  x = 127.0f;
+  n = (int16_t) x;
+  if ((float) n > x) n--;                         // floor(), also for negative x
+  f = x - n;
+  u.f = 1.00000259f + f * (0.693003836f + f * (0.241442748f
+             + f * (0.0520114749f + f * 0.0135341605f)));
+  u.i += (uint32_t) (int32_t) n << 23;
+  return u.f;
+}
+
+//------------------------------------------------------------------------------
+// log10(x) and 10^x
+static inline float fast_log10(float x)     { return fast_log2(x) * 0.301029996f; }
+static inline float fast_exp10(float x)     { return fast_exp2(x * 3.32192809f); }
+
+//------------------------------------------------------------------------------
+// Power ratio to and from dB:  10 x log10(x)  and  10^(x/10)
+static inline float fast_lin_to_db(float x) { return fast_log2(x) * 3.01029996f; }
+static inline float fast_db_to_lin(float x) { return fast_exp2(x * 0.332192809f); }
+
+#endif
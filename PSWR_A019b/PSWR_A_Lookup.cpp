@@ -0,0 +1,167 @@
+//*********************************************************************************
+//**
+//** Lookup helpers for the Power and SWR Meter measurement functions.
+//**
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy++ 2.0 or Teensy 3.1 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#include <avr/pgmspace.h>
+#include "PSWR_A_Lookup.h"
+#include "_RLtable.h"
+
+//
+//-----------------------------------------------------------------------------------------
+//      Constant tables: 10^(i/100) for 0.1 dB steps, 10^(i/1000) for 0.01 dB steps
+//      and 10^n for each 10 dB decade from DB100_MIN to DB100_MAX
+//-----------------------------------------------------------------------------------------
+//
+static const float exp10_coarse[100] PROGMEM = {
+  1.0000000, 1.0232930, 1.0471285, 1.0715193, 1.0964782,
+  1.1220185, 1.1481536, 1.1748976, 1.2022644, 1.2302688,
+  1.2589254, 1.2882496, 1.3182567, 1.3489629, 1.3803843,
+  1.4125375, 1.4454398, 1.4791084, 1.5135612, 1.5488166,
+  1.5848932, 1.6218101, 1.6595869, 1.6982437, 1.7378008,
+  1.7782794, 1.8197009, 1.8620871, 1.9054607, 1.9498446,
+  1.9952623, 2.0417379, 2.0892961, 2.1379621, 2.1877616,
+  2.2387211, 2.2908677, 2.3442288, 2.3988329, 2.4547089,
+  2.5118864, 2.5703958, 2.6302680, 2.6915348, 2.7542287,
+  2.8183829, 2.8840315, 2.9512092, 3.0199517, 3.0902954,
+  3.1622777, 3.2359366, 3.3113112, 3.3884416, 3.4673685,
+  3.5481339, 3.6307805, 3.7153523, 3.8018940, 3.8904514,
+  3.9810717, 4.0738028, 4.1686938, 4.2657952, 4.3651583,
+  4.4668359, 4.5708819, 4.6773514, 4.7863009, 4.8977882,
+  5.0118723, 5.1286138, 5.2480746, 5.3703180, 5.4954087,
+  5.6234133, 5.7543994, 5.8884366, 6.0255959, 6.1659500,
+  6.3095734, 6.4565423, 6.6069345, 6.7608298, 6.9183097,
+  7.0794578, 7.2443596, 7.4131024, 7.5857758, 7.7624712,
+  7.9432823, 8.1283052, 8.3176377, 8.5113804, 8.7096359,
+  8.9125094, 9.1201084, 9.3325430, 9.5499259, 9.7723722
+};
+
+static const float exp10_fine[10] PROGMEM = {
+  1.0000000, 1.0023052, 1.0046158, 1.0069317, 1.0092529,
+  1.0115795, 1.0139114, 1.0162487, 1.0185914, 1.0209395
+};
+
+static const float exp10_decade[(DB100_MAX - DB100_MIN + 1)/1000] PROGMEM = {
+  1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+  1e0,   1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9
+};
+
+//
+//-----------------------------------------------------------------------------------------
+//      Convert dBm x 100 into milliwatts:  mW = 10^(dBm/10)
+//-----------------------------------------------------------------------------------------
+//
+float db100_to_mw(int32_t db100)
+{
+  uint16_t i;
+
+  if (db100 < DB100_MIN) db100 = DB100_MIN;
+  if (db100 > DB100_MAX) db100 = DB100_MAX;
+  i = db100 - DB100_MIN;                        // 0 to 19999, 0.01 dB steps
+
+  return pgm_read_float(&exp10_decade[i/1000]) * pgm_read_float(&exp10_coarse[(i%1000)/10])
+         * pgm_read_float(&exp10_fine[i%10]);
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Integer versions of the above, for db100_to_lin()
+//-----------------------------------------------------------------------------------------
+//
+// 10^(i/100) x 4096 for 0.1 dB steps
+static const uint16_t exp10_coarse_q12[100] PROGMEM = {
+   4096,  4191,  4289,  4389,  4491,  4596,  4703,  4812,  4924,  5039,
+   5157,  5277,  5400,  5525,  5654,  5786,  5921,  6058,  6200,  6344,
+   6492,  6643,  6798,  6956,  7118,  7284,  7453,  7627,  7805,  7987,
+   8173,  8363,  8558,  8757,  8961,  9170,  9383,  9602,  9826, 10054,
+  10289, 10528, 10774, 11025, 11281, 11544, 11813, 12088, 12370, 12658,
+  12953, 13254, 13563, 13879, 14202, 14533, 14872, 15218, 15573, 15935,
+  16306, 16686, 17075, 17473, 17880, 18296, 18722, 19158, 19605, 20061,
+  20529, 21007, 21496, 21997, 22509, 23034, 23570, 24119, 24681, 25256,
+  25844, 26446, 27062, 27692, 28337, 28997, 29673, 30364, 31071, 31795,
+  32536, 33294, 34069, 34863, 35675, 36506, 37356, 38226, 39116, 40028
+};
+
+// 10^(i/1000) x 32768 for 0.01 dB steps
+static const uint16_t exp10_fine_q15[10] PROGMEM = {
+  32768, 32844, 32919, 32995, 33071, 33147, 33224, 33300, 33377, 33454
+};
+
+// 10^n x 2^(LIN_SHIFT-12) for each 10 dB decade, as a 32 bit multiplier
+// and a shift (right if positive, left if negative)
+static const uint32_t exp10_decade_mult[(DB100_MAX - DB100_MIN + 1)/1000] PROGMEM = {
+  3689348815, 2305843009, 2882303762, 3602879702, 2251799814,
+  2814749767, 3518437209, 2199023256, 2748779069, 3435973837,
+  2147483648, 2684354560, 3355443200, 4194304000, 2621440000,
+  3276800000, 4096000000, 2560000000, 3200000000, 4000000000
+};
+
+static const int8_t exp10_decade_shift[(DB100_MAX - DB100_MIN + 1)/1000] PROGMEM = {
+  53, 49, 46, 43, 39, 36, 33, 29, 26, 23,
+  19, 16, 13, 10,  6,  3,  0, -4, -7,-10
+};
+
+//
+//-----------------------------------------------------------------------------------------
+//      Convert dBm x 100 into units of 2^-24 mW, integer only
+//
+// Bounded by DB100_MIN and DB100_LIN_MAX, so that the sum of one second worth
+// of samples fits within 64 bits.  The table error is within 0.001 dB, the
+// rounding to whole units is within 0.05 dB down to -55 dBm.
+//-----------------------------------------------------------------------------------------
+//
+uint64_t db100_to_lin(int16_t db100)
+{
+  uint16_t i;
+  uint16_t m;                                   // Mantissa, 1.0 to 10.0 x 4096
+  uint64_t lin;
+  int8_t   s;
+
+  if (db100 < DB100_MIN) db100 = DB100_MIN;
+  if (db100 > DB100_LIN_MAX) db100 = DB100_LIN_MAX;
+  i = db100 - DB100_MIN;                        // 0 to 19000, 0.01 dB steps
+
+  m = ((uint32_t) pgm_read_word(&exp10_coarse_q12[(i%1000)/10])
+      * pgm_read_word(&exp10_fine_q15[i%10]) + 0x4000) >> 15;
+  lin = (uint64_t) m * pgm_read_dword(&exp10_decade_mult[i/1000]);
+  s = (int8_t) pgm_read_byte(&exp10_decade_shift[i/1000]);
+
+  if (s > 0) return (lin + ((uint64_t) 1 << (s-1))) >> s;
+  return lin << -s;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Look up SWR and Mismatch Loss from Return Loss (Forward dB less Reflected dB)
+//-----------------------------------------------------------------------------------------
+//
+rl_t rl_lookup(int32_t rl100)
+{
+  rl_t rl;
+
+  if (rl100 < 0)         rl100 = 0;
+  if (rl100 > RL100_MAX) rl100 = RL100_MAX;
+
+  rl.swr_log = pgm_read_word(&rl_table[rl100].swr_log);
+  rl.ml      = pgm_read_word(&rl_table[rl100].ml);
+  return rl;
+}
@@ -63,17 +63,18 @@ void adc_init(void)
 { 
   #if defined(__MK20DX256__)
   // If Teensy 3.1 MK20DX256 (ARM Cortex M4) based microcontroller, then set up the two separate ADCs
-  // for synchronous read at 12 bit resolution and lowest possible measurement speed (minimal noise) 
+  // for synchronous read at 12 bit resolution and low measurement speed (low noise).
+  // The ADCs are read from the sample timer interrupt function, 1000 times per second
   pinMode(Pfwd, INPUT);
   pinMode(Pref, INPUT);
-  adc->setSamplingSpeed(ADC_VERY_LOW_SPEED);     // Sampling speed, ADC_VERY_LOW_SPEED, ADC_LOW_SPEED, ADC_MED_SPEED, ADC_HIGH_SPEED or ADC_VERY_HIGH_SPEED
-  adc->setSamplingSpeed(ADC_VERY_LOW_SPEED, ADC_1);
-  adc->setConversionSpeed(ADC_VERY_LOW_SPEED);   // Conversion speed
-  adc->setConversionSpeed(ADC_VERY_LOW_SPEED, ADC_1);
+  adc->setSamplingSpeed(ADC_LOW_SPEED);          // Sampling speed, ADC_VERY_LOW_SPEED, ADC_LOW_SPEED, ADC_MED_SPEED, ADC_HIGH_SPEED or ADC_VERY_HIGH_SPEED
+  adc->setSamplingSpeed(ADC_LOW_SPEED, ADC_1);
+  adc->setConversionSpeed(ADC_LOW_SPEED);        // Conversion speed
+  adc->setConversionSpeed(ADC_LOW_SPEED, ADC_1);
   adc->setResolution(12);                        // AD resolution, 12 bits
   adc->setResolution(12, ADC_1);
-  adc->setAveraging(32);                         // Averaging of 32 samples at very low speed results in each measurement taking 580us
-  adc->setAveraging(32, ADC_1);
+  adc->setAveraging(16);                         // Averaging of 16 samples at low speed results in each measurement taking 80us
+  adc->setAveraging(16, ADC_1);                  // (32 samples at very low speed took 580us, too long for a 1ms interrupt)
 
   #else                                          // Atmel AVR based microcontroler, like AT90USB1286 or ATmega1280/2560 etc...
   analogReference(INTERNAL2V56);                 // Use internal 2.56V reference rather than 5V
@@ -130,14 +131,57 @@ uint8_t I2C_Init(void)
 //              use built-in 10 bit A/D converters if I2C device not present
 //-----------------------------------------------------------------------------------------
 //
-// This function reads the A/D inputs
-void adc_poll(void)
+// The sample timer interrupt function never waits for a conversion or for the I2C bus:
+//
+// - AD7991: the interrupt function only marks a sample as due, ad7991_poll() does the
+//   I2C read from the main loop, which then is the only writer to the ring buffer.
+// - Teensy 3.1: both builtin ADCs are read synchronously, 80us, within the interrupt.
+// - AVR: the interrupt function starts the FWD conversion, the ADC conversion complete
+//   interrupt then starts the REF conversion and feeds the ring buffer once both are in.
+//   Each conversion takes 104us at 125kHz ADC clock, the Timer1 interrupt is out in a few us.
+//
+#if WIRE_ENABLED
+volatile uint8_t ad7991_due;          // Sample timer ticks not yet polled from the AD7991
+uint32_t ad7991_missed;               // Ticks the main loop was late for, sample repeated
+#endif
+
+#if !defined(__MK20DX256__)           // Atmel AVR, ADC conversion complete interrupt
+#define ADC_REF        (_BV(REFS1) | _BV(REFS0))  // Internal 2.56V reference, as analogReference()
+#define ADC_CHANNEL(p) ((p) >= A0 ? (p) - A0 : (p))
+
+static volatile uint16_t adc_fwd;     // FWD conversion, held until the REF conversion is in
+
+static void adc_start(uint8_t pin)
 {
-  #if WIRE_ENABLED  
-  uint16_t adc_in[4];
-  uint8_t  read_B[4];
-  uint8_t  i=0;
+  ADMUX = ADC_REF | (ADC_CHANNEL(pin) & 0x07);
+  #if defined(MUX5)
+  if (ADC_CHANNEL(pin) & 0x08) ADCSRB |= _BV(MUX5);
+  else ADCSRB &= ~_BV(MUX5);
   #endif
+  ADCSRA |= _BV(ADSC) | _BV(ADIE);
+}
+
+ISR(ADC_vect)
+{
+  uint16_t v = ADC << 2;              // Convert from 10 to 12 bits
+
+  if (adc_fwd == 0xffff)              // FWD conversion just completed, go on with REF
+  {
+    adc_fwd = v;
+    adc_start(Pref);
+  }
+  else
+  {
+    ADCSRA &= ~_BV(ADIE);
+    measure.push(adc_fwd | ((uint32_t) v << 16));
+  }
+}
+#endif
+
+// This function is called from the sample timer interrupt function, it either takes
+// the sample or starts taking it, see above
+void adc_poll_and_feed_circular(void)
+{
   #if defined(__MK20DX256__)          // If Teensy 3.1 ARM Cortex M4 microcontroller
   ADC::Sync_result result;
   #endif
@@ -147,20 +191,7 @@ void adc_poll(void)
   // use I2C connected AD7991 12-bit AD converter, if it was detected during init
   if (ad7991_addr)
   {
-    Wire.requestFrom(ad7991_addr, 4);
-    while (Wire.available()) read_B[i++] = Wire.read();
-
-    // The output of the 12bit ADCs is contained in two consecutive byte pairs
-    // read from the AD7991.  In theory, the second could be read before the first.
-    // Each of the AD7991 four builtin ADCs has an address identifier (0 to 3)
-    // in the uppermost 4 bits of the first byte.  The lowermost 4 bits of the first
-    // byte are bits 8-12 of the A/D output.
-    // In this routine we only read the two first ADCs, as set up in the I2C_Init()
-    //
-    adc_in[(read_B[0] >> 4) & 0x03] = (read_B[0] & 0x0f) * 0x100 + read_B[1];
-    adc_in[(read_B[2] >> 4) & 0x03] = (read_B[2] & 0x0f) * 0x100 + read_B[3];
-    fwd = adc_in[0];           // Input from AD7991 is 12 bit resolution
-    ref = adc_in[1];           // contained in bit positions 0 to 11.
+    if (ad7991_due < 0xff) ad7991_due++; // Read by ad7991_poll() in the main loop
   }
   else
   #endif
@@ -172,41 +203,183 @@ void adc_poll(void)
     result = adc->analogSynchronizedRead(Pref, Pfwd);  // ref=ADC0, fwd=ADC1
     if( (result.result_adc0 !=ADC_ERROR_VALUE) && (result.result_adc1 !=ADC_ERROR_VALUE) )
     {
-      fwd = result.result_adc1 *3.25/2.56;      // Compensate for using 3.3V rather than
-      ref = result.result_adc0 *3.25/2.56;      //   2.56V as voltage reference.
+      // Compensate for using 3.3V rather than 2.56V as voltage reference,
+      // 3.25/2.56 is exactly 325/256
+      measure.push(((uint32_t) result.result_adc1 * 325 >> 8) | (((uint32_t) result.result_adc0 * 325 >> 8) << 16));
     }
     else  // error
     {
-      fwd = -1;                           // Should never happen
-      ref = -1;
+      measure.push(0xffffffff);           // Should never happen, -1 in both
     }
 
     //------------------------------------------
     #else // Atmel AVR 8 bit microcontroller
-    fwd = analogRead(Pfwd) << 2;   // Read FWD and Convert from 10 to 12 bits
-    ref = analogRead(Pref) << 2;   // Read REF and Convert from 10 to 12 bits
+    if (!(ADCSRA & _BV(ADIE)))            // Previous sample complete, should always be the case
+    {
+      adc_fwd = 0xffff;                   // FWD first, see ISR(ADC_vect)
+      adc_start(Pfwd);
+    }
     #endif
   }
 }
 
+#if WIRE_ENABLED
+//-----------------------------------------------------------------------------------------
+// Read the AD7991 from the main loop, once for every sample timer tick since last time.
+// If the main loop was late, the reading is repeated for the ticks it missed, in order
+// for the Peak, PEP and LONG windows to keep their time base.
+//-----------------------------------------------------------------------------------------
+//
+void ad7991_poll(void)
+{
+  uint16_t adc_in[4];
+  uint8_t  read_B[4];
+  uint8_t  i=0;
+  uint8_t  due;
+
+  noInterrupts();
+  due = ad7991_due;
+  ad7991_due = 0;
+  interrupts();
+  if (!due) return;
+
+  Wire.requestFrom(ad7991_addr, 4);
+  while (Wire.available()) read_B[i++] = Wire.read();
+
+  // The output of the 12bit ADCs is contained in two consecutive byte pairs
+  // read from the AD7991.  In theory, the second could be read before the first.
+  // Each of the AD7991 four builtin ADCs has an address identifier (0 to 3)
+  // in the uppermost 4 bits of the first byte.  The lowermost 4 bits of the first
+  // byte are bits 8-12 of the A/D output.
+  // In this routine we only read the two first ADCs, as set up in the I2C_Init()
+  //
+  adc_in[(read_B[0] >> 4) & 0x03] = (read_B[0] & 0x0f) * 0x100 + read_B[1];
+  adc_in[(read_B[2] >> 4) & 0x03] = (read_B[2] & 0x0f) * 0x100 + read_B[3];
+  // Input from AD7991 is 12 bit resolution contained in bit positions 0 to 11.
+  ad7991_missed += due - 1;
+  while (due--) measure.push(adc_in[0] | ((uint32_t) adc_in[1] << 16));
+}
+#endif
+
+//
+//-----------------------------------------------------------------------------------------
+// Process the ring buffer being fed by the Interrupt function
+//
+// New input is processed in blocks of contiguous entries, up to the end of the
+// ring and then from its start, if wrapped around.  Entries are handed back to
+// the Interrupt function once a block has been processed.
+//-----------------------------------------------------------------------------------------
+//
+void pswr_sync_from_interrupt(void)
+{
+  const uint32_t *ad;
+  uint16_t n;
+
+  while ((n = measure.block(&ad)) > 0)        // Read from ring buffer, while new input available
+  {
+    for (uint16_t x = 0; x < n; x++)
+    {
+      fwd = ad[x];                            // Transfer data from ring buffer
+      ref = ad[x] >> 16;
+      #if AD8307_INSTALLED
+      pswr_determine_dBm();                   // Convert raw A/D values to dBm
+      pswr_calc_Power();                      // Calculate all kinds of Power
+      #else
+      measure_power_and_swr();                // Calculate power, swr, pep and pk, diode detector
+      #endif
+    }
+    measure.release(n);                       // Hand the entries back to the Interrupt function
+  }
+}
+
+
+//
+//-----------------------------------------------------------------------------------------
+//                Sliding windows for Peak (100ms), PEP (1, 2.5 or 5s) and LONG (30s)
+//
+// The PEP window is fed with one Peak value per 100ms, hence it only needs to hold
+// PEP_BUFFER/BUF_SHORT entries, and its length is PEP_BLOCKS(R.PEP_period).  The LONG
+// window is fed with one max value per second, LONG_BLOCKS entries.  Window entries
+// are dBm x 100 in an int16_t if AD8307, else milliwatts in an int32_t.
+//-----------------------------------------------------------------------------------------
+//
+SlidingMax<window_t>::entry_t pk_store[BUF_SHORT];              // Peak information in a 100 ms window
+SlidingMax<window_t>::entry_t pep_store[PEP_BUFFER/BUF_SHORT];  // Peak information in a 1, 2.5 or 5 second window
+SlidingMax<window_t>::entry_t long_store[LONG_BLOCKS];          // Max of each second in a 30 second window
+SlidingMax<window_t> pk_window;
+SlidingMax<window_t> pep_window;
+SlidingMax<window_t> long_window;
+window_t             sec_max;                                   // Max within the current second
+
+#if !FIXEDPOINT_ENABLED
+window_t             avg_buf[AVG_BUF];                          // all instantaneous power measurements in 1s
+#endif
+
+void pswr_window_init(void)
+{
+  pk_window.init(pk_store, BUF_SHORT, BUF_SHORT);
+  pep_window.init(pep_store, PEP_BUFFER/BUF_SHORT, PEP_BLOCKS(R.PEP_period));
+  long_window.init(long_store, LONG_BLOCKS, LONG_BLOCKS);
+  sec_max = SlidingMax<window_t>::empty();
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//                Feed Peak, PEP and LONG windows with one value and retrieve the Peak
+//                (100ms), PEP and LONG values.  The PEP window follows R.PEP_period,
+//                whether it has been changed by Menu or USB, without any rescan.
+//-----------------------------------------------------------------------------------------
+//
+void pswr_window_add(window_t val, int32_t *pk, int32_t *pep, int32_t *lng)
+{
+  static uint8_t b=0;                           // 100ms block counter
+  static uint8_t s=0;                           // 1s block counter
+
+  *pk = pk_window.add(val);
+
+  if (pep_window.length() != PEP_BLOCKS(R.PEP_period))
+    pep_window.length(PEP_BLOCKS(R.PEP_period));
+
+  b++;
+  if (b >= BUF_SHORT)                           // Once every 100ms, feed PEP window with Peak value
+  {
+    b = 0;
+    pep_window.add(*pk);
+    if (*pk > sec_max) sec_max = *pk;
+    s++;
+    if (s >= 10)                                // Once every second, feed LONG window with max value
+    {
+      s = 0;
+      long_window.add(sec_max);
+      sec_max = SlidingMax<window_t>::empty();
+    }
+  }
+
+  *pep = pep_window.peak();
+  if (*pep < *pk) *pep = *pk;                   // Correct for slow reaction of the above
+  *lng = long_window.peak();
+  if (*lng < sec_max) *lng = sec_max;           // The current second is not in the window yet
+  if (*lng < *pep) *lng = *pep;
+}
 
 //
 //-----------------------------------------------------------------------------------------
 //                Calculate SWR if we have sufficient input power
+//                swr_log is 1000 x log10(SWR)
 //-----------------------------------------------------------------------------------------
 //
-void calculate_SWR(double v_fwd, double v_rev)
+void calculate_SWR(uint16_t swr_log)
 {
   // Only calculate SWR if meaningful power
 
   if ((power_mw > MIN_PWR_FOR_SWR_CALC) || (power_mw < -MIN_PWR_FOR_SWR_CALC))
   {
-    // Calculate SWR
-    swr = (1+(v_rev/v_fwd))/(1-(v_rev/v_fwd));
+    // SWR from its logarithmic value:  10^(swr_log/1000)
+    swr = db100_to_mw(swr_log);
 
     // prepare SWR bargraph value as a logarithmic integer value between 0 and 1000
-    if (swr < 10.0)
-      swr_bar = 1000.0 * log10(swr);
+    if (swr_log < 1000)
+      swr_bar = swr_log;
     else
       swr_bar = 1000;		// Show as maxed out above SWR 10:1
 
@@ -245,16 +418,31 @@ void calculate_SWR(double v_fwd, double v_rev)
 #if AD8307_INSTALLED
 //
 //-----------------------------------------------------------------------------------------
-//                Convert Voltage Reading into Power
+//                Lookup of dBm x 100 from the measured A/D values
+//
+// If Teensy 3.1, then one table for each AD8307, one entry for each A/D value.
+// If AVR, then there is not enough RAM for tables, instead the slope gradient is
+// precalculated as a fixed point integer with 12 fractional bits.
+//
+// Tables or slopes are rebuilt whenever the calibration values they were built from
+// change, whether by Calibrate Menu, USB $calset or a factory reset.
 //-----------------------------------------------------------------------------------------
 //
-void pswr_determine_dBm(void)
+#if defined(__MK20DX256__)
+#define AD_TABSIZE  5200                      // 12 bit A/D values, scaled by 3.25/2.56 if builtin ADC
+int16_t fwd_db_tab[AD_TABSIZE];               // Forward dBm x 100 for each A/D value
+int16_t rev_db_tab[AD_TABSIZE];               // Reverse dBm x 100 for each A/D value
+#else
+int32_t fwd_slope;                            // Forward dBm x 100 per A/D value, 12 fractional bits
+int32_t rev_slope;                            // Reverse dBm x 100 per A/D value, 12 fractional bits
+#endif
+cal_t   tab_cal[2];                           // Calibration values used for the tables
+
+void pswr_cal_tables_build(void)
 {
   double  delta_db;
-
   int16_t delta_F, delta_R;
   double  delta_Fdb, delta_Rdb;
-  double  temp;
 
   // Calculate the slope gradient between the two calibration points:
   //
@@ -262,104 +450,241 @@ void pswr_determine_dBm(void)
   //
   delta_db = (double)((R.cal_AD[1].db10m - R.cal_AD[0].db10m)/10.0);
   delta_F = R.cal_AD[1].Fwd - R.cal_AD[0].Fwd;
-  delta_Fdb = delta_db/delta_F;
+  delta_Fdb = delta_F ? delta_db/delta_F : 0;
   delta_R = R.cal_AD[1].Rev - R.cal_AD[0].Rev;
-  delta_Rdb = delta_db/delta_R;
-  //
+  delta_Rdb = delta_R ? delta_db/delta_R : 0;
+
+  #if defined(__MK20DX256__)
+  double  f_db, r_db;
+  for (uint16_t x = 0; x < AD_TABSIZE; x++)
+  {
+    // measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
+    f_db = (x - R.cal_AD[0].Fwd) * delta_Fdb + R.cal_AD[0].db10m/10.0;
+    r_db = (x - R.cal_AD[0].Rev) * delta_Rdb + R.cal_AD[0].db10m/10.0;
+    // Multiply by 100 and round to make suitable for integer value
+    fwd_db_tab[x] = constrain(lround(100 * f_db), DB100_MIN, DB100_MAX);
+    rev_db_tab[x] = constrain(lround(100 * r_db), DB100_MIN, DB100_MAX);
+  }
+  #else
+  // Bounded to keep (V - V_Cal1) * slope_gradient within 32 bits
+  fwd_slope = constrain(lround(409600.0 * delta_Fdb), -0x3ffff, 0x3ffff);
+  rev_slope = constrain(lround(409600.0 * delta_Rdb), -0x3ffff, 0x3ffff);
+  #endif
+  memcpy(tab_cal, R.cal_AD, sizeof(tab_cal));
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//                Convert Voltage Reading into Power
+//-----------------------------------------------------------------------------------------
+//
+void pswr_determine_dBm(void)
+{
+  int16_t temp;
+  #if !defined(__MK20DX256__)
+  int32_t f_db, r_db;
+  #endif
+
+  // Rebuild lookup tables if calibration has changed
+  if (memcmp(tab_cal, R.cal_AD, sizeof(tab_cal))) pswr_cal_tables_build();
+
+  #if defined(__MK20DX256__)
+  ad8307_Fdb100 = fwd_db_tab[constrain(fwd, 0, AD_TABSIZE-1)];
+  ad8307_Rdb100 = rev_db_tab[constrain(ref, 0, AD_TABSIZE-1)];
+  #else
   // measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
-  ad8307_FdBm = (fwd - R.cal_AD[0].Fwd) * delta_Fdb + R.cal_AD[0].db10m/10.0;
-  ad8307_RdBm = (ref - R.cal_AD[0].Rev) * delta_Rdb + R.cal_AD[0].db10m/10.0;
+  f_db = (((int32_t) (fwd - R.cal_AD[0].Fwd) * fwd_slope) >> 12) + R.cal_AD[0].db10m * 10;
+  r_db = (((int32_t) (ref - R.cal_AD[0].Rev) * rev_slope) >> 12) + R.cal_AD[0].db10m * 10;
+  ad8307_Fdb100 = constrain(f_db, DB100_MIN, DB100_MAX);
+  ad8307_Rdb100 = constrain(r_db, DB100_MIN, DB100_MAX);
+  #endif
 
   // Test for direction of power - Always designate the higher power as "forward"
   // while setting the "Reverse" flag on reverse condition.
-  if (ad8307_FdBm > ad8307_RdBm)        // Forward direction
+  if (ad8307_Fdb100 > ad8307_Rdb100)    // Forward direction
   {
     Reverse = FALSE;
   }
   else                                  // Reverse direction
   {
-    temp = ad8307_RdBm;
-    ad8307_RdBm = ad8307_FdBm;
-    ad8307_FdBm = temp;
+    temp = ad8307_Rdb100;
+    ad8307_Rdb100 = ad8307_Fdb100;
+    ad8307_Fdb100 = temp;
     Reverse = TRUE;
   }
+  #if !FIXEDPOINT_ENABLED                       // Otherwise done by pswr_calc_Derived()
+  ad8307_FdBm = ad8307_Fdb100 / 100.0;
+  ad8307_RdBm = ad8307_Rdb100 / 100.0;
+  #endif
 }
 
 
+#if FIXEDPOINT_ENABLED
 //
 //-----------------------------------------------------------------------------------------
-//                Calculate all kinds of power
+//                Fixed point measurement path
+//
+// Everything done per sample is integer only, in dBm x 100.  Peak and PEP from the
+// sliding windows, the 1s Average from the power sums of each 100ms block, in units
+// of 2^-24 mW.  The sums are exact, hence do not drift like a floating point running
+// sum.  The floating point values for display and USB are derived from these once
+// every 100ms, by pswr_calc_Derived()
+//-----------------------------------------------------------------------------------------
+//
+uint64_t  avg_blk[AVG_BLOCKS];                  // Power sum of each 100ms block
+uint64_t  avg_sum;                              // Power sum of all blocks in the 1s window
+uint64_t  blk_sum;                              // Power sum within the current 100ms block
+int32_t   p_db100 = DB100_MIN;                  // Latest Real Power Output in dB x 100
+int32_t   pk_db100 = DB100_MIN;                 // Latest Peak (100ms) in dB x 100
+int32_t   pep_db100 = DB100_MIN;                // Latest PEP in dB x 100
+int32_t   long_db100 = DB100_MIN;               // Latest LONG (30s) in dB x 100
+uint16_t  p_swr_log;                            // Latest 1000 x log10(SWR)
+
+//
+//-----------------------------------------------------------------------------------------
+//                Calculate all kinds of power, integer only, once every sample
 //-----------------------------------------------------------------------------------------
 //
 void pswr_calc_Power(void)
 {
-  double f_inst;                                // Calculated Forward voltage
-  double r_inst;                                // Calculated Reverse voltage
-
-  // For measurement of peak and average power
-  static int16_t db_buff[PEP_BUFFER];           // dB voltage information in a one second window
-  static int16_t db_buff_short[BUF_SHORT];      // dB voltage information in a 100 ms window
-  static double	p_avg_buf[AVG_BUF];             // all instantaneous power measurements in 1s
-  static double	p_plus;                         // all power measurements within a 1s window added together
-  static uint16_t a=0;                          // PEP ring buffer counter
-  static uint8_t b=0;                           // 100ms ring buffer counter
+  rl_t   rl;                                    // SWR and Mismatch Loss
+  static uint8_t b=0;                           // Samples within the current 100ms block
   static uint8_t c=0;                           // 1s average ring buffer counter
-  int16_t max=-32767, pk=-32767;                // Keep track of Max (1s) and Peak (100ms) dB voltage
 
-  // Instantaneous forward voltage and power, milliwatts and dBm
-  f_inst = pow(10,ad8307_FdBm/20.0);		// (We use voltage later on, for SWR calc)
-  fwd_power_mw = SQR(f_inst);			// P_mw = (V*V) (current and resistance have already been factored in
-  fwd_power_db = 10 * log10(fwd_power_mw);
+  // SWR and Mismatch Loss, both from the Return Loss
+  rl = rl_lookup(ad8307_Fdb100 - ad8307_Rdb100);
+  p_swr_log = rl.swr_log;
 
-  // Instantaneous reverse voltage and power
-  r_inst = pow(10,(ad8307_RdBm)/20.0);
-  ref_power_mw = SQR(r_inst);
-  ref_power_db = 10 * log10(ref_power_mw);
+  // Instantaneous Real Power Output, which is the forward power less the Mismatch Loss
+  p_db100 = max((int32_t) ad8307_Fdb100 - rl.ml, DB100_MIN);
 
-  // Instantaneous Real Power Output
-  power_mw = fwd_power_mw - ref_power_mw;
-  power_db = 10 * log10(power_mw);
+  // Feed dB value x 100 to the Peak (100ms), PEP (1, 2.5 or 5s) and LONG (30s) sliding windows
+  pswr_window_add(p_db100, &pk_db100, &pep_db100, &long_db100);
 
-  // Find peaks and averages
-  // Multiply by 100 to make suitable for integer value
-  // Store dB value in two ring buffers
-  db_buff[a] = db_buff_short[b] = 100 * power_db;
-  // Advance PEP (1, 2.5 or 5s) and 100ms ringbuffer counters
-  a++, b++;
-  if (a >= R.PEP_period) a = 0;
-  if (b == BUF_SHORT) b = 0;
-
-  // Retrieve Max Value within a 1 second sliding window
-  for (uint16_t x = 0; x < R.PEP_period; x++)
+  // Power sum within the current 100ms block, once every 100ms advance the Average window
+  blk_sum += db100_to_lin(p_db100);
+  b++;
+  if (b >= BUF_SHORT)
   {
-    if (max < db_buff[x]) max = db_buff[x];
+    b = 0;
+    avg_sum = avg_sum - avg_blk[c] + blk_sum;   // Exact, the same integer is subtracted
+    avg_blk[c] = blk_sum;                       // when the block leaves the window
+    blk_sum = 0;
+    c++;
+    if (c == AVG_BLOCKS) c = 0;
   }
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//                Floating point Power and SWR values for display and USB,
+//                once every 100ms
+//-----------------------------------------------------------------------------------------
+//
+void pswr_calc_Derived(void)
+{
+  ad8307_FdBm = ad8307_Fdb100 / 100.0;
+  ad8307_RdBm = ad8307_Rdb100 / 100.0;
+
+  // Instantaneous forward and reverse power, milliwatts and dBm
+  fwd_power_mw = db100_to_mw(ad8307_Fdb100);
+  fwd_power_db = ad8307_FdBm;
+  ref_power_mw = db100_to_mw(ad8307_Rdb100);
+  ref_power_db = ad8307_RdBm;
 
-  // Find Peak value within a 100ms sliding window
-  for (uint8_t x = 0; x < BUF_SHORT; x++)
+  // Instantaneous Real Power Output
+  power_mw = db100_to_mw(p_db100);
+  power_db = p_db100 / 100.0;
+
+  // PEP
+  power_db_pep = pep_db100 / 100.0;
+  power_mw_pep = db100_to_mw(pep_db100);
+
+  // Peak (100 milliseconds)
+  power_db_pk = pk_db100 / 100.0;
+  power_mw_pk = db100_to_mw(pk_db100);
+
+  // LONG (30 seconds)
+  power_db_long = long_db100 / 100.0;
+  power_mw_long = db100_to_mw(long_db100);
+
+  // Average power (1 second), milliwatts and dBm
+  if (avg_sum)
   {
-    if (pk < db_buff_short[x]) pk = db_buff_short[x];
+    power_mw_avg = avg_sum * (1.0 / ((double) AVG_BLOCKS * BUF_SHORT * (1UL << LIN_SHIFT)));
+    power_db_avg = fast_lin_to_db(power_mw_avg);
   }
+  else                                          // Below the resolution of the sums
+  {
+    power_mw_avg = db100_to_mw(DB100_MIN);
+    power_db_avg = DB100_MIN / 100.0;
+  }
+
+  calculate_SWR(p_swr_log);
+}
+
+#else
+//
+//-----------------------------------------------------------------------------------------
+//                Calculate all kinds of power
+//-----------------------------------------------------------------------------------------
+//
+void pswr_calc_Power(void)
+{
+  rl_t   rl;                                    // SWR and Mismatch Loss
+  int32_t p_db;                                 // Real Power Output in dB x 100
+
+  // For measurement of average power
+  static uint64_t p_plus;                       // all power measurements within a 1s window added together
+  static uint16_t c=0;                          // 1s average ring buffer counter
+  int32_t pep, pk, lng;                         // Keep track of LONG (30s), PEP and Peak (100ms) dB voltage
+
+  // Instantaneous forward and reverse power, milliwatts and dBm
+  // (current and resistance have already been factored in)
+  fwd_power_mw = db100_to_mw(ad8307_Fdb100);
+  fwd_power_db = ad8307_FdBm;
+  ref_power_mw = db100_to_mw(ad8307_Rdb100);
+  ref_power_db = ad8307_RdBm;
+
+  // SWR and Mismatch Loss, both from the Return Loss
+  rl = rl_lookup(ad8307_Fdb100 - ad8307_Rdb100);
+
+  // Instantaneous Real Power Output, which is the forward power less the Mismatch Loss
+  // (bounded, to fit the int16_t window and average buffer entries)
+  p_db = max((int32_t) ad8307_Fdb100 - rl.ml, (int32_t) DB100_MIN);
+  power_mw = db100_to_mw(p_db);
+  power_db = p_db / 100.0;
+
+  // Find peaks and averages
+  // Feed dB value x 100 to the Peak (100ms), PEP (1, 2.5 or 5s) and LONG (30s) sliding windows
+  pswr_window_add(p_db, &pk, &pep, &lng);
 
   // PEP
-  power_db_pep = max / 100.0;
-  power_mw_pep = pow(10,power_db_pep/10.0);
+  power_db_pep = pep / 100.0;
+  power_mw_pep = db100_to_mw(pep);
 
   // Peak (100 milliseconds)
   power_db_pk = pk / 100.0;
-  power_mw_pk = pow(10,power_db_pk/10.0);
+  power_mw_pk = db100_to_mw(pk);
+
+  // LONG (30 seconds)
+  power_db_long = lng / 100.0;
+  power_mw_long = db100_to_mw(lng);
 
   // Average power (1 second), milliwatts and dBm
-  p_avg_buf[c] = power_mw;                      // Add the newest value onto ring buffer
-  p_plus = p_plus + power_mw;                   // Add latest value to the total sum of all measurements in 1s
+  // The ring buffer holds dBm x 100, the running sum is in integer units of 2^-24 mW
+  // (see db100_to_lin()), hence exact, no drift however long the meter runs
+  p_db = min(p_db, (int32_t) DB100_LIN_MAX);
+  avg_buf[c] = p_db;                            // Add the newest value onto ring buffer
+  p_plus = p_plus + db100_to_lin(p_db);         // Add latest value to the total sum of all measurements in 1s
   if (c < AVG_BUF-1)                            // and subtract the oldest value in the ring buffer from the total sum
-    p_plus = p_plus - p_avg_buf[c+1];
+    p_plus = p_plus - db100_to_lin(avg_buf[c+1]);
   else
-    p_plus = p_plus - p_avg_buf[0];
+    p_plus = p_plus - db100_to_lin(avg_buf[0]);
   c++;                                          // Rotate window by advancing ring buffer counter
   if (c == AVG_BUF) c = 0;
-  power_mw_avg = p_plus / (AVG_BUF);            // And finally, find the average
-  power_db_avg = 10 * log10(power_mw_avg);
+  power_mw_avg = p_plus * (1.0 / ((double) AVG_BUF * (1UL << LIN_SHIFT))); // And finally, find the average
+  power_db_avg = fast_lin_to_db(power_mw_avg);
 
 
   //// Modulation index in a 1s window
@@ -368,8 +693,9 @@ void pswr_calc_Power(void)
   //v2 = sqrt(ABS(power_mw_avg));
   //modulation_index = (v1-v2) / v2;
 
-  calculate_SWR(f_inst, r_inst);
+  calculate_SWR(rl.swr_log);
 }
+#endif
 
 
 //-----------------------------------------------------------------------------
@@ -382,60 +708,40 @@ void pswr_calc_Power(void)
 //
 void calculate_pep_and_pk(int32_t p)
 {
-  // For measurement of peak (100ms pep) and pep (1s pep) power
-  static int32_t buff[PEP_BUFFER];              // voltage information in a one second window
-  static int32_t buff_short[BUF_SHORT];         // voltage information in a 100 ms window
-  static int32_t buff_avg[AVG_BUF];             // all instantaneous power measurements in 1s
+  // For measurement of average power
   static int64_t p_plus;                        // all power measurements within a 1s window added together
 
-  static uint16_t a=0;                          // PEP ring buffer counter
-  static uint8_t b=0;                           // 100ms ring buffer counter
-  static uint8_t c=0;                           // 1s average ring buffer counter
-  int32_t mx=0, pk=0;                           // Keep track of Max (1s) and Peak (100ms) voltage
+  static uint16_t c=0;                          // 1s average ring buffer counter
+  int32_t mx, pk, lng;                          // Keep track of LONG (30s), PEP and Peak (100ms) voltage
 
   // Find peaks and averages
-  // Store power level (mw) in two ring buffers
-  buff[a] = buff_short[b] = p;
-  // Advance PEP [1] and Peak [100ms] ringbuffer counters
-  a++, b++;
-  if (a >= R.PEP_period) a = 0;
-  if (b >= BUF_SHORT) b = 0;
-
-  // Retrieve Max Value within a [1, 2.5 or 5] second sliding window
-  for (uint16_t x = 0; x < R.PEP_period; x++)
-  {
-    if (mx < buff[x]) mx = buff[x];
-  }
-
-  // Find Peak value within a [100ms] sliding window
-  for (uint8_t x = 0; x < BUF_SHORT; x++)
-  {
-    if (pk < buff_short[x]) pk = buff_short[x];
-  }
+  // Feed power level (mw) to the Peak [100ms], PEP [1, 2.5 or 5s] and LONG [30s] sliding windows
+  pswr_window_add(p, &pk, &mx, &lng);
 
   // Average power (1 second), milliwatts and dBm
-  buff_avg[c] = power_mw;                       // Add the newest value onto ring buffer
+  avg_buf[c] = power_mw;                        // Add the newest value onto ring buffer
   p_plus = p_plus + power_mw;                   // Add latest value to the total sum of all measurements in 1s
   if (c < AVG_BUF-1)                            // and subtract the oldest value in the ring buffer from the total sum
-    p_plus = p_plus - buff_avg[c+1];
+    p_plus = p_plus - avg_buf[c+1];
   else
-    p_plus = p_plus - buff_avg[0];
+    p_plus = p_plus - avg_buf[0];
   c++;                                          // Rotate window by advancing ring buffer counter
   if (c == AVG_BUF) c = 0;
 
   power_mw_pep = mx;                            // PEP  (largest value measured in a sliding window of 1, 2.5 or 5 sec)
-  power_db_pep = 10 * log10(power_db_pep);
+  power_db_pep = fast_lin_to_db(power_mw_pep);
   power_mw_pk = pk;                             // Peak (typically 100 milliseconds)
-  power_db_pk = 10 * log10(power_db_pk);
+  power_db_pk = fast_lin_to_db(power_mw_pk);
+  power_mw_long = lng;                          // LONG (max value in a sliding window of 30 sec)
+  power_db_long = fast_lin_to_db(power_mw_long);
   power_mw_avg = p_plus / (AVG_BUF);            // And finally, find the average
-  power_db_avg = 10 * log10(power_mw_avg);
+  power_db_avg = fast_lin_to_db(power_mw_avg);
 }
 
 //
 //---------------------------------------------------------------------------------
 // Measure Forward and Reflected power and process
-// Polled once every 5ms normally.  However, when stepper is in use,
-// then polled once for each step progressed
+// Called once for each sample collected by the sample timer interrupt function
 //---------------------------------------------------------------------------------
 //
 
@@ -444,6 +750,7 @@ void measure_power_and_swr(void)
   double v_fwd;                                 // Calculated Forward voltage
   double v_ref;                                 // Calculated Reflected voltage
   uint16_t temp;
+  rl_t   rl;                                    // SWR from Return Loss
 
   // Test for direction of power - Always designate the higher power as "forward"
   // while setting the "Reverse" flag on reverse condition.
@@ -487,6 +794,70 @@ void measure_power_and_swr(void)
 
   calculate_pep_and_pk(power_mw);    // rate, hence this would make limited sense
   
-  calculate_SWR(v_fwd, v_ref);         // Calculate measured_swr based on forward and reflected voltages
+  // Calculate measured_swr based on forward and reflected voltages,
+  // by way of the Return Loss:  20 * log10(v_fwd/v_ref)
+  if (v_ref > 0) rl = rl_lookup(2000 * fast_log10(v_fwd/v_ref));
+  else           rl = rl_lookup(RL100_MAX);
+  calculate_SWR(rl.swr_log);
 }
 #endif
+
+
+//
+//-----------------------------------------------------------------------------------------
+//                RAM budget of the measurement buffers
+//
+// The sizes are known at compile time, and the build fails if the buffers for the
+// selected platform and sample rate do not fit within RAM_BUDGET
+//-----------------------------------------------------------------------------------------
+//
+#if FIXEDPOINT_ENABLED
+#define RAM_AVG_BUFS  (sizeof(avg_blk))
+#else
+#define RAM_AVG_BUFS  (sizeof(avg_buf))
+#endif
+#define RAM_WINDOWS   (sizeof(pk_store) + sizeof(pep_store) + sizeof(long_store))
+#define RAM_MEASURE   (sizeof(measure) + RAM_WINDOWS + RAM_AVG_BUFS)
+
+static_assert(RAM_MEASURE <= RAM_BUDGET, "Measurement buffers exceed RAM_BUDGET, see PSWR_A.h");
+
+//
+//-----------------------------------------------------------------------------------------
+//                Free RAM between heap and stack, AVR only
+//-----------------------------------------------------------------------------------------
+//
+int16_t pswr_ram_free(void)
+{
+  #if defined(__MK20DX256__)
+  return -1;                                    // Not tracked on Teensy 3.1
+  #else
+  extern char __heap_start, *__brkval;
+  char top;
+  return &top - (__brkval ? __brkval : &__heap_start);
+  #endif
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//                Report the RAM budget to USB, $ramstat
+//-----------------------------------------------------------------------------------------
+//
+void pswr_ram_report(void)
+{
+  Serial.print(F("RAM: ring "));
+  Serial.print(sizeof(measure));
+  Serial.print(F(", peak "));
+  Serial.print(sizeof(pk_store));
+  Serial.print(F(", pep "));
+  Serial.print(sizeof(pep_store));
+  Serial.print(F(", long "));
+  Serial.print(sizeof(long_store));
+  Serial.print(F(", avg "));
+  Serial.println(RAM_AVG_BUFS);
+  Serial.print(F("RAM: total "));
+  Serial.print(RAM_MEASURE);
+  Serial.print(F(" of budget "));
+  Serial.print(RAM_BUDGET);
+  Serial.print(F(", free "));
+  Serial.println(pswr_ram_free());
+}
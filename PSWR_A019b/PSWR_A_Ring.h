@@ -0,0 +1,131 @@
+//*********************************************************************************
+//**
+//** Single producer / single consumer ring buffer, carrying the sampled adc-input
+//** pairs from the timer interrupt function to the main loop.
+//**
+//** The producer (interrupt function) only ever writes head, and the consumer
+//** (main loop) only ever writes tail.  Indexes are free running and only a single
+//** byte wide on AVR, hence always read and written in one access.  Each side
+//** updates its index only after it is done with the entries, so the main loop
+//** never has to disable interrupts to read the ring.  A full ring drops the
+//** newest sample rather than overwriting unread ones, and the drop is counted.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy++ 2.0 or Teensy 3.1 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWR_A_Ring_h_
+#define _PSWR_A_Ring_h_
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+typedef uint8_t  ring_idx_t;            // Ring depth can be up to 128 entries
+#else
+typedef uint16_t ring_idx_t;            // Ring depth can be up to 32768 entries
+#endif
+
+// Single core, a compiler barrier is all that is needed to keep entry accesses
+// on the right side of an index update
+#define RING_BARRIER()  __asm__ __volatile__ ("" ::: "memory")
+
+template <typename T, uint16_t DEPTH>
+class SpscRing
+{
+  static_assert(DEPTH >= 2 && (DEPTH & (DEPTH - 1)) == 0, "SpscRing depth has to be a power of two");
+  static_assert(DEPTH <= (ring_idx_t) ~0 / 2 + 1, "SpscRing depth too large for index type");
+
+  public:
+    //------------------------------------------------------------------------------
+    // Producer side, only to be called from one context, the interrupt function,
+    // or the main loop if it is the one taking the samples (see ad7991_poll()).
+    // Returns false, and counts a drop, if the ring is full.
+    bool push(T value)
+    {
+      ring_idx_t h = head;
+      ring_idx_t used = h - tail;
+      if (used >= DEPTH)
+      {
+        drops++;
+        return false;
+      }
+      buf[h & (DEPTH - 1)] = value;
+      RING_BARRIER();                   // Entry written before it is published
+      head = h + 1;
+      if ((ring_idx_t)(used + 1) > hiwater) hiwater = used + 1;
+      return true;
+    }
+    //------------------------------------------------------------------------------
+    // Consumer side, only to be called from the main loop.
+    // Number of entries waiting, also updates the max lag seen by the consumer
+    uint16_t available(void)
+    {
+      ring_idx_t used = head - tail;
+      if (used > maxlag) maxlag = used;
+      return used;
+    }
+    // Pointer to the oldest entry waiting, and the number of entries which can be
+    // read from there in one contiguous block, up to the end of the ring
+    uint16_t block(const T **p)
+    {
+      uint16_t used = available();
+      uint16_t pos  = tail & (DEPTH - 1);
+      RING_BARRIER();                   // Index read before the entries are
+      *p = &buf[pos];
+      if (used > DEPTH - pos) used = DEPTH - pos;
+      return used;
+    }
+    // Hand n consumed entries back to the producer
+    void release(uint16_t n)
+    {
+      RING_BARRIER();                   // Entries read before they are handed back
+      tail = tail + n;
+    }
+    //------------------------------------------------------------------------------
+    // Statistics
+    uint16_t depth(void)    { return DEPTH; }
+    uint16_t highwater(void){ return hiwater; }
+    uint16_t lag(void)      { return (ring_idx_t)(head - tail); }
+    uint16_t lagmax(void)   { return maxlag; }
+    uint32_t dropped(void)
+    {
+      uint32_t d;
+      noInterrupts();                   // More than one byte wide on AVR
+      d = drops;
+      interrupts();
+      return d;
+    }
+    void     clear_stats(void)
+    {
+      noInterrupts();
+      drops = 0;
+      hiwater = 0;
+      interrupts();
+      maxlag = 0;
+    }
+
+  private:
+    T                   buf[DEPTH];     // Ring storage
+    volatile ring_idx_t head;           // Free running count of entries written, producer owned
+    volatile ring_idx_t tail;           // Free running count of entries read, consumer owned
+    volatile uint32_t   drops;          // Samples dropped because the ring was full
+    volatile ring_idx_t hiwater;        // Highest fill level seen by the producer
+    ring_idx_t          maxlag;         // Highest fill level seen by the consumer
+};
+
+#endif
@@ -167,8 +167,8 @@ void usb_poll_avgdb(void)
 void usb_poll_long(void)
 {
   //------------------------------------------
-  // Power indication, inst, peak (100ms), pep (1s), average (1s)
-  Serial.println(F("Power (inst, peak 100ms, pep 1s, avg 1s):"));
+  // Power indication, inst, peak (100ms), pep (1s), average (1s), long (30s)
+  Serial.println(F("Power (inst, peak 100ms, pep 1s, avg 1s, long 30s):"));
   if (Reverse) Serial.print(F("-"));
   print_p_mw(power_mw);
   Serial.print(lcd_buf);
@@ -183,6 +183,10 @@ void usb_poll_long(void)
   Serial.print(F(", "));
   if (Reverse) Serial.print(F("-"));
   print_p_mw(power_mw_avg);
+  Serial.print(lcd_buf);
+  Serial.print(F(", "));
+  if (Reverse) Serial.print(F("-"));
+  print_p_mw(power_mw_long);
   Serial.println(lcd_buf);
 	
   //------------------------------------------
@@ -290,6 +294,11 @@ void usb_cont_report(void)
 //                            ... 2W, 20W, 200W ...
 //                            The third and largest value has to be less than ten times the first value
 //
+//        $ringstat           Retrieve sample ring statistics: depth, dropped samples, high water,
+//                            lag and max lag, also missed AD7991 samples if I2C enabled
+//        $ringreset          Reset sample ring statistics
+//        $ramstat            Retrieve RAM used by the measurement buffers, budget and free RAM
+//
 //        $version            Report version and date of firmware
 //
 //-----------------------------------------------------------------------------------------
@@ -609,8 +618,8 @@ void usb_parse_incoming(void)
   {
     // Write value if valid
     inp_double = strtod(incoming_command_string+12,&pEnd);
-    inp_val = inp_double*200;
-    if ((inp_val==200)||(inp_val==500)||(inp_val==1000))
+    inp_val = inp_double*(1000/SAMPLE_TIME);
+    if ((inp_val==1000/SAMPLE_TIME)||(inp_val==2500/SAMPLE_TIME)||(inp_val==5000/SAMPLE_TIME))
     {
       EEPROM_readAnything(1,R);
       R.PEP_period = inp_val;
@@ -620,7 +629,42 @@ void usb_parse_incoming(void)
   else if (!strcmp("pepperiodget",incoming_command_string))
   {
     Serial.print(F("PEP_period (seconds): "));
-    Serial.println(R.PEP_period/200.0,1);
+    Serial.println(R.PEP_period*SAMPLE_TIME/1000.0,1);
+  }
+
+  //    $ringstat          Retrieve sample ring statistics
+  //    $ringreset         Reset sample ring statistics
+  else if (!strcmp("ringstat",incoming_command_string))
+  {
+    Serial.print(F("AD ring: depth "));
+    Serial.print(measure.depth());
+    Serial.print(F(", dropped "));
+    Serial.print(measure.dropped());
+    Serial.print(F(", high water "));
+    Serial.print(measure.highwater());
+    Serial.print(F(", lag "));
+    Serial.print(measure.lag());
+    Serial.print(F(", max lag "));
+    #if WIRE_ENABLED
+    Serial.print(measure.lagmax());
+    Serial.print(F(", AD7991 missed "));
+    Serial.println(ad7991_missed);
+    #else
+    Serial.println(measure.lagmax());
+    #endif
+  }
+  else if (!strcmp("ringreset",incoming_command_string))
+  {
+    measure.clear_stats();
+    #if WIRE_ENABLED
+    ad7991_missed = 0;
+    #endif
+  }
+
+  //    $ramstat           Retrieve RAM used by the measurement buffers
+  else if (!strcmp("ramstat",incoming_command_string))
+  {
+    pswr_ram_report();
   }
 }	
 	
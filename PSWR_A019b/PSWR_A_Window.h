@@ -0,0 +1,125 @@
+//*********************************************************************************
+//**
+//** Sliding window helpers for the Power and SWR Meter measurement functions.
+//** Sliding Max uses a monotonic queue (ascending minima style), giving the
+//** maximum value within a window of the most recent samples in amortized
+//** O(1) per sample, regardless of the window length.
+//**
+//** The value type is a template parameter, int16_t for dBm x 100 keeps each
+//** entry at 4 bytes, which matters within the 8 KB SRAM of the Teensy++ 2.0
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy++ 2.0 or Teensy 3.1 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWR_A_Window_h_
+#define _PSWR_A_Window_h_
+
+#include <stdint.h>
+
+template <typename T>
+class SlidingMax
+{
+  public:
+    typedef struct {
+              T        value;           // Sample value
+              uint16_t stamp;           // Sequence number of sample when added
+                   }  entry_t;
+
+    //------------------------------------------------------------------------------
+    // Returned by peak() if no values in window, -0x7fff or -0x7fffffff
+    static T empty(void) { return (T) -(T) (((uint32_t) 1 << (8 * sizeof(T) - 1)) - 1); }
+    //------------------------------------------------------------------------------
+    // Init with a storage buffer, its size in entries, and the window length
+    // (window length is in samples, and can never be longer than the buffer size)
+    void init(entry_t *buf, uint16_t bufsize, uint16_t winlen)
+    {
+      q     = buf;
+      size  = bufsize;
+      clear();
+      length(winlen);
+    }
+    //------------------------------------------------------------------------------
+    // Change window length at runtime, bounded by the storage buffer size.  Values
+    // older than the new window are expired when the next value is added, no rescan
+    // is needed.
+    void length(uint16_t winlen)
+    {
+      if (winlen > size) winlen = size;
+      if (winlen < 1)    winlen = 1;
+      len = winlen;
+    }
+    uint16_t length(void) { return len; }
+    //------------------------------------------------------------------------------
+    // Add the newest value, returns max value within the window
+    //
+    // The queue holds values in decreasing order from head.  A new value removes all
+    // smaller values at the back, as these can never again become the max.  Values at
+    // the head are expired once they fall out of the window.  Each value is added and
+    // removed only once, hence amortized O(1) per sample.
+    T add(T value)
+    {
+      uint16_t back;
+
+      // Expire values which have fallen out of the window (or a shortened window)
+      while (count && ((uint16_t)(stamp - q[head].stamp) >= len))
+      {
+        head++;
+        if (head >= size) head = 0;
+        count--;
+      }
+
+      // Remove values at the back which are not larger than the newest value
+      while (count)
+      {
+        back = head + count - 1;
+        if (back >= size) back -= size;
+        if (q[back].value > value) break;
+        count--;
+      }
+
+      // Add the newest value at the back
+      back = head + count;
+      if (back >= size) back -= size;
+      q[back].value = value;
+      q[back].stamp = stamp;
+      count++;
+      stamp++;
+
+      return q[head].value;
+    }
+    //------------------------------------------------------------------------------
+    // Max value within the window, empty() if nothing has been added
+    T peak(void) { return count ? q[head].value : empty(); }
+    void clear(void)                    // Empty the window
+    {
+      head  = 0;
+      count = 0;
+      stamp = 0;
+    }
+
+  private:
+    entry_t *q;                         // Monotonic queue, decreasing values from head
+    uint16_t size;                      // Storage buffer size
+    uint16_t len;                       // Window length
+    uint16_t head;                      // Oldest (and largest) queue entry
+    uint16_t count;                     // Number of entries in queue
+    uint16_t stamp;                     // Sequence number of next sample, rolls over
+};
+
+#endif
@@ -41,6 +41,17 @@
 #include <Encoder.h>
 #include <TimerOne.h>
 #include "PSWRtft.h"
+#include "PSWRwindow.h"
+#include "PSWRring.h"
+#include "PSWRdecimate.h"
+#include "PSWRkeying.h"
+#include "PSWRhistogram.h"
+#include "PSWRquantile.h"
+#include "PSWRburst.h"
+#include "PSWRhistory.h"
+#include "PSWRacquire.h"
+#include "PSWRlookup.h"
+#include "PSWRfastmath.h"
 #include "_EEPROMAnything.h"
 #include "_MoonPic.c"
 
@@ -68,36 +79,61 @@
 
 //-----------------------------------------------------------------------------
 // 2X AD8307 Log Amp Detectors, or Diode Detectors
+#ifndef AD8307_INSTALLED            // (can be set by the build, as the host build does)
 #define AD8307_INSTALLED          1 // 0 for Diode Detectors, 1 for 2x AD8307
+#endif
 
 //-----------------------------------------------------------------------------  
 // Poll for I2C enabled external AD7991 or no?
 // (it is harmless to keep this on even if not used)
 #define WIRE_ENABLED              0 // 1 to enable, 0 to disable
 
+//-----------------------------------------------------------------------------
+// Trigger the builtin ADCs from the Programmable Delay Block and pick up the
+// results in the conversion complete interrupt, rather than busy waiting for
+// them in the sample timer interrupt.  An AD7991, if detected, is always polled.
+#define ADC_PDB_ENABLED           1 // 1 to enable, 0 to disable
+
 //
 //-----------------------------------------------------------------------------
-// Defaults for measurement rate, PEP, PK and AVG buffer sizes
+// Defaults for measurement rate and buffer sizes.  The sample rate can be changed
+// at runtime, by Menu or USB $samplerateset, between SAMPLE_TIMER_MIN and
+// SAMPLE_TIMER_MAX.
+//
+// Samples are decimated before they are put to use.  Peak and PEP are fed with the
+// max, and the averages with the mean, of each DECIM_TICKS:th part of 100ms.  The
+// Modulation Scope is fed with the max of each SCOPE_PIXEL_US x Divisor.  Hence
+// the window sizes do not depend on the sample rate, and a faster rate only adds
+// resolution, not work further down the line.
+//
+// The defaults leave room for an AD7991, whose I2C transfer takes about 140us of
+// each sample period.  Faster rates can be selected with the builtin ADCs.
 #if F_CPU >= 144000000              // If CPU is overclocked at 144 MHz or higher, then 1500 samples per second
                                     // (Overclocking can be enabled by editing board.txt in Teensyduino)
-#define SAMPLE_TIMER            667 // Interrupt timer, in microseconds
-#define BUF_SHORT               150 // Buffer size for 100ms Peak
-#define PEP_BUFFER               50 // PEP Buffer size in multiples of BUF_SHORT, can hold up to 5 second PEP
-#define LONG_BUFFER              30 // LONG Buffer size in multiples of shortest PEP period (1s) - typically 30 seconds
-#define AVG_BUF1S              1500 // AVG Buffer sample size (1000 is 1 second, if SAMPLE_TIMER = 1000)
-#define AVG_BUFSHORT            150 // Short (100ms) AVG Buffer size
+#ifndef SAMPLE_TIMER
+#define SAMPLE_TIMER            667 // Default Interrupt timer, in microseconds
+#endif
 #define AVG_BUFSWR               15 // Very short buffer for SWR bargraph smoothing.  Time is POLL_TIMER*AVG_BUFSWR
-#define MODSCOPE_DIVISOR          1 // Modultion Scope scan rate divisor
 #else                               // 1000 samples per second at normal Teensy speed (96 MHz)
-#define SAMPLE_TIMER           1000 // Interrupt timer, in microseconds
-#define BUF_SHORT               100 // Buffer size for 100ms Peak
-#define PEP_BUFFER               50 // PEP Buffer size in multiples of BUF_SHORT, can hold up to 5 second PEP
-#define LONG_BUFFER              30 // LONG Buffer size in multiples of shortest PEP period (1s) - typically 30 seconds
-#define AVG_BUF1S              1000 // AVG Buffer sample size (1000 is 1 second, if SAMPLE_TIMER = 1000)
-#define AVG_BUFSHORT            100 // Short (100ms) AVG Buffer size
+#ifndef SAMPLE_TIMER
+#define SAMPLE_TIMER           1000 // Default Interrupt timer, in microseconds
+#endif
 #define AVG_BUFSWR               10 // Very short buffer for SWR bargraph smoothing.  Time is POLL_TIMER*AVG_BUFSWR
-#define MODSCOPE_DIVISOR          1 // Modultion Scope scan rate divisor
 #endif
+#define SAMPLE_TIMER_MIN        250 // Fastest selectable rate, 4000 samples per second
+#define SAMPLE_TIMER_MAX       5000 // Slowest selectable rate, 200 samples per second
+#define DECIM_TICKS              10 // Decimated Peak and AVG periods within 100ms, 10ms each
+#define PEP_BUFFER               50 // PEP Buffer size in 100ms blocks, can hold up to 5 second PEP
+#define LONG_BUFFER              30 // LONG Buffer size in multiples of shortest PEP period (1s) - typically 30 seconds
+#define MODSCOPE_DIVISOR          1 // Modultion Scope scan rate divisor
+#define SCOPE_PIXEL_US         1000 // Modulation Scope time per pixel at divisor 1, microseconds
+
+//-----------------------------------------------------------------------------
+// Depth of the ring carrying sampled adc-input pairs from the interrupt function
+// to the main loop.  Has to be a power of two.  At 1000 samples per second,
+// 1024 entries ride out a main loop stall of about 1s without dropping samples,
+// 256ms at the fastest selectable sample rate
+#define AD_RING_DEPTH          1024
 
 //-----------------------------------------------------------------------------
 // Timer for Power/SWR calculations and LCD prints, milliseconds
@@ -153,23 +189,17 @@
 //-----------------------------------------------------------------------------
 // 20 to 1 Tandem Match coupler with Power and SWR Meter
 // (default defines are for a 30 to 1 coupler)
+#ifndef TWENTYTOONE
 #define TWENTYTOONE               0 // 1 to select the values for 20 to 1 coupler, else 0
+#endif
 //
-#if TWENTYTOONE                     // Defs when using a 20 to 1 coupler
-#define CAL1_NOR_VALUE          400 // 40 dBm, default dBm level1 for both AD8307
-#define CAL2_NOR_VALUE          100 // 10 dBm, default dBm level2 for both AD8307
-#define CALFWD1_DEFAULT       2.452 // Default raw Voltage level1 at 40 dBm
-#define CALREV1_DEFAULT       2.452 // Default raw Voltage level1 at 40 dBm
-#define CALFWD2_DEFAULT       1.702 // Default raw Voltage level2 at 10 dBm
-#define CALREV2_DEFAULT       1.702 // Default raw Voltage level2 at 10 dBm
-#else                               // Defs when using a 30 to 1 coupler
-#define CAL1_NOR_VALUE          400 // 40 dBm, default dBm level1 for both AD8307
-#define CAL2_NOR_VALUE          100 // 10 dBm, default dBm level2 for both AD8307
-#define CALFWD1_DEFAULT       2.233 // Default raw Voltage level1 at  40 dBm
-#define CALREV1_DEFAULT       2.233 // Default raw Voltage level1 at  40 dBm
-#define CALFWD2_DEFAULT       1.528 // Default raw Voltage level2 at  10 dBm
-#define CALREV2_DEFAULT       1.528 // Default raw Voltage level2 at  10 dBm
-#endif                              // End coupler selection
+                                    // Calibration defaults for each coupler are in PSWRkernel.h
+#define CAL1_NOR_VALUE      pswr_coupler::cal1_nor_value
+#define CAL2_NOR_VALUE      pswr_coupler::cal2_nor_value
+#define CALFWD1_DEFAULT     pswr_coupler::calfwd1_default
+#define CALREV1_DEFAULT     pswr_coupler::calrev1_default
+#define CALFWD2_DEFAULT     pswr_coupler::calfwd2_default
+#define CALREV2_DEFAULT     pswr_coupler::calrev2_default
 
 //-----------------------------------------------------------------------------
 // DEFS for Diode Detectors
@@ -183,18 +213,10 @@
 //-----------------------------------------------------------------------------
 // Defs for Power and SWR indication
 //
-#if AD8307_INSTALLED                // --------------Used with AD8307:
-#if TWENTYTOONE                     // Defs when using a 20 to 1 coupler and AD7991
-#define MIN_PWR_FOR_SWR_CALC   0.5  // Minimum Power in mW for SWR calculation and display
-#else                               // Defs when using a 30 to 1 coupler and AD7991
-#define MIN_PWR_FOR_SWR_CALC   1.0  // Minimum Power in mW for SWR calculation and display
-#endif
-#define MIN_PWR_FOR_SWR_SHOW  0.01  // Minimum Power in mW for SWR indication (use recent value)
-//-----------------------------------------------------------------------------
-#else                               // --------------Used if Diode detectors:
+// (Minimum Power for SWR calculation and indication is set by the Detector and
+//  Coupler policies in PSWRkernel.h)
+#if !AD8307_INSTALLED               // --------------Used if Diode detectors:
 #define MIN_PWR_FOR_METER       30  // Minimum Power in mW for Power/SWR Meter indication on LCD
-#define MIN_PWR_FOR_SWR_CALC    30  // Minimum Power in mW for SWR calculation and display
-#define MIN_PWR_FOR_SWR_SHOW    30  // Minimum Power in mW for SWR indication (use recent value)
 #endif
 
 //-----------------------------------------------------------------------------
@@ -216,7 +238,7 @@
 // EEPROM settings Serial Number. Increment this number when firmware mods necessitate
 // fresh "Factory Default Settings" to be forced into the EEPROM at first boot after
 // an upgrade
-#define COLDSTART_REF          0x07 // When started, the firmware examines this "Serial Number
+#define COLDSTART_REF          0x0a // When started, the firmware examines this "Serial Number
                                     // and enforces factory reset if there is a mismatch.
                                     // Rolling this value is useful if the EEPROM structure has been modified
 
@@ -243,8 +265,21 @@
 #define SCALE_RANGE3             55 // If all values set as "2", then ... 2W 20W 200W ...
 
 //-----------------------------------------------------------------------------
-// PEP envelope sample size for 1, 2.5 or 5 second sample time
-#define PEP_PERIOD (2500000/SAMPLE_TIMER)/BUF_SHORT // 2.5 seconds = Default
+// PEP envelope sample time in 100ms blocks, for 1, 2.5 or 5 seconds
+#define PEP_PERIOD               25 // 2.5 seconds = Default
+
+//-----------------------------------------------------------------------------
+// Needle ballistics, an alternative to the PEP window for the Bargraph Power
+// display modes, selected for each mode in the PEP Menu.  Fast attack and slow
+// decay, like the needle of a peak reading analog wattmeter.  Time constants in
+// milliseconds, attack towards a higher power and exponential decay of the power
+#define NEEDLE_PRESETS            3 // Fast, Medium and Slow
+#define NEEDLE_FAST_ATTACK        1
+#define NEEDLE_FAST_DECAY       500
+#define NEEDLE_MED_ATTACK         5
+#define NEEDLE_MED_DECAY       1500
+#define NEEDLE_SLOW_ATTACK       10
+#define NEEDLE_SLOW_DECAY      4000
 
 
 //-----------------------------------------------------------------------------
@@ -269,6 +304,95 @@
 #define	POLL_LOOP_THRU_LED       1  // Blink the debug led on Microprocessor every 10ms, when going through the mainloop *OR*
 #define SLOW_LOOP_THRU_LED       0  // Blink the debug led on Microprocessor every 100ms, when going through the mainloop
 
+//-----------------------------------------------------------------------------
+// Hot path profiler, cycle counts of interrupt, measurement, display, touch and
+// USB functions, reported by the $perf USB command
+#define PERF_ENABLED             1  // 1 to enable, 0 to disable
+
+//-----------------------------------------------------------------------------
+// Sampler interrupt monitor, histograms of sample period jitter and interrupt
+// duration, and a count of lost samples, reported by the $isrstat USB command.
+// Lost samples raise a "SAMPLES DROPPED" flag on the Debug 2 screen and over USB
+#define ISRMON_ENABLED           1  // 1 to enable, 0 to disable
+
+//-----------------------------------------------------------------------------
+// High rate transient capture, $burst USB command.  The builtin ADCs are set up
+// for speed rather than resolution, and fwd/rev pairs are captured into a
+// dedicated buffer once power exceeds a threshold, then dumped over USB.
+// Normal metering is paused while capturing.  Needs ADC_PDB_ENABLED
+#define CAPTURE_ENABLED          1  // 1 to enable, 0 to disable
+#if defined(__MK64FX512__) || defined(__MK66FX1M0__)
+#define CAPTURE_BUFFER       16384  // Max pairs captured, Teensy 3.5 / 3.6
+#else
+#define CAPTURE_BUFFER        4096  // Max pairs captured, Teensy 3.1 / 3.2
+#endif
+#define CAPTURE_TIMER           20  // Sample period while capturing, microseconds (50000 per second)
+#define CAPTURE_TIMEOUT      10000  // Give up if not triggered within this time, milliseconds
+#define CAPTURE_CHUNK          256  // Pairs of the capture buffer analyzed per main loop pass
+
+//-----------------------------------------------------------------------------
+// CW keying analyzer, rise and fall time, overshoot, droop and time to full power
+// of each key down, shown by the CW Keying display mode and the $keying USB command.
+// Key down is power above the Screensaver threshold, or KEYING_FLOOR if lower
+#define KEYING_FLOOR         -3000  // Lowest key down threshold, dBm x 100
+
+//-----------------------------------------------------------------------------
+// Power distribution, a histogram of the instantaneous power while transmitting,
+// with the same threshold as above, shown by the Power Distribution display mode
+// and the $ccdf USB command.  Old samples fade out by a selectable time constant
+#define HIST_DECAY              10  // Time constant in seconds, 0 to hold until reset by USB
+
+//-----------------------------------------------------------------------------
+// Median, P90 and P99 of forward power and of SWR, while transmitting, over 1s,
+// PEP period and 30s windows.  Estimated without storing the observations, one
+// observation each sample.  A window is restarted once its result has been taken
+#define QWIN_1S                  0  // Window indexes
+#define QWIN_PEP                 1
+#define QWIN_LONG                2
+#define QWINDOWS                 3
+
+//-----------------------------------------------------------------------------
+// Transmission burst log, $bursts USB command.  A record for each burst of power
+// above the Screensaver threshold (with the same hysteresis as the keying analyzer),
+// the most recent ones are kept
+#if defined(__MK64FX512__) || defined(__MK66FX1M0__)
+#define BURST_RING             400  // Records kept, 24 bytes each, Teensy 3.5 / 3.6
+#else
+#define BURST_RING             200  // Records kept, Teensy 3.1 / 3.2
+#endif
+
+//-----------------------------------------------------------------------------
+// Multi resolution history of power and SWR, $hist USB command.  Three tiers, of
+// 100ms, 1s and 1 minute slots, each slot holding min, average and max power and
+// max SWR in 4 bytes.  The coarser tiers are aggregated from the finer ones
+#if defined(__MK64FX512__) || defined(__MK66FX1M0__)
+#define HISTORY_T0            6000  // 100ms slots, 10 minutes, Teensy 3.5 / 3.6
+#define HISTORY_T1            7200  // 1s slots, 2 hours
+#define HISTORY_T2            2880  // 1 minute slots, 48 hours
+#define HISTORY_RAM          65536  // RAM budget of all three tiers, bytes
+#else
+// The 10 minute and 2 hour fine tiers of the Teensy 3.5 / 3.6 take 52 kB, more
+// than is left of the 64 kB of a Teensy 3.1 / 3.2 besides the capture buffer and
+// the sample ring, the fine tiers are cut down to 30 seconds and 10 minutes
+#define HISTORY_T0             300  // 100ms slots, 30 seconds, Teensy 3.1 / 3.2
+#define HISTORY_T1             600  // 1s slots, 10 minutes
+#define HISTORY_T2            2880  // 1 minute slots, 48 hours
+#define HISTORY_RAM          16384  // RAM budget of all three tiers, bytes
+#endif
+static_assert(sizeof(hslot_t) * (HISTORY_T0 + HISTORY_T1 + HISTORY_T2) <= HISTORY_RAM, "History tiers exceed HISTORY_RAM");
+
+//-----------------------------------------------------------------------------
+// RAM budget of the large static buffers: sample ring, capture buffer, power
+// distribution, keying analyzer, burst log, history and Modulation Scope.  Checked
+// at compile time, reported by the $ramstat USB command.  The rest is left to the
+// stack, the USB and TFT libraries and the smaller variables.  The lookup tables
+// and the startup picture are const, in flash
+#if defined(__MK64FX512__) || defined(__MK66FX1M0__)
+#define RAM_BUDGET          196608  // Bytes, out of 256 kB SRAM, Teensy 3.5 / 3.6
+#else
+#define RAM_BUDGET           49152  // Bytes, out of 64 kB SRAM, Teensy 3.1 / 3.2
+#endif
+
 //-----------------------------------------------------------------------------
 // Definitions for Rotary Encoder and Pushbutton - harmless if not used
 #define  ENC_RESDIVIDE            4 // Encoder resolution reduction
@@ -326,12 +450,8 @@ const int X_Led             =  23;  // Debug
 //-----------------------------------------------------------------------------
 // Structures and Unions
 
-typedef struct {
-          int16_t  fwd[256];                  // Circular buffer of Forward measurement values
-          int16_t  rev[256];                  // Circular buffer of Reverse measurement values
-          uint8_t  incount;                   // Pointer to most recent input value of circular buffer
-          uint8_t  outcount;                  // Pointer to most recent output value of circular buffer
-               }  adbuffer_t;
+// Ring of packed measurement value pairs, Forward in lower and Reverse in upper 16 bits
+typedef SpscRing<uint32_t, AD_RING_DEPTH> adbuffer_t;
                
 typedef struct {
           int16_t  db10m;                     // Calibrate, value in dBm x 10
@@ -366,8 +486,10 @@ typedef struct {
                      #define  REPORT_1SAVGDB  11    // Report Average (1s) Power and SWR to USB
                      #define  REPORT_LONG     12    // Report Power and SWR to USB, long Human Readable format                   
                      #define  REPORT_AD_DEBUG 13    // Report raw AD values
-          uint16_t PEP_period;                // PEP envelope sampling time in SAMPLE_TIME increments
-          uint16_t AVG_period;                // AVG sampling time in SAMPLE_TIME increments
+          uint16_t PEP_period;                // PEP envelope sampling time in 100ms increments
+          uint16_t AVG_period;                // Default AVG sampling time, 0 for short, 1 for 1 second
+          uint16_t sample_timer;              // Sample interrupt timer in microseconds
+          uint16_t hist_decay;                // Power distribution time constant in seconds, 0 to hold
           uint8_t  ScaleRange[3];             // User settable Scale ranges, up to 3 ranges per decade.
           char     idle_disp[21];             // Sleep Display (configurable by USB serial command)
           float    idle_disp_thresh;          // Minimum level in mW to exit Sleep Display	
@@ -386,13 +508,16 @@ typedef struct {
                      #define  POWER_CLEAN_DBM  5
                      #define  POWER_MIXED      6
                      #define  MODULATIONSCOPE  7
-                     //#define  DEBUG          8
+                     #define  KEYING           8
+                     #define  CCDF             9
+                     //#define  DEBUG         10
                      #define  DEFAULT_MODE     1
-                     #define  MAX_MODE         7    // Same as highest
+                     #define  MAX_MODE         9    // Same as highest
           unsigned mode_default        : 4;   // Default mode, excluding Modulation Scope
+          uint8_t  needle[MAX_MODE+1];        // For each display mode: 0 for PEP window, else Needle preset 1 - 3
 
           uint8_t  modscopeDivisor;           // Modultion Scope scan rate divisor
-                                              // total time of a scan = SAMPLE_TIMER * TFT_x_axis * Divisor
+                                              // total time of a scan = SCOPE_PIXEL_US * TFT_x_axis * Divisor
                                               // e.g. 1000us * 300 * 1 = 0.3 seconds for a full sweep
           disp_t   disp;                      // Runtime Settings for Display
                 } var_t;
@@ -409,6 +534,7 @@ typedef struct {
           unsigned menu_lcd_upd        : 1;   // Refresh/Update LCD when in Menu Mode
           unsigned config_mode         : 1;   // Configuration Menu Mode is active
           unsigned picture             : 1;   // Picture on screen (to signal delete on clear if present)
+          unsigned samples_dropped     : 1;   // Samples have been lost since last $isrreset
                 } flags;
 
 typedef struct {                              // Touch screen push states
@@ -424,6 +550,34 @@ typedef struct {                              // Touch screen push states
           unsigned lower               :  1;  // Indicate if lower 1/3rd of screen has been touched
                 } touch_flags;
 
+typedef struct {                              // Profiler scope, see PSWRperf.ino
+          uint32_t min;                       // Shortest run, CPU cycles
+          uint32_t max;                       // Longest run, CPU cycles
+          uint32_t count;                     // Number of runs
+          uint64_t sum;                       // All runs added together, for the average
+                } perf_t;
+                     #define  PERF_SAMPLER     0    // Sampler interrupt, timer polled or PDB
+                     #define  PERF_SYNC        1    // pswr_sync_from_interrupt()
+                     #define  PERF_SWR         2    // calc_SWR_and_power()
+                     #define  PERF_TOUCH       3    // manage_Touchscreen()
+                     #define  PERF_USB         4    // usb_read_serial()
+                     #define  PERF_DISPLAY     5    // Config Menu, then each display mode
+                     #define  PERF_SCOPES      (PERF_DISPLAY + MAX_MODE + 1)
+
+#define ISRMON_BINS               9  // Histogram bins, edges in isrmon_edge_us[]
+
+typedef struct {                              // Sampler interrupt monitor, see PSWRperf.ino
+          uint32_t last;                      // Cycle count at previous interrupt entry
+          uint32_t period;                    // Nominal sample period, CPU cycles
+          uint32_t count;                     // Number of interrupts seen
+          uint32_t missed;                    // Sample periods which passed without an interrupt
+          uint32_t jitter_max;                // Largest deviation from nominal period, CPU cycles
+          uint32_t dur_max;                   // Longest interrupt run, CPU cycles
+          uint32_t drops_base;                // Ring drop count at last reset
+          uint32_t jitter[ISRMON_BINS];       // Histogram of deviation from nominal period
+          uint32_t dur[ISRMON_BINS];          // Histogram of interrupt run time
+          bool     primed;                    // Previous entry time is valid
+                } isrmon_t;
 //-----------------------------------------------------------------------------
 // Macros
 #ifndef SQR
@@ -433,12 +587,40 @@ typedef struct {                              // Touch screen push states
 #define ABS(x) ((x>0)?(x):(-x))
 #endif
 
+//-----------------------------------------------------------------------------
+// Profiler scope, from PERF_BEGIN(t) to PERF_END(scope, t)
+#if PERF_ENABLED
+#define PERF_BEGIN(t)      uint32_t t = ARM_DWT_CYCCNT
+#define PERF_END(id, t)    perf_add(id, ARM_DWT_CYCCNT - (t))
+#else
+#define PERF_BEGIN(t)
+#define PERF_END(id, t)
+#endif
+
+//-----------------------------------------------------------------------------
+// Sampler interrupt monitor, ISRMON_BEGIN(t) at entry and ISRMON_END(t) at exit
+#if ISRMON_ENABLED
+#define ISRMON_BEGIN(t)    uint32_t t = ARM_DWT_CYCCNT
+#define ISRMON_END(t)      isrmon_add(t, ARM_DWT_CYCCNT)
+#else
+#define ISRMON_BEGIN(t)
+#define ISRMON_END(t)
+#endif
+
 //-----------------------------------------------------------------------------
 // Soft Reset
 #define RESTART_ADDR       0xE000ED0C
 #define RESTART_VAL        0x5FA0004
 #define SOFT_RESET()       ((*(volatile uint32_t *)RESTART_ADDR) = (RESTART_VAL))
 
+//-----------------------------------------------------------------------------
+// Measurement kernel, specialized for the detector and coupler selected above
+#include "PSWRkernel.h"
+#define AD_BLOCK                256           // Max ring entries processed in one block
+typedef CouplerSelect<TWENTYTOONE>::type                   pswr_coupler;
+typedef DetectorSelect<AD8307_INSTALLED, AD_BLOCK>::type   pswr_detector;
+typedef PswrKernel<pswr_detector, pswr_coupler>            pswr_kernel_t;
+
 
 extern ILI9341_t3 tft;                        // To keep the .cpp stuff happy
 
@@ -28,7 +28,7 @@
 
 #include "PSWR_T.h"
 
-volatile adbuffer_t measure;// Two 256 byte circular buffers carrying the sampled adc-inputs
+adbuffer_t  measure;        // A ring buffer carrying the sampled adc-input pairs
                             // from the interrupt function to the main loop.
                             
 double      adc_ref;        // ADC reference (Teensy or external AD7991)
@@ -39,6 +39,9 @@ double      r_inst;         // Calculated Reverse voltage
 #if AD8307_INSTALLED
 double      ad8307_FdBm;    // Measured AD8307 forward voltage in dBm
 double      ad8307_RdBm;    // Measured AD8307 reverse current in dBm
+int16_t     ad8307_Fdb100;  // Measured AD8307 forward voltage in dBm x 100
+int16_t     ad8307_Rdb100;  // Measured AD8307 reverse current in dBm x 100
+uint16_t    swr_log;        // 1000 x log10(SWR), from Return Loss lookup of each sample
 #endif
 double      fwd_power_mw;   // Calculated forward power in mW
 double      ref_power_mw;   // Calculated reflected power in mW
@@ -52,8 +55,11 @@ double      power_db;       // Calculated power in dBm
 double      power_db_pk;    // Calculated 100ms peak power in dBm
 double      power_db_pep;   // Calculated PEP power in dBm
 double      power_db_long;  // Calculated MAX power in dBm, 30 sec or longer window
+double      power_mw_needle;// Needle ballistics of the power in mW, if selected for the display mode
 double      swr=1.0;        // SWR as an absolute value
 double      swr_avg=1.0;    // SWR average over 10 ms (smoothed value)
+quant_t     fwd_q[QWINDOWS];// Forward power quantiles in mW, 1s, PEP and 30s windows
+quant_t     swr_q[QWINDOWS];// SWR quantiles, 1s, PEP and 30s windows
 
 uint16_t    menu_level = 0; // Used with PSWRmenu. Keep track of which menu we are in
 char        lcd_buf[82];    // Used to process data to be passed to LCD and USB Serial
@@ -89,8 +95,10 @@ var_t  R  = {
               SWR_THRESHOLD,            // Default SWR Alarm power threshold defined in PSWR_A.h
               0,                        // USB Continuous reporting off
               1,                        // USB Reporting type, 1=Instantaneous Power (raw format) and SWR to USB 
-              PEP_PERIOD,               // PEP envelope sampling time in SAMPLE_TIME increments
+              PEP_PERIOD,               // PEP envelope sampling time in 100ms increments
               0,                        // Default AVG sampling time, 0 for short, 1 for 1 second
+              SAMPLE_TIMER,             // Sample interrupt timer in microseconds
+              HIST_DECAY,               // Power distribution time constant in seconds, 0 to hold
               {  
                 SCALE_RANGE1,           // User definable Scale Ranges, up to 3 ranges per decade
                 SCALE_RANGE2,           // e.g. ... 6W 12W 24W 60W 120W 240W ...
@@ -103,8 +111,9 @@ var_t  R  = {
               FLOOR_NOISEFLOOR,         // No low power level threshold, lowest power shown is the effective noise floor
               DEFAULT_MODE,             // Set default Display Mode
               POWER_BARPK,              // Default initial shortcut Display Mode (anything other than MODSCOPE)
+              { 0 },                    // PEP window, not Needle ballistics, for all display modes
               MODSCOPE_DIVISOR,         // Modultion Scope scan rate divisor
-                                        // total time of a scan = SAMPLE_TIMER * TFT_x_axis * Divisor
+                                        // total time of a scan = SCOPE_PIXEL_US * TFT_x_axis * Divisor
                                         // e.g. 1000us * 300 * 1 = 0.3 seconds for a full sweep
               {
                 0,                      // 1 for Upside down, else 0
@@ -141,6 +150,25 @@ TextBox         VirtLCDy;               // A 20x10 Virtual Text LCD to TFT, yell
 TextBox         VirtLCDlargeY;          // A Large 6x1 Virtual Text LCD to TFT, yellow
 TextBox         VirtLCDlargeR;          // A Large 6x1 Virtual Text LCD to TFT, red
 ModulationScope ModScope;
+KeyingAnalyzer  Keying;                 // CW keying waveform, from the sample ring
+PowerHistogram  Hist;                   // Power distribution, from the sample ring
+BurstLog<BURST_RING> Bursts;            // Transmission burst records, from the sample ring
+PowerHistory<HISTORY_T0, HISTORY_T1, HISTORY_T2> History;   // Power and SWR, 100ms, 1s and 1 minute slots
+
+//
+//-----------------------------------------------------------------------------------------
+// RAM budget of the large buffers, the build fails if they do not fit the platform
+//-----------------------------------------------------------------------------------------
+//
+#if CAPTURE_ENABLED && ADC_PDB_ENABLED
+#define RAM_CAPTURE   (CAPTURE_BUFFER * sizeof(uint32_t))   // capture_buf, PSWRtransient.ino
+#else
+#define RAM_CAPTURE   0
+#endif
+#define RAM_ANALYSES  (sizeof(Keying) + sizeof(Hist) + sizeof(Bursts) + sizeof(History))
+#define RAM_LARGE     (sizeof(measure) + RAM_CAPTURE + RAM_ANALYSES + sizeof(ModScope))
+
+static_assert(RAM_LARGE <= RAM_BUDGET, "Large buffers exceed RAM_BUDGET, see PSWR_T.h");
 
 //
 //-----------------------------------------------------------------------------------------
@@ -149,6 +177,9 @@ ModulationScope ModScope;
 //
 void powerSampler(void)
 {
+  ISRMON_BEGIN(isr_t0);
+  PERF_BEGIN(perf_t0);
+
   #if INTR_LOOP_THRU_LED                    // Blink LED every time going through here 
   digitalWrite(X_Led,X_LedState ^= 1);      // Set the LED
   #endif
@@ -158,6 +189,9 @@ void powerSampler(void)
   #if INTR_LOOP_THRU_LED                    // Blink LED every time going through here 
   digitalWrite(X_Led,X_LedState ^= 1);      // Reset the LED
   #endif
+
+  PERF_END(PERF_SAMPLER, perf_t0);
+  ISRMON_END(isr_t0);
 }
 
 //
@@ -181,8 +215,14 @@ void loop()
   digitalWrite(X_Led,X_LedState ^= 1);      // Blink a led
   #endif
 
+  PERF_BEGIN(perf_t0);
   pswr_sync_from_interrupt();               // Read and process circular buffers containing adc input,
                                             // calculate forward and reverse power, pep, pk and avg
+  PERF_END(PERF_SYNC, perf_t0);
+
+  #if CAPTURE_ENABLED && ADC_PDB_ENABLED
+  capture_poll();                           // Resume metering and dump when a $burst capture is done
+  #endif
   
   //-------------------------------------------------------------------
   // Green LED if power is detected
@@ -191,7 +231,9 @@ void loop()
 
   //-------------------------------------------------------------------
   // Check USB Serial port for incoming commands
+  PERF_BEGIN(perf_t1);
   usb_read_serial();
+  PERF_END(PERF_USB, perf_t1);
   
   //-------------------------------------------------------------------------------
   // Here we do routines which are to be accessed once every POLL_TIMER milliseconds
@@ -205,7 +247,9 @@ void loop()
     
     //-------------------------------------------------------------------
     // Prepare various types of power for print to LCD and calculate SWR
+    PERF_BEGIN(perf_t2);
     calc_SWR_and_power();
+    PERF_END(PERF_SWR, perf_t2);
     
     //----------------------------------------------
     // Power Detected Flag and Timer
@@ -227,7 +271,9 @@ void loop()
     //-------------------------------------------------------------------------------
     // Touch Screen Management
     //
+    PERF_BEGIN(perf_t3);
     manage_Touchscreen();
+    PERF_END(PERF_TOUCH, perf_t3);
     //-------------------------------------------------------------------------------
     // Meter Display Management and Entrance into Config Menu
     //
@@ -351,6 +397,7 @@ void loop()
     //
     if (Menu_exit_timer == 0)
     {
+      PERF_BEGIN(perf_t4);
       if (flag.config_mode)                     // Pushbutton Configuration Menu
       {
         ConfigMenu();
@@ -383,6 +430,15 @@ void loop()
       {
         lcd_display_modscope();
       }
+      else if (mode_display == KEYING)          // CW Keying waveform
+      {
+        lcd_display_keying();
+      }
+      else if (mode_display == CCDF)            // Power Distribution
+      {
+        lcd_display_ccdf();
+      }
+      PERF_END(PERF_DISPLAY + (flag.config_mode ? 0 : mode_display), perf_t4);
     }
     //----------------------------------------------
     // Send text to Display
@@ -470,6 +526,10 @@ void loop()
     #endif
     
     usb_cont_report();                      // Report Power and SWR to USB, if in Continuous mode
+
+    #if ISRMON_ENABLED
+    isrmon_check();                         // Raise SAMPLES DROPPED flag if samples have been lost
+    #endif
     
     //----------------------------------------------
     // Patience timer for storing new Default Mode into EEPROM
@@ -559,7 +619,6 @@ void setup()
   VirtLCDlargeR.init ( 6, 1,70,155, DroidSansMono_48, ILI9341_RED   , ILI9341_BLACK);  
 
   ModScope.init(5, 5, 310, 166, ILI9341_WHITE, ILI9341_GREEN, ILI9341_YELLOW);
-  ModScope.rate(R.modscopeDivisor);         // Modulation scope rate divisor
 
   //------------------------------------------
   // LCD Print Version and I2C information (6 seconds in total during startup)
@@ -620,6 +679,8 @@ void setup()
   VirtLCDlargeR.clear();
   tft.fillScreen(0x000000);                 // Erase picture
 
-  Timer1.initialize(SAMPLE_TIMER);          // Init the adc sample timer interrupt function
-  Timer1.attachInterrupt(powerSampler);     // Start the works
+  pswr_window_init();                       // Init Peak, PEP and LONG sliding windows
+
+  perf_cycle_counter_init();                // Cycle counter for the profiler
+  acq_start();                              // Start the works, sampling by timer or PDB
 }
@@ -0,0 +1,97 @@
+//*********************************************************************************
+//**
+//** Acquisition backends for the Power and SWR Meter, simulated signal source.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include "PSWRacquire.h"
+
+//
+//-----------------------------------------------------------------------------------------
+//      Set the simulated signal,
+//      waveform, fwd and rev AD values at envelope peak, envelope frequency and noise
+//-----------------------------------------------------------------------------------------
+//
+void AcqSimulated::signal(wave_t w, uint16_t fwd, uint16_t rev, uint16_t f, uint16_t n)
+{
+  wave   = w;
+  fwd_pk = fwd;
+  rev_pk = rev;
+  freq   = f ? f : 1;
+  noise  = n;
+}
+
+void AcqSimulated::begin(acq_feed_t fn, uint32_t period_us)
+{
+  feed   = fn;
+  period = period_us;
+  t_us   = 0;
+  seed   = 1;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Produce a number of samples, each one sample period apart in simulated time
+//
+//      Two tone:  the envelope voltage is |cos(pi * spacing * t)|, which the log detectors
+//                 see as 20 * log10() of that, SIM_AD_PER_DB AD units per dB below peak.
+//      Keyed:     carrier on for the first half of each keying period, nothing otherwise.
+//-----------------------------------------------------------------------------------------
+//
+void AcqSimulated::run(uint32_t n)
+{
+  uint32_t env_us;                                  // Envelope period, microseconds
+  int32_t  db100;                                   // Envelope level below peak, dB x 100
+  int32_t  f, r;
+
+  if (!feed) return;
+  env_us = 1000000 / freq;
+
+  while (n--)
+  {
+    if (wave == TWOTONE)
+    {
+      double env = fabs(cos(M_PI * (t_us % env_us) / env_us));
+      db100 = env > 1e-4 ? lround(2000 * log10(env)) : -8000;
+    }
+    else if ((wave == KEYED) && ((t_us % env_us) >= env_us/2))
+      db100 = -8000;                                // Key up, well below detector floor
+    else
+      db100 = 0;
+
+    f = fwd_pk + db100 * SIM_AD_PER_DB / 100;
+    r = rev_pk + db100 * SIM_AD_PER_DB / 100;
+    if (noise)
+    {
+      seed = seed * 1664525 + 1013904223;           // Numerical Recipes LCG
+      f += (int32_t) ((seed >> 16) % (2 * noise + 1)) - noise;
+      seed = seed * 1664525 + 1013904223;
+      r += (int32_t) ((seed >> 16) % (2 * noise + 1)) - noise;
+    }
+    if (f < 0) f = 0;
+    if (f > 4095) f = 4095;
+    if (r < 0) r = 0;
+    if (r > 4095) r = 4095;
+
+    feed((uint32_t) f | ((uint32_t) r << 16));
+    t_us += period;
+  }
+}
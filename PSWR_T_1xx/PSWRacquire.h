@@ -0,0 +1,83 @@
+//*********************************************************************************
+//**
+//** Acquisition backends for the Power and SWR Meter.
+//**
+//** A backend produces packed fwd/rev AD value pairs, Forward in lower and Reverse
+//** in upper 16 bits, at a fixed sample period, and hands each pair to a feed
+//** function, normally from interrupt context.  The main loop only ever sees the
+//** ring buffer the feed function pushes into, hence does not care which backend
+//** is active.
+//**
+//** Hardware backends (timer polled and PDB triggered) live with the rest of the
+//** ADC code in PSWRmeasure.ino.  The simulated backend here has no hardware
+//** dependencies, for testing and benchmarking the measurement pipeline on a host.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRacquire_h_
+#define _PSWRacquire_h_
+
+#include <stdint.h>
+
+typedef void (*acq_feed_t)(uint32_t);   // Receives one packed fwd/rev pair
+
+class AcqBackend
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Start producing one sample pair per sample period (microseconds)
+    virtual void begin(acq_feed_t, uint32_t) = 0;
+    virtual void end(void) = 0;         // Stop producing samples
+    virtual const char *name(void) = 0; // Short name for USB reports
+};
+
+//-----------------------------------------------------------------------------
+// Simulated signal source, produces AD values as seen from 2x AD8307 detectors.
+// There is no timer, run() produces a given number of samples on demand and
+// advances simulated time by one sample period for each.
+#define SIM_AD_PER_DB           31      // AD8307 25mV/dB, 12 bit AD at 3.3V
+
+class AcqSimulated : public AcqBackend
+{
+  public:
+    enum wave_t { CARRIER, TWOTONE, KEYED };
+    //------------------------------------------------------------------------------
+    // Waveform, forward and reverse AD values at the envelope peak, envelope
+    // frequency (two tone spacing or keying rate) in Hz and noise in AD units (+/-)
+    void signal(wave_t, uint16_t, uint16_t, uint16_t, uint16_t);
+    void begin(acq_feed_t, uint32_t);
+    void end(void) { feed = 0; }
+    const char *name(void) { return "sim"; }
+    //------------------------------------------------------------------------------
+    void run(uint32_t);                 // Produce a number of samples
+    uint32_t now_us(void) { return t_us; }  // Simulated time since begin
+
+  private:
+    acq_feed_t feed;
+    uint32_t period;                    // Sample period, microseconds
+    uint32_t t_us;                      // Simulated time, microseconds
+    uint32_t seed;                      // Noise generator state
+    wave_t   wave;
+    uint16_t fwd_pk, rev_pk;            // AD values at envelope peak
+    uint16_t freq;                      // Envelope frequency, Hz
+    uint16_t noise;                     // Noise amplitude, AD units
+};
+
+#endif
@@ -0,0 +1,135 @@
+//*********************************************************************************
+//**
+//** Transmission burst log.
+//**
+//** Fed with every sample, a burst starts when the power reaches a threshold and
+//** ends when it falls BURST_HYST below it.  For each burst a compact record is
+//** kept, start time, duration, peak and average power, energy, lowest and highest
+//** SWR and whether power was seen in the reverse direction.  The most recent
+//** records are kept in a fixed ring, the oldest being overwritten.
+//**
+//** Work per sample is O(1), a few additions and compares, plus the SWR while
+//** within a burst.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRburst_h_
+#define _PSWRburst_h_
+
+#include <stdint.h>
+#include <math.h>
+#include "PSWRfastmath.h"
+
+#define BURST_HYST             300      // Burst end hysteresis, dB x 100
+#define BURST_REVERSE         0x01      // Flag, power in the reverse direction seen
+
+typedef struct {                        // 24 bytes, little endian
+          uint32_t start_ms;            // millis() at start of burst
+          uint32_t duration_us;         // Duration, held at 0xffffffff beyond 71.6 minutes
+          float    energy_j;            // Energy, Joules
+          int16_t  peak;                // Peak power, dBm x 100
+          int16_t  avg;                 // Average power, dBm x 100
+          uint16_t swr_min;             // Lowest SWR x 100, 0 if no meaningful SWR
+          uint16_t swr_max;             // Highest SWR x 100
+          uint16_t flags;               // BURST_REVERSE
+          uint16_t seq;                 // Sequence number, lower 16 bits
+               }  burst_t;
+
+template <uint16_t N>
+class BurstLog
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Forget all records
+    void clear(void)
+    {
+      in_burst = false;
+      seq = 0;
+    }
+    //------------------------------------------------------------------------------
+    // Sample period, microseconds.  A burst in progress is ended
+    void period(uint32_t us)
+    {
+      if (in_burst) end();
+      t_us = us;
+    }
+    //------------------------------------------------------------------------------
+    // Add one sample, power in dBm x 100 and in uW, threshold in dBm x 100, now in
+    // ms.  Returns true while within a burst, then the caller adds the SWR, if
+    // meaningful, by swr()
+    bool add(int16_t db, uint32_t uw, bool reverse, int16_t on, uint32_t now)
+    {
+      if (!in_burst)
+      {
+        if (db < on) return false;
+        in_burst = true;
+        cur.start_ms = now;
+        cur.peak  = db;
+        cur.swr_min = 0;
+        cur.swr_max = 0;
+        cur.flags = 0;
+        n = 0;
+        sum_uw = 0;
+      }
+      else if (db < on - BURST_HYST)
+      {
+        end();
+        return false;
+      }
+      n++;
+      sum_uw += uw;
+      if (db > cur.peak) cur.peak = db;
+      if (reverse) cur.flags |= BURST_REVERSE;
+      return true;
+    }
+    void swr(float s)
+    {
+      uint16_t x = (s < 655) ? (uint16_t) (s * 100 + 0.5f) : 65535;
+
+      if ((cur.swr_min == 0) || (x < cur.swr_min)) cur.swr_min = x;
+      if (x > cur.swr_max) cur.swr_max = x;
+    }
+    //------------------------------------------------------------------------------
+    // Records kept, and record i of those, 0 being the oldest
+    uint16_t count(void) { return (seq < N) ? seq : N; }
+    const burst_t &get(uint16_t i) { return rec[(seq - count() + i) % N]; }
+    uint32_t recorded(void) { return seq; }
+
+  private:
+    void end(void)
+    {
+      in_burst = false;
+      cur.duration_us = ((uint64_t) n * t_us < 0xffffffffUL) ? n * t_us : 0xffffffffUL;
+      cur.energy_j = sum_uw * 1e-12 * t_us;       // uW x us
+      cur.avg = lroundf(100 * fast_lin_to_db(sum_uw / 1000.0f / n));
+      cur.seq = seq;
+      rec[seq++ % N] = cur;
+    }
+
+    bool     in_burst = false;
+    uint32_t t_us;                      // Sample period
+    uint32_t n = 0;                     // Samples within the burst in progress
+    uint64_t sum_uw = 0;                // Sum of power within the burst in progress, uW
+    burst_t  cur;                       // Burst in progress
+    uint32_t seq = 0;                   // Bursts recorded
+    burst_t  rec[N];                    // Most recent records, round robin
+};
+
+#endif
@@ -0,0 +1,105 @@
+//*********************************************************************************
+//**
+//** Decimators, bringing the sample rate down to the rate each consumer of the
+//** measurements needs.
+//**
+//** DecimateMax   keeps the largest value seen within each output period, hence
+//**               no peak is lost.  Used for the Peak and PEP windows and for the
+//**               Modulation Scope.
+//** DecimateMean  boxcar average (first order CIC) of each output period, the
+//**               sum is kept in a wider integer type and is exact.  Used for
+//**               the 100ms and 1s averages.
+//**
+//** The caller decides where each output period ends, by calling take(), and the
+//** periods need not all be of the same length.  A non integer decimation ratio,
+//** e.g. 150 samples into ten 10ms periods at 1500 samples per second, is then
+//** a matter of spreading the remainder over the periods.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRdecimate_h_
+#define _PSWRdecimate_h_
+
+#include <stdint.h>
+
+template <typename T>
+class DecimateMax
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Add the newest sample to the current period
+    void add(T v)
+    {
+      if ((n++ == 0) || (v > acc)) acc = v;
+    }
+    //------------------------------------------------------------------------------
+    // Number of samples in the current period
+    uint16_t count(void) { return n; }
+    //------------------------------------------------------------------------------
+    // Max value of the current period, only valid if count() > 0.  Then start
+    // the next period
+    T take(void)
+    {
+      n = 0;
+      return acc;
+    }
+    void clear(void) { n = 0; }
+
+  private:
+    T        acc;                       // Largest value within the current period
+    uint16_t n = 0;                     // Samples within the current period
+};
+
+template <typename T, typename ACC>
+class DecimateMean
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Add the newest sample to the current period
+    void add(T v)
+    {
+      acc += v;
+      n++;
+    }
+    //------------------------------------------------------------------------------
+    // Number of samples in the current period
+    uint16_t count(void) { return n; }
+    //------------------------------------------------------------------------------
+    // Average of the current period, rounded, 0 if no samples.  Then start the
+    // next period
+    T take(void)
+    {
+      T m = n ? (T) ((acc + n/2) / n) : 0;
+      acc = 0;
+      n = 0;
+      return m;
+    }
+    void clear(void)
+    {
+      acc = 0;
+      n = 0;
+    }
+
+  private:
+    ACC      acc = 0;                   // Sum of the samples within the current period
+    uint16_t n = 0;                     // Samples within the current period
+};
+
+#endif
@@ -239,13 +239,15 @@ void power_print_large(const char *str)
 //
 //-----------------------------------------------------------------------------
 //  Display: Bargraph, Power in Watts, SWR & PEP Power
-//  PEP Power always displayed and used for scale selection
+//  PEP Power always displayed, or the Needle if selected for the mode in the PEP Menu
 //  power variable can be anything passed to function (power_mv_avg, power_mw_pk, etc...)
 //-----------------------------------------------------------------------------
 //
 void lcd_display_clean(const char * introtext, const char * power_display_indicator, double power)
 {
   static uint16_t mode_timer;         // Used to time the Display Mode intro
+  bool   needle = R.needle[mode_display];           // Needle ballistics rather than PEP
+  double pep = needle ? power_mw_needle : power_mw_pep;
   double scale;                       // Progress bar scale
   double swr_alm;                     // SWR Alarm indication above this point by colour of graph
   double swr_mid = 2.0;               // Default SWR midlevel colour changeover point
@@ -302,7 +304,7 @@ void lcd_display_clean(const char * introtext, const char * power_display_indica
       scale = scale_BAR(power_mw_long); // Determine scale setting
       scalePowerMeter(scale, &adj_scale, range);
       Meter1.scale(adj_scale, range);   // Redraw the bargraph scale if needed
-      Meter1.graph(power,power_mw_pep,scale);
+      Meter1.graph(power,pep,scale);
     
       //------------------------------------------
       // SWR Meter
@@ -335,13 +337,13 @@ void lcd_display_clean(const char * introtext, const char * power_display_indica
       power_print_large(lcd_buf);
   
       //------------------------------------------
-      // Power indication, 1 second PEP
+      // Power indication, 1 second PEP, or Needle
       VirtLCDy.setCursor(19,9);       // Clear junk in line, if any
       VirtLCDy.print(" ");
       VirtLCDy.setCursor(9,9);
-      VirtLCDy.print(" PEP:");
+      VirtLCDy.print(needle ? " Ndl:" : " PEP:");
       VirtLCDy.setCursor(14,9);
-      print_p_mw(power_mw_pep);
+      print_p_mw(pep);
       VirtLCDy.print(lcd_buf);      
     }
   }
@@ -542,13 +544,23 @@ void lcd_display_mixed()
     
 
     //------------------------------------------
-    // Reflected Power indication
-    VirtLCDy.setCursor(19,9);          // Clear junk in line, if any
-    VirtLCDy.print(" ");
+    // Reflected Power indication, taking turns of 2 seconds with the median and
+    // the P99 SWR of the last 30s window, if any.  A high median is a mismatch, a
+    // high P99 over a low median is voice peaks.
+    uint8_t turn = (swr_q[QWIN_LONG].n > 0) ? (millis() / 2000) % 3 : 0;
+    VirtLCDy.setCursor(14,9);          // Clear junk in line, if any
+    VirtLCDy.print("      ");
     VirtLCDy.setCursor(10,9);
-    VirtLCDy.print("Ref:");
-    VirtLCDy.setCursor(14,9);
-    print_p_mw(ref_power_mw);
+    if (turn == 0)
+    {
+      VirtLCDy.print("Ref:");
+      print_p_mw(ref_power_mw);
+    }
+    else
+    {
+      VirtLCDy.print((turn == 1) ? "Med:" : "P99:");
+      sprintf(lcd_buf,"%4.2f", (turn == 1) ? swr_q[QWIN_LONG].p50 : swr_q[QWIN_LONG].p99);
+    }
     VirtLCDy.print(lcd_buf);
 
    //------------------------------------------
@@ -659,6 +671,179 @@ void lcd_display_modscope(void)
 }
 
 
+//
+//-----------------------------------------------------------------------------
+//  Display CW Keying waveform, most recent key down and worst seen
+//-----------------------------------------------------------------------------
+//
+void lcd_keying_row(uint8_t y, const char *label, double last, double worst)
+{
+  if (last  > 9999.99) last  = 9999.99;
+  if (worst > 9999.99) worst = 9999.99;
+  VirtLCDw.setCursor(0,y);
+  sprintf(lcd_buf,"%-6s%7.2f%7.2f", label, last, worst);
+  VirtLCDw.print(lcd_buf);
+}
+
+void lcd_display_keying(void)
+{
+  static uint16_t mode_timer = 0;     // Used to time the Display Mode intro
+  const keying_t &l = Keying.last();
+  const keying_t &w = Keying.worst();
+  
+  //------------------------------------------
+  // Display mode intro for a time
+  if(flag.mode_display)
+  {
+    if(flag.mode_change)
+    {
+      flag.mode_change = false;       // Clear display change mode
+      mode_timer = 0;                 // New mode, reset timer
+      lcd_display_mode_intro("Mode:"," ","CW Keying"," ");
+    }
+
+    mode_timer++;
+    if (mode_timer >= MODE_INTRO_TIME)// Done with Mode Intro. MODE_INTRO_TIME in 10ths of seconds
+    {
+      mode_timer = 0;
+      flag.mode_display = false;      // Clear display change mode
+      flag.idle_refresh = true;       // Force screensaver reprint upon exit, if screensaver mode
+      eraseDisplay();
+    }
+  }
+
+  //----------------------------------------------
+  // Display Keying if level is above useful threshold
+  #if AD8307_INSTALLED
+  else if ((power_mw > R.idle_disp_thresh) || (flag.power_detected))
+  #else  
+  else if ((power_mw > MIN_PWR_FOR_METER) || (flag.power_detected))
+  #endif
+  {
+    if (flag.screensaver_on)
+    {
+      flag.screensaver_on = false;
+      eraseDisplay();                 // Immediate blank slate to make room for text
+    }
+    
+    //------------------------------------------
+    // Key down count and the times, milliseconds
+    VirtLCDy.setCursor(0,0);
+    sprintf(lcd_buf,"CW Keying %9lu", (unsigned long) l.count);
+    VirtLCDy.print(lcd_buf);
+    VirtLCDy.setCursor(0,1);
+    VirtLCDy.print("ms       Last  Worst");
+    lcd_keying_row(2, "Rise",   l.rise_us/1000.0,   w.rise_us/1000.0);
+    lcd_keying_row(3, "Fall",   l.fall_us/1000.0,   w.fall_us/1000.0);
+    lcd_keying_row(4, "Full",   l.full_us/1000.0,   w.full_us/1000.0);
+    lcd_keying_row(5, "Length", l.length_us/1000.0, w.length_us/1000.0);
+
+    //------------------------------------------
+    // Overshoot and droop, dB
+    VirtLCDy.setCursor(0,6);
+    VirtLCDy.print("dB       Last  Worst");
+    lcd_keying_row(7, "Overs",  l.overshoot/100.0,  w.overshoot/100.0);
+    lcd_keying_row(8, "Droop",  l.droop/100.0,      w.droop/100.0);
+
+    //------------------------------------------
+    // Key down power
+    VirtLCDy.setCursor(10,9);         // Clear junk in line, if any
+    VirtLCDy.print("          ");
+    VirtLCDy.setCursor(0,9);
+    VirtLCDy.print("Key down  ");
+    print_p_mw(l.count ? fast_db_to_lin(l.level/100.0) : 0);
+    VirtLCDy.print(lcd_buf);
+  }
+  else                                // Screensaver display
+  {
+    VirtLCDlargeY.clear();
+    VirtLCDlargeR.clear();
+    screensaver();
+  }
+}
+
+
+//
+//-----------------------------------------------------------------------------
+//  Display Power Distribution, average, median and peak power, PAPR and CCDF
+//-----------------------------------------------------------------------------
+//
+void lcd_ccdf_row(uint8_t y, const char *label, int32_t db100, const char *unit)
+{
+  VirtLCDw.setCursor(0,y);
+  sprintf(lcd_buf,"%-9s%7.2f%-4s", label, db100/100.0, unit);
+  VirtLCDw.print(lcd_buf);
+}
+
+void lcd_display_ccdf(void)
+{
+  static uint16_t mode_timer = 0;     // Used to time the Display Mode intro
+  hist_t h;
+  
+  //------------------------------------------
+  // Display mode intro for a time
+  if(flag.mode_display)
+  {
+    if(flag.mode_change)
+    {
+      flag.mode_change = false;       // Clear display change mode
+      mode_timer = 0;                 // New mode, reset timer
+      lcd_display_mode_intro("Mode:"," ","Power Distribution"," ");
+    }
+
+    mode_timer++;
+    if (mode_timer >= MODE_INTRO_TIME)// Done with Mode Intro. MODE_INTRO_TIME in 10ths of seconds
+    {
+      mode_timer = 0;
+      flag.mode_display = false;      // Clear display change mode
+      flag.idle_refresh = true;       // Force screensaver reprint upon exit, if screensaver mode
+      eraseDisplay();
+    }
+  }
+
+  //----------------------------------------------
+  // Display Distribution if level is above useful threshold
+  #if AD8307_INSTALLED
+  else if ((power_mw > R.idle_disp_thresh) || (flag.power_detected))
+  #else  
+  else if ((power_mw > MIN_PWR_FOR_METER) || (flag.power_detected))
+  #endif
+  {
+    if (flag.screensaver_on)
+    {
+      flag.screensaver_on = false;
+      eraseDisplay();                 // Immediate blank slate to make room for text
+    }
+    
+    Hist.summary(h);
+
+    //------------------------------------------
+    // Average, median and peak power
+    VirtLCDy.setCursor(0,0);
+    VirtLCDy.print("Power Distribution");
+    lcd_ccdf_row(1, "Average", h.avg,  "dBm");
+    lcd_ccdf_row(2, "Median",  h.p[0], "dBm");
+    lcd_ccdf_row(3, "Peak",    h.peak, "dBm");
+    lcd_ccdf_row(4, "PAPR",    h.peak - h.avg, "dB");
+
+    //------------------------------------------
+    // CCDF, dB above average power exceeded 10%, 1%, 0.1% and 0.01% of the time
+    VirtLCDy.setCursor(0,5);
+    VirtLCDy.print("CCDF   dB above Avg");
+    lcd_ccdf_row(6, "10%",     h.p[1] - h.avg, "dB");
+    lcd_ccdf_row(7, "1%",      h.p[2] - h.avg, "dB");
+    lcd_ccdf_row(8, "0.1%",    h.p[3] - h.avg, "dB");
+    lcd_ccdf_row(9, "0.01%",   h.p[4] - h.avg, "dB");
+  }
+  else                                // Screensaver display
+  {
+    VirtLCDlargeY.clear();
+    VirtLCDlargeR.clear();
+    screensaver();
+  }
+}
+
+
 //
 //-----------------------------------------------------------------------------
 //  Display Config and measured input voltages etc...
@@ -743,6 +928,7 @@ void lcd_display_debug(void)
 //-----------------------------------------------------------------------------
 //
 bool dbg2init = false;                // Firs time init indicator
+bool dbg2dropped = false;             // SAMPLES DROPPED shown on screen
 
 void lcd_display_debug2(void)
 {
@@ -793,6 +979,14 @@ void lcd_display_debug2(void)
   swr_alm = R.SWR_alarm_trig/10.0;                                             // Set colour changeover points for swr mid and swr alarm
   if (swr_alm < swr_mid) swr_mid = swr_alm;
   SWR.graph(swr_mid, swr_alm, swr);
+
+  //------------------------------------------
+  // Samples lost by the sampler interrupt, see isrmon_check()
+  if (flag.samples_dropped != dbg2dropped)
+  {
+    dbg2dropped = flag.samples_dropped;
+    lcd_display_debug2_dropped(dbg2dropped ? ILI9341_RED : ILI9341_BLACK);
+  }
 }
 //------------------------------------------
 void lcd_display_debug_erase(void)
@@ -802,6 +996,8 @@ void lcd_display_debug_erase(void)
   eraseTouchButtons();
   #endif
   lcd_display_debug2_text(ILI9341_BLACK);                                      // Erase text
+  if (dbg2dropped) lcd_display_debug2_dropped(ILI9341_BLACK);
+  dbg2dropped = false;
   Meter1.erase();
   Meter2.erase();
   Meter3.erase();
@@ -837,3 +1033,11 @@ void lcd_display_debug2_text(int16_t textcolour)
   tft.setCursor( 0, 174);
   tft.print("1s");  
 }
+//------------------------------------------
+void lcd_display_debug2_dropped(int16_t textcolour)
+{
+  tft.setFont(Arial_8); 
+  tft.setTextColor(textcolour);
+  tft.setCursor(25, 226);
+  tft.print("SAMPLES DROPPED");
+}
@@ -0,0 +1,156 @@
+//*********************************************************************************
+//**
+//** Power distribution, a log binned histogram of the instantaneous power.
+//**
+//** Each sample adds to one HIST_BIN wide bin (0.25 dB), found from its dBm x 100
+//** value by one integer division, O(1) per sample.  Levels below or above the
+//** range go to the lowest or highest bin.  Counts are 32.32 fixed point, HIST_ONE
+//** per sample, so that old samples can be faded out by decay(), once per 100ms,
+//** which scales every count by the same factor, hist_keep(), 0.32 fixed point:
+//**
+//**   keep = 2^32 x exp(-0.1s / time constant),  or HIST_HOLD to hold until cleared
+//**
+//** The 32 fractional bits are needed for a count to decay at the rate set by the
+//** time constant, up to an hour, a single sample of a count with only 8 fractional
+//** bits would lose its last bit every step and halve in 12.8s whatever the time
+//** constant.  When held, all counts are halved before they could overflow, the
+//** shape of the distribution is not affected.
+//**
+//** From the histogram, on demand, summary() derives the linear average power,
+//** the peak power, PAPR (peak to average power ratio, crest factor squared) and
+//** percentile power.  The power which is exceeded a fraction q of the time is
+//** the (1 - q) percentile, hence the CCDF in dB above average power, at 10%,
+//** 1%, 0.1% and 0.01%, is the P90, P99, P99.9 and P99.99 less the average.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRhistogram_h_
+#define _PSWRhistogram_h_
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "PSWRfastmath.h"
+
+#define HIST_BIN                25      // Bin width, dB x 100
+#define HIST_DB_MIN          -3000      // Lower edge of the lowest bin, dBm x 100
+#define HIST_BINS              400      // -30 dBm to +70 dBm
+#define HIST_ONE       (1ULL << 32)     // Count of one sample
+#define HIST_HOLD      (1ULL << 32)     // decay() factor to hold the counts
+#define HIST_QUANTILES           6      // P50, P90, P99, P99.9, P99.99 and P99.999
+
+typedef struct {
+          float    samples;             // Samples counted, after decay
+          int32_t  avg;                 // Linear average power, dBm x 100
+          int32_t  peak;                // Upper edge of the highest bin used, dBm x 100
+          int32_t  p[HIST_QUANTILES];   // Percentile power, dBm x 100
+               }  hist_t;
+
+// decay() factor for a time constant in seconds, once per 100ms, 0 to hold
+static inline uint64_t hist_keep(uint16_t tc)
+{
+  return tc ? (uint64_t) llround(4294967296.0 * exp(-0.1 / tc)) : HIST_HOLD;
+}
+
+class PowerHistogram
+{
+  public:
+    //------------------------------------------------------------------------------
+    void clear(void)
+    {
+      memset(bin, 0, sizeof(bin));
+      total = 0;
+    }
+    //------------------------------------------------------------------------------
+    // Add one sample, dBm x 100
+    void add(int32_t db)
+    {
+      int32_t b = (db - HIST_DB_MIN) / HIST_BIN;
+
+      if (b < 0) b = 0;
+      else if (b >= HIST_BINS) b = HIST_BINS - 1;
+      bin[b] += HIST_ONE;
+      total += HIST_ONE;
+    }
+    //------------------------------------------------------------------------------
+    // Scale every count by keep/2^32, the product in two halves, as a count
+    // times keep does not fit 64 bits
+    void decay(uint64_t keep)
+    {
+      uint64_t sum = 0;
+
+      if (total >= (1ULL << 63)) keep /= 2;           // Would overflow, halve
+      if (keep >= HIST_HOLD) return;
+      for (uint16_t b = 0; b < HIST_BINS; b++)
+      {
+        if (bin[b] == 0) continue;
+        bin[b] = (bin[b] >> 32) * keep + (((bin[b] & 0xffffffffUL) * keep) >> 32);
+        sum += bin[b];
+      }
+      total = sum;
+    }
+    //------------------------------------------------------------------------------
+    // Count of bin b, and the lower edge of the bin in dBm x 100
+    uint64_t count(uint16_t b)   { return bin[b]; }
+    int32_t  level(uint16_t b)   { return HIST_DB_MIN + b * HIST_BIN; }
+    uint64_t counted(void)       { return total; }
+    //------------------------------------------------------------------------------
+    // Average, peak and percentile power, O(HIST_BINS)
+    void summary(hist_t &s)
+    {
+      static const float q[HIST_QUANTILES] = { 0.5, 0.9, 0.99, 0.999, 0.9999, 0.99999 };
+      float    lin = 0, target, cum = 0;
+      uint16_t b, k = 0;
+
+      s.samples = (float) total / HIST_ONE;
+      s.avg  = HIST_DB_MIN;
+      s.peak = HIST_DB_MIN;
+      for (k = 0; k < HIST_QUANTILES; k++) s.p[k] = HIST_DB_MIN;
+      if (total == 0) return;
+
+      // Linear average, each bin at its centre, and the highest bin used
+      for (b = 0; b < HIST_BINS; b++)
+      {
+        if (bin[b] == 0) continue;
+        lin += bin[b] * fast_db_to_lin((level(b) + HIST_BIN/2) / 100.0f);
+        s.peak = level(b) + HIST_BIN;
+      }
+      s.avg = lroundf(100 * fast_lin_to_db(lin / total));
+
+      // Percentiles, interpolated within the bin where the cumulative count passes
+      k = 0;
+      target = q[0] * total;
+      for (b = 0; (b < HIST_BINS) && (k < HIST_QUANTILES); b++)
+      {
+        while ((k < HIST_QUANTILES) && (bin[b] > 0) && (cum + bin[b] >= target))
+        {
+          s.p[k] = level(b) + lroundf(HIST_BIN * (target - cum) / bin[b]);
+          if (++k < HIST_QUANTILES) target = q[k] * total;
+        }
+        cum += bin[b];
+      }
+    }
+
+  private:
+    uint64_t bin[HIST_BINS];            // Counts, HIST_ONE per sample
+    uint64_t total;                     // Sum of all counts
+};
+
+#endif
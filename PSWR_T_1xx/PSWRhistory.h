@@ -0,0 +1,153 @@
+//*********************************************************************************
+//**
+//** Multi resolution history, a round robin database of power and SWR.
+//**
+//** Three tiers of slots, 100ms, 1s and 1 minute.  Each slot holds the lowest,
+//** average and highest power and the highest SWR, four bytes:
+//**
+//**   power   0 for -30 dBm or less, else 1 + (dBm + 30) x 2, 0.5 dB steps, up
+//**           to 254 (+96.5 dBm)
+//**   SWR     0 if no meaningful SWR, else 1 + 250 x log10(SWR), up to 254
+//**
+//** The 100ms tier is fed once per 100ms.  The coarser tiers are aggregated from
+//** the finer ones as each slot completes, lowest of the lowest, highest of the
+//** highest and the average of the averages, as linear power.  Aggregates are
+//** kept unencoded until their slot completes, hence no loss of resolution on
+//** the way up.  O(1) per 100ms, nothing per sample.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRhistory_h_
+#define _PSWRhistory_h_
+
+#include <stdint.h>
+#include <math.h>
+#include "PSWRfastmath.h"
+
+#define HISTORY_TIERS            3
+#define HISTORY_DBM_MIN        -30      // Lowest power held, dBm
+
+typedef struct {
+          uint8_t  min;                 // Lowest power, encoded
+          uint8_t  avg;                 // Average power
+          uint8_t  max;                 // Highest power
+          uint8_t  swr;                 // Highest SWR, encoded
+               }  hslot_t;
+
+template <uint16_t T0, uint16_t T1, uint16_t T2>
+class PowerHistory
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Slot length of each tier, milliseconds, and slots per slot of the next tier
+    static uint32_t slot_ms(uint8_t tier) { return (tier == 0) ? 100 : (tier == 1) ? 1000 : 60000; }
+    static uint8_t  ratio(uint8_t tier)   { return (tier == 0) ? 10 : 60; }
+    static uint16_t depth(uint8_t tier)   { return (tier == 0) ? T0 : (tier == 1) ? T1 : T2; }
+
+    //------------------------------------------------------------------------------
+    // Add one 100ms slot, power in dBm and mW, SWR 0 if none meaningful
+    void add(float min_db, float avg_mw, float max_db, float swr, uint32_t now)
+    {
+      acc_t a = { min_db, max_db, avg_mw, swr, 1 };
+      uint8_t t;
+
+      put(0, a, now);
+      for (t = 0; t < HISTORY_TIERS - 1; t++)   // Aggregate upwards, as slots complete
+      {
+        merge(acc[t], a);
+        if (acc[t].n < ratio(t)) break;
+        a = acc[t];
+        a.sum_mw /= a.n;
+        a.n = 1;
+        acc[t].n = 0;
+        put(t + 1, a, now);
+      }
+    }
+    //------------------------------------------------------------------------------
+    // Slots held in a tier, slot at age i (0 the most recent), and millis() when
+    // the most recent slot was completed
+    uint16_t count(uint8_t tier) { return (n[tier] < depth(tier)) ? n[tier] : depth(tier); }
+    const hslot_t &get(uint8_t tier, uint16_t i)
+    {
+      uint16_t d = depth(tier);
+      return slot(tier)[(w[tier] + d - 1 - i) % d];
+    }
+    uint32_t last_ms(uint8_t tier) { return t_ms[tier]; }
+
+    //------------------------------------------------------------------------------
+    // Decoding, dBm and SWR
+    static float dbm(uint8_t c) { return c ? HISTORY_DBM_MIN + (c - 1) / 2.0f : HISTORY_DBM_MIN; }
+    static float swr(uint8_t c) { return c ? fast_exp10((c - 1) / 250.0f) : 0; }
+
+  private:
+    typedef struct {
+              float    min, max;        // dBm
+              float    sum_mw;          // Sum of averages, mW
+              float    swr;             // Highest SWR, 0 if none
+              uint8_t  n;               // Slots aggregated
+                   }  acc_t;
+
+    static void merge(acc_t &a, const acc_t &b)
+    {
+      if ((a.n == 0) || (b.min < a.min)) a.min = b.min;
+      if ((a.n == 0) || (b.max > a.max)) a.max = b.max;
+      if ((a.n == 0) || (b.swr > a.swr)) a.swr = b.swr;
+      a.sum_mw = a.n ? a.sum_mw + b.sum_mw : b.sum_mw;
+      a.n++;
+    }
+
+    static uint8_t code_db(float db)
+    {
+      float c = 1 + (db - HISTORY_DBM_MIN) * 2;
+      return (c < 1) ? 0 : (c > 254) ? 254 : (uint8_t) (c + 0.5f);
+    }
+    static uint8_t code_swr(float s)
+    {
+      float c;
+      if (s < 1) return 0;
+      c = 1 + 250 * fast_log10(s);
+      return (c > 254) ? 254 : (uint8_t) (c + 0.5f);
+    }
+
+    hslot_t *slot(uint8_t tier) { return (tier == 0) ? s0 : (tier == 1) ? s1 : s2; }
+
+    void put(uint8_t tier, const acc_t &a, uint32_t now)
+    {
+      hslot_t *s = &slot(tier)[w[tier]];
+
+      s->min = code_db(a.min);
+      s->avg = code_db((a.sum_mw > 0) ? fast_lin_to_db(a.sum_mw) : HISTORY_DBM_MIN);
+      s->max = code_db(a.max);
+      s->swr = code_swr(a.swr);
+      if (++w[tier] >= depth(tier)) w[tier] = 0;
+      if (n[tier] < depth(tier)) n[tier]++;
+      t_ms[tier] = now;
+    }
+
+    acc_t    acc[HISTORY_TIERS - 1];    // Aggregates for the next tier up, in progress
+    uint16_t w[HISTORY_TIERS];          // Next write position of each tier
+    uint16_t n[HISTORY_TIERS];          // Slots held
+    uint32_t t_ms[HISTORY_TIERS];       // millis() of the most recent slot
+    hslot_t  s0[T0];                    // 100ms slots, round robin
+    hslot_t  s1[T1];                    // 1s slots
+    hslot_t  s2[T2];                    // 1 minute slots
+};
+
+#endif
@@ -0,0 +1,422 @@
+//*********************************************************************************
+//**
+//** Measurement kernel for the Power and SWR Meter, specialized at compile time
+//** by a Detector policy (2x AD8307 or Diode detectors) and a Coupler policy
+//** (20 to 1 or 30 to 1 Tandem Match).
+//**
+//** The policies are selected once, in PSWR_T.h, from AD8307_INSTALLED and
+//** TWENTYTOONE.  Only the selected kernel is ever instantiated, the constants
+//** are folded at compile time and there are no detector or coupler branches
+//** in the per sample functions.
+//**
+//** Included at the end of PSWR_T.h, as it depends on the user selections.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRkernel_h_
+#define _PSWRkernel_h_
+
+#include <stdint.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Sample rate limits.  The window lengths are derived at runtime, from the
+// selected sample rate, see pswr_window_init()
+constexpr uint32_t pswr_span_us(uint32_t n) { return n * (uint32_t) SAMPLE_TIMER_MIN; }
+
+static_assert(SAMPLE_TIMER >= SAMPLE_TIMER_MIN && SAMPLE_TIMER <= SAMPLE_TIMER_MAX, "SAMPLE_TIMER out of range");
+static_assert(100000/SAMPLE_TIMER_MAX >= 2*DECIM_TICKS, "Each decimated period has to hold at least 2 samples");
+static_assert(PEP_PERIOD >= 10 && PEP_PERIOD <= PEP_BUFFER, "PEP_PERIOD out of range");
+static_assert(PEP_BUFFER >= 50,               "PEP_BUFFER has to hold a 5s PEP period");
+static_assert(pswr_span_us(AD_RING_DEPTH) >= 10000UL * POLL_TIMER, "AD_RING_DEPTH has to ride out 10 POLL_TIMER periods");
+
+//-----------------------------------------------------------------------------
+// Instantaneous values, defined in PSWR_T_1xx.ino.  Those used by only one of
+// the detector types are defined only when that detector is selected.
+extern int16_t  fwd, rev;
+extern double   f_inst, r_inst;
+extern double   ad8307_FdBm, ad8307_RdBm;
+extern int16_t  ad8307_Fdb100, ad8307_Rdb100;
+extern uint16_t swr_log;
+extern double   fwd_power_mw, ref_power_mw, power_mw, power_db;
+extern bool     Reverse;
+
+//
+//-----------------------------------------------------------------------------
+// Coupler policies, calibration defaults and thresholds that depend on the
+// Tandem Match coupling factor
+//-----------------------------------------------------------------------------
+//
+struct Coupler20to1
+{
+  static constexpr int16_t cal1_nor_value       = 400;   // 40 dBm, default dBm level1 for both AD8307
+  static constexpr int16_t cal2_nor_value       = 100;   // 10 dBm, default dBm level2 for both AD8307
+  static constexpr double  calfwd1_default      = 2.452; // Default raw Voltage level1 at 40 dBm
+  static constexpr double  calrev1_default      = 2.452; // Default raw Voltage level1 at 40 dBm
+  static constexpr double  calfwd2_default      = 1.702; // Default raw Voltage level2 at 10 dBm
+  static constexpr double  calrev2_default      = 1.702; // Default raw Voltage level2 at 10 dBm
+  static constexpr double  min_pwr_for_swr_calc = 0.5;   // Minimum Power in mW for SWR calculation, AD8307
+};
+
+struct Coupler30to1
+{
+  static constexpr int16_t cal1_nor_value       = 400;   // 40 dBm, default dBm level1 for both AD8307
+  static constexpr int16_t cal2_nor_value       = 100;   // 10 dBm, default dBm level2 for both AD8307
+  static constexpr double  calfwd1_default      = 2.233; // Default raw Voltage level1 at 40 dBm
+  static constexpr double  calrev1_default      = 2.233; // Default raw Voltage level1 at 40 dBm
+  static constexpr double  calfwd2_default      = 1.528; // Default raw Voltage level2 at 10 dBm
+  static constexpr double  calrev2_default      = 1.528; // Default raw Voltage level2 at 10 dBm
+  static constexpr double  min_pwr_for_swr_calc = 1.0;   // Minimum Power in mW for SWR calculation, AD8307
+};
+
+template <bool TWENTY> struct CouplerSelect        { typedef Coupler30to1 type; };
+template <>            struct CouplerSelect<true>  { typedef Coupler20to1 type; };
+
+//
+//-----------------------------------------------------------------------------
+// Detector policies.  Each provides:
+//
+//   tables_t  lookup tables, 12 bit AD value to dBm x 100 or to Volts
+//   block_t   per block state, filled by decode() ahead of the per sample pass
+//   build()   build the tables from calibration values and ADC reference
+//   stale()   true if calibration values or ADC reference have changed
+//   decode()  convert a block of packed AD value pairs, if worthwhile
+//   power()   instantaneous values of sample x, returns Real Power in dB x 100
+//   swr()     SWR of the most recent sample
+//   ad_at()   lowest AD value at which the power in one direction reaches a level
+//   db100()   power of the higher direction of a pair, dB x 100
+//-----------------------------------------------------------------------------
+//
+
+//-----------------------------------------------------------------------------
+// 2x AD8307 Log Amp Detectors
+template <uint16_t BLOCK>
+struct DetectorAD8307
+{
+  static constexpr bool   log_detector         = true;
+  static constexpr double min_pwr_for_swr_calc = 0;      // Depends on the Coupler, see PswrKernel
+  static constexpr double min_pwr_for_swr_show = 0.01;   // Minimum Power in mW for SWR indication (use recent value)
+
+  typedef struct {
+            int16_t  fwd_db[4096];      // Forward dBm x 100 for each AD value
+            int16_t  rev_db[4096];      // Reverse dBm x 100 for each AD value
+            cal_t    cal[2];            // Calibration values used for the tables
+            double   adc_ref;           // ADC reference used for the tables, 0 if not built
+                 }  tables_t;
+
+  typedef struct {
+            uint32_t db[BLOCK];         // dB x 100 pairs, "forward" in lower 16 bits
+            uint8_t  reverse[BLOCK];    // Reverse flags
+                 }  block_t;
+
+  static void build(tables_t &t, const var_t &r, double adc_ref)
+  {
+    double  v;
+    double  delta_db;
+    double  delta_Fdb, delta_Rdb;
+    double  f_db, r_db;
+
+    // Calculate the slope gradient between the two calibration points:
+    //
+    // (dB_Cal1 - dB_Cal2)/(V_Cal1 - V_Cal2) = slope_gradient
+    //
+    delta_db = (double)((r.cal_AD[1].db10m - r.cal_AD[0].db10m)/10.0);
+    delta_Fdb = delta_db/(r.cal_AD[1].Fwd - r.cal_AD[0].Fwd);
+    delta_Rdb = delta_db/(r.cal_AD[1].Rev - r.cal_AD[0].Rev);
+
+    for (uint16_t x = 0; x < 4096; x++)
+    {
+      v = adc_ref * (x/4096.0);
+      // measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
+      f_db = (v - r.cal_AD[0].Fwd) * delta_Fdb + r.cal_AD[0].db10m/10.0;
+      r_db = (v - r.cal_AD[0].Rev) * delta_Rdb + r.cal_AD[0].db10m/10.0;
+      // Multiply by 100 and round to make suitable for integer value
+      t.fwd_db[x] = constrain(lround(100 * f_db), DB100_MIN, DB100_MAX);
+      t.rev_db[x] = constrain(lround(100 * r_db), DB100_MIN, DB100_MAX);
+    }
+    memcpy(t.cal, r.cal_AD, sizeof(t.cal));
+    t.adc_ref = adc_ref;
+  }
+
+  static bool stale(const tables_t &t, const var_t &r, double adc_ref)
+  {
+    return memcmp(t.cal, r.cal_AD, sizeof(t.cal)) || (t.adc_ref != adc_ref);
+  }
+
+  //-----------------------------------------------------------------------------
+  // In:  packed pairs of AD values, Forward in lower and Reverse in upper 16 bits
+  // Out: packed pairs of dB x 100, the higher power designated as "forward" in lower
+  //      and the other as "reverse" in upper 16 bits, and a Reverse flag for each pair
+  //
+  // On Cortex-M4 the DSP instructions bound both AD values of a pair in one instruction,
+  // and the pair is ordered without branches, based on a dual 16 bit subtraction.
+  static void decode(const tables_t &t, block_t &b, const uint32_t *ad, uint16_t n)
+  {
+    uint32_t pair;                              // AD values, then dB x 100 values
+    #if defined(__ARM_FEATURE_DSP)
+    uint32_t hi, lo;                            // Higher and lower of the pair
+    #else
+    int16_t  f, r;
+    #endif
+
+    for (uint16_t x = 0; x < n; x++)
+    {
+      #if defined(__ARM_FEATURE_DSP)
+      // Bound both AD values to 0 - 4095
+      asm ("usat16 %0, #12, %1" : "=r" (pair) : "r" (ad[x]));
+      // Look up dB values for the measured AD values, see build()
+      pair = (uint16_t) t.fwd_db[pair & 0xffff] | ((uint32_t) t.rev_db[pair >> 16] << 16);
+      // Test for direction of power - Always designate the higher power as "forward"
+      // while setting the "Reverse" flag on reverse condition.
+      b.reverse[x] = ((int16_t) pair <= (int16_t) (pair >> 16));
+      asm ("ror    %[lo], %[p], #16       \n\t" // Swapped pair
+           "ssub16 %[hi], %[p], %[lo]     \n\t" // GE flags set where pair >= swapped pair
+           "sel    %[hi], %[p], %[lo]     \n\t" // Higher value in both halves
+           "sel    %[lo], %[lo], %[p]     \n\t" // Lower value in both halves
+           : [hi] "=&r" (hi), [lo] "=&r" (lo) : [p] "r" (pair) : "cc");
+      b.db[x] = (hi & 0xffff) | (lo & 0xffff0000);
+      #else
+      // Look up dB values for the measured AD values, see build()
+      pair = ad[x];
+      f = t.fwd_db[constrain((int16_t) pair, 0, 4095)];
+      r = t.rev_db[constrain((int16_t) (pair >> 16), 0, 4095)];
+      // Test for direction of power - Always designate the higher power as "forward"
+      // while setting the "Reverse" flag on reverse condition.
+      if (f > r)                                // Forward direction
+      {
+        b.reverse[x] = false;
+        b.db[x] = (uint16_t) f | ((uint32_t) (uint16_t) r << 16);
+      }
+      else                                      // Reverse direction
+      {
+        b.reverse[x] = true;
+        b.db[x] = (uint16_t) r | ((uint32_t) (uint16_t) f << 16);
+      }
+      #endif
+    }
+  }
+
+  static inline int32_t power(const tables_t &, const block_t &b, uint16_t x)
+  {
+    rl_t    rl;                                 // SWR and Mismatch Loss
+    int32_t p_db;                               // Real Power Output in dB x 100
+
+    // dBm from AD8307 voltages have already been determined, see decode()
+    ad8307_Fdb100 = b.db[x];
+    ad8307_Rdb100 = b.db[x] >> 16;
+    Reverse = b.reverse[x];
+    ad8307_FdBm = ad8307_Fdb100 / 100.0;
+    ad8307_RdBm = ad8307_Rdb100 / 100.0;
+
+    // SWR and Mismatch Loss, both from the Return Loss
+    rl = rl_lookup(ad8307_Fdb100 - ad8307_Rdb100);
+    swr_log = rl.swr_log;
+
+    // Instantaneous forward and reverse power, milliwatts
+    // (current and resistance have already been factored in)
+    fwd_power_mw = db100_to_mw(ad8307_Fdb100);
+    ref_power_mw = db100_to_mw(ad8307_Rdb100);
+
+    // Instantaneous Real Power Output, which is the forward power less the Mismatch Loss
+    p_db = (int32_t) ad8307_Fdb100 - rl.ml;
+    power_db = p_db / 100.0;
+    power_mw = db100_to_mw(p_db);
+
+    // We need some sane boundaries (4kW) to determine reasonable variable defs for further calculations
+    if (fwd_power_mw > 4000000) fwd_power_mw = 4000000;
+    if (ref_power_mw > 4000000) ref_power_mw = 4000000;
+    if (power_mw > 4000000) power_mw = 4000000;
+
+    return p_db;
+  }
+
+  static inline double swr(void)
+  {
+    return db100_to_mw(swr_log);                // 10^(swr_log/1000), from most recent sample
+  }
+
+  static uint16_t ad_at(const tables_t &t, double mw, bool reverse)
+  {
+    const int16_t *db = reverse ? t.rev_db : t.fwd_db;
+    int32_t        level = lround(100 * fast_lin_to_db(mw));
+    uint16_t       x;
+
+    for (x = 0; (x < 4095) && (db[x] < level); x++) ;
+    return x;
+  }
+
+  static int16_t db100(const tables_t &t, uint32_t pair)
+  {
+    int16_t f = t.fwd_db[constrain((int16_t) pair, 0, 4095)];
+    int16_t r = t.rev_db[constrain((int16_t) (pair >> 16), 0, 4095)];
+
+    return (f > r) ? f : r;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Diode Detectors
+template <uint16_t BLOCK>
+struct DetectorDiode
+{
+  static constexpr bool   log_detector         = false;
+  static constexpr double min_pwr_for_swr_calc = 30;     // Minimum Power in mW for SWR calculation and display
+  static constexpr double min_pwr_for_swr_show = 30;     // Minimum Power in mW for SWR indication (use recent value)
+  static constexpr double vdrop                = D_VDROP;
+  static constexpr double coupling             = BRIDGE_COUPLING;
+
+  typedef struct {
+            float    volt[4096];        // Bridge VRMS for each AD value, both directions
+            uint8_t  meter_cal;         // Calibration value used for the table
+            double   adc_ref;           // ADC reference used for the table, 0 if not built
+                 }  tables_t;
+
+  typedef struct {
+                 }  block_t;            // Nothing, AD values are looked up per sample
+
+  static void build(tables_t &t, const var_t &r, double adc_ref)
+  {
+    double v;
+
+    for (uint16_t x = 0; x < 4096; x++)
+    {
+      // Establish actual measured voltage at diode
+      v = x * adc_ref/4096.0;
+      // Convert to VRMS in Bridge
+      if (v >= vdrop) v = 1/1.4142135 * (v - vdrop) + vdrop;
+      // Take Bridge Coupling into account
+      t.volt[x] = v * coupling * r.meter_cal/100.0;
+    }
+    t.meter_cal = r.meter_cal;
+    t.adc_ref = adc_ref;
+  }
+
+  static bool stale(const tables_t &t, const var_t &r, double adc_ref)
+  {
+    return (t.meter_cal != r.meter_cal) || (t.adc_ref != adc_ref);
+  }
+
+  static inline void decode(const tables_t &, block_t &, const uint32_t *, uint16_t)
+  {
+  }
+
+  static inline int32_t power(const tables_t &t, const block_t &, uint16_t)
+  {
+    // Test for direction of power - Always designate the higher power as "forward"
+    // while setting the "Reverse" flag on reverse condition.
+    if (fwd > rev)                              // Forward direction
+    {
+      Reverse = false;
+    }
+    else                                        // Reverse direction
+    {
+      int16_t temp = rev;
+      rev = fwd;
+      fwd = temp;
+      Reverse = true;
+    }
+
+    // Instantaneous forward voltage and power, milliwatts
+    //
+    // Look up VRMS in Bridge for the measured AD value, see build()
+    f_inst = t.volt[constrain(fwd, 0, 4095)];
+    // Convert into milliwatts
+    fwd_power_mw = 1000 * SQR(f_inst)/50.0;
+
+    // Instantaneous reflected voltage and power
+    r_inst = t.volt[constrain(rev, 0, 4095)];
+    // Convert into milliwatts
+    ref_power_mw = 1000 * SQR(r_inst)/50.0;
+
+    // Instantaneous Real Power Output
+    power_mw = fwd_power_mw - ref_power_mw;
+    if (power_mw <  0) power_mw = power_mw * -1;
+    power_db = fast_lin_to_db(power_mw);
+    return 100 * power_db;                      // Multiply by 100 to make suitable for integer value
+  }
+
+  static inline double swr(void)
+  {
+    return (1+(r_inst/f_inst))/(1-(r_inst/f_inst));
+  }
+
+  static uint16_t ad_at(const tables_t &t, double mw, bool)
+  {
+    uint16_t x;
+
+    for (x = 0; (x < 4095) && (1000 * SQR(t.volt[x])/50.0 < mw); x++) ;
+    return x;
+  }
+
+  static int16_t db100(const tables_t &t, uint32_t pair)
+  {
+    float f = t.volt[constrain((int16_t) pair, 0, 4095)];
+    float r = t.volt[constrain((int16_t) (pair >> 16), 0, 4095)];
+
+    if (r > f) f = r;
+    return constrain(lround(100 * fast_lin_to_db(1000 * SQR(f)/50.0)), DB100_MIN, DB100_MAX);
+  }
+};
+
+template <bool AD8307, uint16_t BLOCK> struct DetectorSelect              { typedef DetectorDiode<BLOCK>  type; };
+template <uint16_t BLOCK>              struct DetectorSelect<true, BLOCK> { typedef DetectorAD8307<BLOCK> type; };
+
+//
+//-----------------------------------------------------------------------------
+// The kernel, lookup tables and block state for one Detector and Coupler
+//-----------------------------------------------------------------------------
+//
+template <class DETECTOR, class COUPLER>
+class PswrKernel
+{
+  public:
+    typedef DETECTOR detector;
+    typedef COUPLER  coupler;
+
+    static constexpr double min_pwr_for_swr_calc = detector::log_detector ? coupler::min_pwr_for_swr_calc
+                                                                         : detector::min_pwr_for_swr_calc;
+    static constexpr double min_pwr_for_swr_show = detector::min_pwr_for_swr_show;
+
+    //------------------------------------------------------------------------------
+    // Rebuild the lookup tables if calibration or ADC reference has changed
+    void check(const var_t &r, double adc_ref)
+    {
+      if (detector::stale(tab, r, adc_ref)) detector::build(tab, r, adc_ref);
+    }
+    //------------------------------------------------------------------------------
+    // Prepare a block of packed AD value pairs, then fetch the instantaneous
+    // values for each of its samples, returns Real Power in dB x 100
+    void    decode(const uint32_t *ad, uint16_t n) { detector::decode(tab, blk, ad, n); }
+    int32_t power(uint16_t x)                      { return detector::power(tab, blk, x); }
+    double  swr(void)                              { return detector::swr(); }
+    //------------------------------------------------------------------------------
+    // Lowest AD value at which Forward or Reverse power reaches mw milliwatts
+    uint16_t ad_at(double mw, bool reverse)        { return detector::ad_at(tab, mw, reverse); }
+    //------------------------------------------------------------------------------
+    // Power of the higher direction of a packed AD value pair in dBm x 100, without
+    // touching the instantaneous values, for analysis of the $burst capture buffer
+    int16_t  db100(uint32_t pair)                  { return detector::db100(tab, pair); }
+
+  private:
+    typename detector::tables_t tab;    // Lookup tables, zeroed hence stale until built
+    typename detector::block_t  blk;    // Current block
+};
+
+#endif
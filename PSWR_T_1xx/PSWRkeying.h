@@ -0,0 +1,288 @@
+//*********************************************************************************
+//**
+//** CW keying waveform analyzer.
+//**
+//** Fed with one power value (dBm x 100) per sample, the analyzer finds key down
+//** events, power above a threshold with some hysteresis, and measures for each:
+//**
+//**   rise and fall time     10% to 90% of the key down amplitude (RF voltage), that
+//**                          is -20 dB to -0.92 dB relative to the key down power
+//**   time to full power     from 10% amplitude to within 0.2 dB of key down power
+//**   overshoot              peak power above key down power
+//**   droop                  key down power at start, once at full power, less key
+//**                          down power at end, as far ahead of the fall as the start
+//**                          is after the rise, KEY_AVG samples each
+//**
+//** The key down power is the average of the middle part, if the key down is long
+//** enough, else the average of the samples within 3 dB of the peak.  Crossings
+//** are interpolated between samples.
+//**
+//** Memory is fixed.  The start (including some samples from before key down) and
+//** the end (including some samples after key up) of each key down are kept, the
+//** middle part only contributes to a running sum.  Work per sample is O(1), and
+//** the analysis at key up is bounded by the size of the kept parts.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRkeying_h_
+#define _PSWRkeying_h_
+
+#include <stdint.h>
+#include <string.h>
+
+#define KEY_PRE                 16      // Samples kept from before key down and after key up, power of two
+#define KEY_KEEP               256      // Samples kept from start and from end of key down, power of two
+#define KEY_AVG                 16      // Samples averaged for droop, and least for a middle part
+#define KEY_HYST               300      // Key up hysteresis, dB x 100
+#define KEY_DB_10PCT          2000      // 10% amplitude, dB x 100 below key down power
+#define KEY_DB_90PCT            92      // 90% amplitude
+#define KEY_DB_FULL             20      // Full power
+
+typedef struct {
+          uint32_t count;               // Key down events analyzed
+          uint32_t length_us;           // Key down duration, 10% rise to 10% fall
+          uint32_t rise_us;             // 10% to 90% amplitude, 0 if not found
+          uint32_t fall_us;             // 90% to 10% amplitude, 0 if not found
+          uint32_t full_us;             // 10% amplitude to full power, 0 if not found
+          int16_t  level;               // Key down power, dBm x 100
+          int16_t  overshoot;           // Peak above key down power, dB x 100
+          int16_t  droop;               // Key down power, start less end, dB x 100
+               }  keying_t;
+
+class KeyingAnalyzer
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Forget everything, and set the sample period
+    void init(uint32_t period_us)
+    {
+      memset(this, 0, sizeof(*this));
+      period = period_us;
+      on_db = -3000;
+    }
+    //------------------------------------------------------------------------------
+    // Key down threshold, dBm x 100
+    void threshold(int16_t db) { on_db = db; }
+    //------------------------------------------------------------------------------
+    // Add the newest sample, dBm x 100
+    void add(int16_t db)
+    {
+      if (state == IDLE)
+      {
+        pre_add(db);
+        if (db >= on_db) start(db);
+      }
+      else if (state == DOWN)
+      {
+        put(db);
+        if (db > peak) peak = db;
+        if (db < on_db - KEY_HYST)
+        {
+          state = TRAIL;
+          trail = 0;
+        }
+      }
+      else                              // TRAIL, some samples after key up
+      {
+        put(db);
+        pre_add(db);                    // Also history for the next key down
+        if (++trail >= KEY_PRE)
+        {
+          analyze();
+          state = IDLE;
+        }
+      }
+    }
+    //------------------------------------------------------------------------------
+    // Results of the most recent key down, and the worst seen of each
+    const keying_t &last(void)  { return res; }
+    const keying_t &worst(void) { return wst; }
+    void reset(void) { init(period); }
+    //------------------------------------------------------------------------------
+    // End of input, analyze a key down still in progress, if any
+    void flush(void)
+    {
+      if (state != IDLE) analyze();
+      state = IDLE;
+    }
+
+  private:
+    enum { IDLE, DOWN, TRAIL };
+
+    void pre_add(int16_t db)
+    {
+      pre[pre_w++ & (KEY_PRE - 1)] = db;
+      if (pre_n < KEY_PRE) pre_n++;
+    }
+
+    void start(int16_t db)
+    {
+      n = 0;
+      mid_n = 0;
+      mid_sum = 0;
+      for (uint8_t i = pre_n; i > 0; i--) put(pre[(pre_w - i) & (KEY_PRE - 1)]);
+      pre_n = 0;
+      peak = db;
+      state = DOWN;
+    }
+
+    void put(int16_t db)
+    {
+      if (n < KEY_KEEP) head[n] = db;
+      else
+      {
+        int16_t *t = &tail[(n - KEY_KEEP) & (KEY_KEEP - 1)];
+        if (n >= 2 * KEY_KEEP)                  // Oldest of the end part, now in the middle part
+        {
+          mid_sum += *t;
+          mid_n++;
+        }
+        *t = db;
+      }
+      n++;
+    }
+
+    int16_t at(uint32_t i)              // Only valid within the kept parts
+    {
+      return (i < KEY_KEEP) ? head[i] : tail[(i - KEY_KEEP) & (KEY_KEEP - 1)];
+    }
+
+    // Sample time, in samples, where the straight line between samples i and i+1 crosses db
+    float cross(uint32_t i, int16_t db)
+    {
+      int16_t a = at(i), b = at(i + 1);
+      float   f = (a == b) ? 0 : (float) (db - a) / (b - a);
+      if (f < 0) f = 0;
+      if (f > 1) f = 1;
+      return i + f;
+    }
+
+    int32_t sum(uint32_t from, uint32_t to)
+    {
+      int32_t s = 0;
+      for (; from < to; from++) s += at(from);
+      return s;
+    }
+
+    uint32_t us(float samples) { return (samples > 0) ? (uint32_t) (samples * period + 0.5) : 0; }
+
+    void analyze(void)
+    {
+      uint32_t h  = (n < KEY_KEEP) ? n : KEY_KEEP;            // Start part, [0, h)
+      uint32_t lo = (n <= 2 * KEY_KEEP) ? 0 : n - KEY_KEEP;   // End part, [lo, n)
+      uint32_t i, j, full = 0, settle = 0;
+      int32_t  s = 0, cnt = 0;
+      int16_t  level, l10, l90, lfull;
+      float    t10 = 0, t90, f90, f10;
+
+      //----------------------------------------------------------------------------
+      // Key down power
+      if (mid_n >= KEY_AVG) level = mid_sum / (int32_t) mid_n;
+      else
+      {
+        for (i = 0; i < h; i++)
+          if (at(i) >= peak - 300) { s += at(i); cnt++; }
+        for (i = (lo > h) ? lo : h; i < n; i++)
+          if (at(i) >= peak - 300) { s += at(i); cnt++; }
+        level = cnt ? s / cnt : peak;
+      }
+      l10   = level - KEY_DB_10PCT;
+      l90   = level - KEY_DB_90PCT;
+      lfull = level - KEY_DB_FULL;
+
+      res.level     = level;
+      res.overshoot = (peak > level) ? peak - level : 0;
+      res.droop     = 0;
+
+      //----------------------------------------------------------------------------
+      // Rise, first 90% crossing in the start part, and the 10% crossing before it
+      res.rise_us = 0;
+      res.full_us = 0;
+      for (i = 0; (i < h) && (at(i) < l90); i++) ;
+      if ((i > 0) && (i < h))
+      {
+        t90 = cross(i - 1, l90);
+        for (j = i; (j > 0) && (at(j - 1) >= l10); j--) ;
+        if (j > 0)
+        {
+          t10 = cross(j - 1, l10);
+          res.rise_us = us(t90 - t10);
+        }
+        for (settle = i; (i < h) && (at(i) < lfull); i++) ;
+        if (i < h)
+        {
+          full = i;
+          settle = i - settle;                  // Samples from 90% amplitude to full power
+          if (j > 0) res.full_us = us(cross(i - 1, lfull) - t10);
+        }
+      }
+
+      //----------------------------------------------------------------------------
+      // Fall, last 90% crossing in the end part, and the 10% crossing after it
+      res.fall_us = 0;
+      res.length_us = 0;
+      for (i = n; (i > lo) && (at(i - 1) < l90); i--) ;
+      if ((i > lo) && (i < n))
+      {
+        f90 = cross(i - 1, l90);
+        for (j = i; (j < n) && (at(j) >= l10); j++) ;
+        if (j < n)
+        {
+          f10 = cross(j - 1, l10);
+          res.fall_us = us(f10 - f90);
+          if (t10 > 0) res.length_us = us(f10 - t10);
+        }
+        // Droop, from full power to the fall, if the two do not overlap.  The end
+        // part ends as far ahead of the 90% fall crossing as full power was reached
+        // after the 90% rise crossing, so neither average takes in the ramps
+        if ((full > 0) && (i >= settle)) i -= settle;
+        if ((full > 0) && (full + KEY_AVG <= h) && (i >= lo + KEY_AVG) && (full + KEY_AVG <= i - KEY_AVG))
+          res.droop = (sum(full, full + KEY_AVG) - sum(i - KEY_AVG, i)) / KEY_AVG;
+      }
+
+      //----------------------------------------------------------------------------
+      res.count++;
+      wst.count = res.count;
+      wst.level = res.level;
+      if (res.length_us > wst.length_us) wst.length_us = res.length_us;
+      if (res.rise_us   > wst.rise_us)   wst.rise_us   = res.rise_us;
+      if (res.fall_us   > wst.fall_us)   wst.fall_us   = res.fall_us;
+      if (res.full_us   > wst.full_us)   wst.full_us   = res.full_us;
+      if (res.overshoot > wst.overshoot) wst.overshoot = res.overshoot;
+      if (res.droop     > wst.droop)     wst.droop     = res.droop;
+    }
+
+    uint8_t  state;
+    uint32_t period;                    // Sample period, microseconds
+    int16_t  on_db;                     // Key down threshold, dBm x 100
+    int16_t  pre[KEY_PRE];              // History before key down
+    uint8_t  pre_w, pre_n;
+    uint8_t  trail;                     // Samples after key up
+    int16_t  head[KEY_KEEP];            // Start of key down, including history before
+    int16_t  tail[KEY_KEEP];            // End of key down, including samples after, round robin
+    uint32_t n;                         // Samples in this key down, including history
+    int16_t  peak;                      // Highest power within key down
+    int64_t  mid_sum;                   // Middle part, sum and count
+    uint32_t mid_n;
+    keying_t res;                       // Most recent results
+    keying_t wst;                       // Worst results
+};
+
+#endif
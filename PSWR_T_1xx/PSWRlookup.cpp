@@ -0,0 +1,94 @@
+//*********************************************************************************
+//**
+//** Lookup helpers for the Power and SWR Meter measurement functions.
+//**
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#include "PSWRlookup.h"
+#include "_RLtable.h"
+
+//
+//-----------------------------------------------------------------------------------------
+//      Constant tables: 10^(i/100) for 0.1 dB steps, 10^(i/1000) for 0.01 dB steps
+//      and 10^n for each 10 dB decade from DB100_MIN to DB100_MAX
+//-----------------------------------------------------------------------------------------
+//
+static const float exp10_coarse[100] = {
+  1.0000000, 1.0232930, 1.0471285, 1.0715193, 1.0964782,
+  1.1220185, 1.1481536, 1.1748976, 1.2022644, 1.2302688,
+  1.2589254, 1.2882496, 1.3182567, 1.3489629, 1.3803843,
+  1.4125375, 1.4454398, 1.4791084, 1.5135612, 1.5488166,
+  1.5848932, 1.6218101, 1.6595869, 1.6982437, 1.7378008,
+  1.7782794, 1.8197009, 1.8620871, 1.9054607, 1.9498446,
+  1.9952623, 2.0417379, 2.0892961, 2.1379621, 2.1877616,
+  2.2387211, 2.2908677, 2.3442288, 2.3988329, 2.4547089,
+  2.5118864, 2.5703958, 2.6302680, 2.6915348, 2.7542287,
+  2.8183829, 2.8840315, 2.9512092, 3.0199517, 3.0902954,
+  3.1622777, 3.2359366, 3.3113112, 3.3884416, 3.4673685,
+  3.5481339, 3.6307805, 3.7153523, 3.8018940, 3.8904514,
+  3.9810717, 4.0738028, 4.1686938, 4.2657952, 4.3651583,
+  4.4668359, 4.5708819, 4.6773514, 4.7863009, 4.8977882,
+  5.0118723, 5.1286138, 5.2480746, 5.3703180, 5.4954087,
+  5.6234133, 5.7543994, 5.8884366, 6.0255959, 6.1659500,
+  6.3095734, 6.4565423, 6.6069345, 6.7608298, 6.9183097,
+  7.0794578, 7.2443596, 7.4131024, 7.5857758, 7.7624712,
+  7.9432823, 8.1283052, 8.3176377, 8.5113804, 8.7096359,
+  8.9125094, 9.1201084, 9.3325430, 9.5499259, 9.7723722
+};
+
+static const float exp10_fine[10] = {
+  1.0000000, 1.0023052, 1.0046158, 1.0069317, 1.0092529,
+  1.0115795, 1.0139114, 1.0162487, 1.0185914, 1.0209395
+};
+
+static const float exp10_decade[(DB100_MAX - DB100_MIN + 1)/1000] = {
+  1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+  1e0,   1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9
+};
+
+//
+//-----------------------------------------------------------------------------------------
+//      Convert dBm x 100 into milliwatts:  mW = 10^(dBm/10)
+//-----------------------------------------------------------------------------------------
+//
+float db100_to_mw(int32_t db100)
+{
+  uint16_t i;
+
+  if (db100 < DB100_MIN) db100 = DB100_MIN;
+  if (db100 > DB100_MAX) db100 = DB100_MAX;
+  i = db100 - DB100_MIN;                        // 0 to 19999, 0.01 dB steps
+
+  return exp10_decade[i/1000] * exp10_coarse[(i%1000)/10] * exp10_fine[i%10];
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Look up SWR and Mismatch Loss from Return Loss (Forward dB less Reflected dB)
+//-----------------------------------------------------------------------------------------
+//
+rl_t rl_lookup(int32_t rl100)
+{
+  if (rl100 < 0)         rl100 = 0;
+  if (rl100 > RL100_MAX) rl100 = RL100_MAX;
+
+  return rl_table[rl100];
+}
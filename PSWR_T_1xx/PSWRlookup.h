@@ -0,0 +1,51 @@
+//*********************************************************************************
+//**
+//** Lookup helpers for the Power and SWR Meter measurement functions.
+//** Conversion from dBm x 100 to milliwatts without the use of pow(), using
+//** a constant 0.1 dB table, a 0.01 dB table and a table of decades.
+//**
+//** SWR and Mismatch Loss from Return Loss, using a generated table of
+//** Return Loss in 0.01 dB steps (_RLtable.h).
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRlookup_h_
+#define _PSWRlookup_h_
+
+#include <stdint.h>
+
+#define DB100_MIN   -10000              // Lowest dBm x 100 covered by the tables, -100 dBm
+#define DB100_MAX     9999              // Highest dBm x 100 covered by the tables, +99.99 dBm
+#define RL100_MAX     6000              // Return Loss table covers 0 to 60 dB, 0.01 dB steps
+
+typedef struct {
+          uint16_t swr_log;             // 1000 x log10(SWR), 65535 if infinite
+          uint16_t ml;                  // Mismatch Loss in dB x 100, 65535 if infinite
+               }  rl_t;
+
+//------------------------------------------------------------------------------
+// dBm x 100 to milliwatts, input is bounded by DB100_MIN and DB100_MAX
+extern float db100_to_mw(int32_t);
+//------------------------------------------------------------------------------
+// Return Loss in dB x 100 to SWR and Mismatch Loss, input is bounded by 0 and
+// RL100_MAX.  SWR is 10^(swr_log/1000), which is the same as db100_to_mw(swr_log)
+extern rl_t  rl_lookup(int32_t);
+
+#endif
@@ -122,8 +122,10 @@ uint8_t I2C_Init(void)
 //                                  or alternately
 //              use built-in 12 bit A/D converters if I2C device not present
 //                 This function is called from the Interrupt function, and
-//              reads the A/D inputs and transfers them to two circular buffers
+//              reads the A/D inputs and feeds them to the ring buffer
 //-----------------------------------------------------------------------------------------
+acq_feed_t hw_feed;                           // Feed function of the active hardware backend
+
 void adc_poll_and_feed_circular(void)
 {
   #if WIRE_ENABLED  
@@ -151,9 +153,8 @@ void adc_poll_and_feed_circular(void)
     //
     adc_in[(read_B[0] >> 4) & 0x03] = (read_B[0] & 0x0f) * 0x100 + read_B[1];
     adc_in[(read_B[2] >> 4) & 0x03] = (read_B[2] & 0x0f) * 0x100 + read_B[3];
-    measure.fwd[measure.incount] = adc_in[0]; // Input from AD7991 is 12 bit resolution
-    measure.rev[measure.incount] = adc_in[1]; // contained in bit positions 0 to 11.
-    measure.incount++;                        // 8 bit value, rolls over at 256
+    // Input from AD7991 is 12 bit resolution contained in bit positions 0 to 11.
+    hw_feed(adc_in[0] | ((uint32_t) adc_in[1] << 16));
   }
   else
   #endif
@@ -164,49 +165,434 @@ void adc_poll_and_feed_circular(void)
     result = adc->analogSynchronizedRead(Pref, Pfwd);  // ref=ADC0, fwd=ADC1
     if( (result.result_adc0 !=ADC_ERROR_VALUE) && (result.result_adc1 !=ADC_ERROR_VALUE) )
     {
-      measure.fwd[measure.incount] = result.result_adc1;
-      measure.rev[measure.incount] = result.result_adc0;
+      hw_feed((uint16_t) result.result_adc1 | ((uint32_t) result.result_adc0 << 16));
     }
     else  // error
     {
-      measure.fwd[measure.incount] = -1;      // Should never happen
-      measure.rev[measure.incount] = -1;
+      hw_feed(0xffffffff);               // Should never happen, -1 in both
     }
-    measure.incount++;                        // 8 bit value, rolls over at 256
   }
 }
 
+//
+//-----------------------------------------------------------------------------------------
+//                Acquisition backends, see PSWRacquire.h
+//
+// Timer polled:  The Timer1 interrupt function polls the AD7991 or the builtin ADCs,
+//                busy waiting about 80us for each synchronous read of the builtin ADCs.
+// PDB triggered: The Programmable Delay Block starts both builtin ADCs at the same
+//                time, once per sample period.  The ADC1 conversion complete interrupt
+//                only picks up the two results, no busy waiting in interrupt context.
+//-----------------------------------------------------------------------------------------
+//
+class AcqTimerPoll : public AcqBackend
+{
+  public:
+    void begin(acq_feed_t fn, uint32_t period_us)
+    {
+      hw_feed = fn;
+      Timer1.initialize(period_us);           // Init the adc sample timer interrupt function
+      Timer1.attachInterrupt(powerSampler);
+    }
+    void end(void) { Timer1.detachInterrupt(); }
+    const char *name(void) { return "timer"; }
+};
+
+#if ADC_PDB_ENABLED
+static inline void pdb_adc_read(void)
+{
+  uint16_t f, r;
+
+  #if INTR_LOOP_THRU_LED                      // Blink LED every time going through here 
+  digitalWrite(X_Led,X_LedState ^= 1);
+  #endif
+  f = adc->adc1->readSingle();                // Reading the result clears the interrupt
+  while (!adc->adc0->isComplete()) ;          // Same trigger and settings, ADC0 is done too
+  r = adc->adc0->readSingle();
+  hw_feed(f | ((uint32_t) r << 16));
+}
+
+void pdb_adc_complete(void)                   // ADC1 conversion complete interrupt
+{
+  ISRMON_BEGIN(isr_t0);
+  PERF_BEGIN(perf_t0);
+  pdb_adc_read();
+  PERF_END(PERF_SAMPLER, perf_t0);
+  ISRMON_END(isr_t0);
+}
+
+// The same, for any other feed than the sample ring, i.e. the transient capture.
+// Its interrupts, every CAPTURE_TIMER, are neither monitored nor profiled, as
+// they are not sampler interrupts at R.sample_timer.
+void pdb_adc_complete_unmonitored(void)
+{
+  pdb_adc_read();
+}
+
+void pdb_isr(void)                            // PDB interrupt, enabled by the ADC library
+{
+  PDB0_SC &= ~PDB_SC_PDBIF;                   // Clear interrupt flag
+}
+
+class AcqPdb : public AcqBackend
+{
+  public:
+    void begin(acq_feed_t fn, uint32_t period_us)
+    {
+      hw_feed = fn;
+      adc->adc0->startSingleRead(Pref);       // Select input channels, ref=ADC0, fwd=ADC1
+      adc->adc1->startSingleRead(Pfwd);
+      adc->adc1->enableInterrupts((fn == ad_feed) ? pdb_adc_complete : pdb_adc_complete_unmonitored);
+      adc->adc0->startPDB(1000000 / period_us); // From here on the PDB triggers both ADCs
+      adc->adc1->startPDB(1000000 / period_us);
+    }
+    void end(void)
+    {
+      adc->adc0->stopPDB();
+      adc->adc1->stopPDB();
+      adc->adc1->disableInterrupts();
+    }
+    const char *name(void) { return "pdb"; }
+};
+AcqPdb        acq_pdb;
+#endif
+AcqTimerPoll  acq_timer;
+AcqBackend   *acq;                            // Active acquisition backend
+
+void ad_feed(uint32_t pair)
+{
+  measure.push(pair);
+}
+
+void acq_start(void)
+{
+  #if ADC_PDB_ENABLED
+  if (!ad7991_addr) acq = &acq_pdb;           // AD7991 over I2C can only be polled
+  else
+  #endif
+  acq = &acq_timer;
+  #if ISRMON_ENABLED
+  isrmon_init(R.sample_timer);
+  #endif
+  acq->begin(ad_feed, R.sample_timer);
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//                Change the sample rate at runtime, by Menu or USB
+//
+// Sampling is stopped, whatever is left in the ring at the old rate is discarded, the
+// windows are restarted for the new rate and sampling is restarted.  Returns false,
+// and nothing changed, if the sample timer value is outside the selectable range.
+//-----------------------------------------------------------------------------------------
+//
+bool pswr_sample_rate(uint16_t period_us)
+{
+  const uint32_t *ad;
+  uint16_t n;
+
+  if ((period_us < SAMPLE_TIMER_MIN) || (period_us > SAMPLE_TIMER_MAX)) return false;
+
+  acq->end();                                 // Stop sampling
+  while ((n = measure.block(&ad)) > 0)        // Drop samples taken at the old rate
+    measure.release(n);
+  R.sample_timer = period_us;
+  pswr_window_init();                         // Window lengths for the new rate
+  acq_start();                                // and resume sampling
+  return true;
+}
+
+
+//
+//-----------------------------------------------------------------------------------------
+//                Measurement kernel, specialized for the selected Detector and Coupler
+//
+// The kernel holds the lookup tables, 12 bit AD value to dBm x 100 (AD8307) or to Volts
+// (diode), see PSWRkernel.h.  The tables are rebuilt whenever the calibration values
+// they were built from change, whether by Calibrate Menu, USB $calset or a factory reset.
+//-----------------------------------------------------------------------------------------
+//
+pswr_kernel_t kernel;
+
+
+//
+//-----------------------------------------------------------------------------------------
+//                Decimation, and the sliding windows for Peak (100ms), PEP (1, 2.5 or 5s)
+//                and LONG (30s), and the ring buffer for the 100ms and 1s averages
+//
+// Each 100ms of samples is split into DECIM_TICKS periods of 10ms.  The Peak window
+// is fed with the max, and the AVG ring with the mean, of each period.  PEP is fed
+// once per 100ms.  When the sample rate does not divide evenly, e.g. 150 samples per
+// 100ms, the periods are of 14 or 15 samples.  The window buffers hold decimated
+// values, hence their sizes do not depend on the sample rate.
+//-----------------------------------------------------------------------------------------
+//
+#define AVG_TICKS1S       (10*DECIM_TICKS)    // Decimated AVG periods within 1s
+
+static slidingmax_t pk_store[DECIM_TICKS];    // Window buffers
+static slidingmax_t pep_store[PEP_BUFFER];
+static slidingmax_t long_store[LONG_BUFFER];
+
+uint16_t     buf_short;                       // Samples within 100ms, at the active sample rate
+SlidingMax   pk_window;                       // dB information in a 100 ms window, 10ms granularity
+SlidingMax   pep_window;                      // dB information in a 1, 2.5 or 5 second window, 100ms granularity
+SlidingMax   long_window;                     // dB information in a 30 second window, PEP period granularity
+
+// For measurement of peak and average power, see determine_power_pep_pk()
+DecimateMax<int32_t>            pk_dec;       // Max of each 10ms, dB x 100
+DecimateMean<uint32_t,uint64_t> avg_dec;      // Mean of each 10ms, uW
+DecimateMax<double>             scope_dec;    // Max of each Modulation Scope pixel, mW
+static uint32_t scope_us;                     // Time into the current Modulation Scope pixel
+static uint32_t p_avg_buf[AVG_TICKS1S];       // a one second buffer of 10ms power averages in uW, for both averages
+static uint64_t p_1splus;                     // averaging: all power averages within a 1s window added together, uW
+static uint64_t p_plus;                       // averaging: all power averages within a 100ms window added together, uW
+static uint16_t smp_cnt;                      // Sample counter within 100ms
+static uint16_t smp_end;                      // Last sample of the current 10ms period
+static uint16_t tick_cnt;                     // 10ms period counter within 100ms
+static uint16_t pep_cnt;                      // PEP: 100ms block counter
+static uint16_t avg_old;                      // avg: oldest entry of the short window, trailing avg_new
+static uint16_t avg_new;                      // avg: 1s ring buffer counter
+static P2Quantiles fwd_p2[QWINDOWS];          // Forward power quantile estimators, 1s, PEP and 30s
+static P2Quantiles swr_p2[QWINDOWS];          // SWR quantile estimators
+static uint16_t q_cnt[QWINDOWS];              // 100ms blocks into each quantile window
+static uint8_t  needle_set;                   // Needle: preset of the coefficients, 0 if off, 0xff to recalculate
+static float    needle_att;                   // Needle: attack coefficient per sample
+static float    needle_fall;                  // Needle: decay per sample, dB
+static float    needle_db;                    // Needle: power in dBm
+static int32_t  hist_min_db;                  // History: lowest power within 100ms, dBm x 100
+static float    hist_swr;                     // History: highest SWR within 100ms, 0 if none meaningful
+static bool     analyses_held;                // Not feeding the analyses, see pswr_analyses_hold()
+
+//-----------------------------------------------------------------------------------------
+// Windows, decimators and averages from scratch, for the current sample rate
+void pswr_window_reset(void)
+{
+  // Samples within 100ms, rounded to the nearest sample
+  buf_short = (100000 + R.sample_timer/2) / R.sample_timer;
+
+  pk_window.init(pk_store, DECIM_TICKS, DECIM_TICKS);
+  pep_window.init(pep_store, PEP_BUFFER, R.PEP_period);
+  long_window.init(long_store, LONG_BUFFER, LONG_BUFFER/(R.PEP_period/10));
+
+  // Start the decimators and averages from scratch, the short window being
+  // the most recent DECIM_TICKS entries of the one second ring
+  pk_dec.clear();
+  avg_dec.clear();
+  scope_dec.clear();
+  scope_us = 0;
+  memset(p_avg_buf, 0, sizeof(p_avg_buf));
+  p_1splus = 0;
+  p_plus   = 0;
+  smp_cnt  = 0;
+  smp_end  = buf_short / DECIM_TICKS;
+  tick_cnt = 0;
+  pep_cnt  = 0;
+  avg_new  = 0;
+  avg_old  = AVG_TICKS1S - DECIM_TICKS;
+}
+
+//-----------------------------------------------------------------------------------------
+// At start up and at a change of sample rate: the windows, and the analyses of
+// the power, whose results do not carry over to another rate
+void pswr_window_init(void)
+{
+  pswr_window_reset();
+
+  Keying.init(R.sample_timer);                // Forget keying results taken at the old rate
+  Hist.clear();                               // and the power distribution
+  needle_set = 0xff;                          // Needle coefficients for the new rate
+  hist_min_db = DB100_MAX;                    // History: start a new 100ms slot
+  hist_swr = 0;
+  Bursts.period(R.sample_timer);              // A burst in progress ends at a rate change
+  for (uint8_t w = 0; w < QWINDOWS; w++)      // and restart the quantile windows
+  {
+    fwd_p2[w].init();
+    swr_p2[w].init();
+    q_cnt[w] = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+// Hold or resume feeding the analyses of the power: distribution, burst log,
+// quantiles, needle and history.  The benchmark pushes simulated samples through
+// determine_power_pep_pk(), which would otherwise end up among the real results.
+void pswr_analyses_hold(bool hold)
+{
+  analyses_held = hold;
+}
+
+//-----------------------------------------------------------------------------------------
+// Feed the Modulation Scope with the max of each pixel period, SCOPE_PIXEL_US x Divisor,
+// whatever the sample rate.  A pixel is never shorter than one sample.
+void pswr_scope_feed(void)
+{
+  uint32_t pixel_us = (uint32_t) SCOPE_PIXEL_US * R.modscopeDivisor;
+
+  scope_dec.add(power_mw);
+  scope_us += R.sample_timer;
+  if (scope_us >= pixel_us)
+  {
+    scope_us -= pixel_us;
+    if (scope_us >= pixel_us) scope_us = 0;   // Sample period longer than a pixel
+    ModScope.adddata(scope_dec.take(), power_mw_long);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+// The Screensaver threshold in dBm x 100, not lower than KEYING_FLOOR, for the keying
+// analyzer and the power distribution.  Converted only when it has been changed
+static int16_t idle_db100 = KEYING_FLOOR;
+
+void pswr_idle_threshold(void)
+{
+  static float thresh = -1;
+
+  if (R.idle_disp_thresh != thresh)
+  {
+    thresh = R.idle_disp_thresh;
+    idle_db100 = (thresh > 0) ? max(lround(100 * fast_lin_to_db(thresh)), KEYING_FLOOR) : KEYING_FLOOR;
+  }
+  Keying.threshold(idle_db100);
+}
+
+//-----------------------------------------------------------------------------------------
+// Feed the CW keying analyzer with every sample
+void pswr_keying_feed(void)
+{
+  Keying.add(constrain(lround(power_db * 100), DB100_MIN, DB100_MAX));
+}
+
+//-----------------------------------------------------------------------------------------
+// Feed the quantile estimators of all windows with each sample of forward power, and
+// SWR if meaningful power, while transmitting.  P-square is a fixed amount of work
+// per sample, whatever the length of the window
+void pswr_quantile_feed(void)
+{
+  bool  swr_valid = power_mw > pswr_kernel_t::min_pwr_for_swr_calc;
+  float s = swr_valid ? kernel.swr() : 0;
+
+  for (uint8_t w = 0; w < QWINDOWS; w++)
+  {
+    fwd_p2[w].add(fwd_power_mw);
+    if (swr_valid) swr_p2[w].add(s);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+// Once every 100ms, publish the results of each window which has ended and restart it
+void pswr_quantile_window(void)
+{
+  const uint16_t len[QWINDOWS] = { 10, R.PEP_period, 300 };   // In 100ms blocks
+
+  for (uint8_t w = 0; w < QWINDOWS; w++)
+  {
+    if (++q_cnt[w] < len[w]) continue;
+    q_cnt[w] = 0;
+    fwd_p2[w].result(fwd_q[w]);
+    swr_p2[w].result(swr_q[w]);
+    fwd_p2[w].init();
+    swr_p2[w].init();
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+// Needle ballistics, once every 100ms, recalculate the coefficients if the preset for
+// the active display mode has been changed, or the sample rate.  Attack is exponential
+// in dB towards a higher power.  An exponential decay of the power is a fall at a
+// constant rate in dB, 10*log10(e) = 4.343 dB per time constant.
+void pswr_needle_preset(void)
+{
+  static const uint16_t tc[NEEDLE_PRESETS][2] =
+  {
+    { NEEDLE_FAST_ATTACK, NEEDLE_FAST_DECAY },
+    { NEEDLE_MED_ATTACK,  NEEDLE_MED_DECAY  },
+    { NEEDLE_SLOW_ATTACK, NEEDLE_SLOW_DECAY }
+  };
+  uint8_t preset = (mode_display <= MAX_MODE) ? R.needle[mode_display] : 0;
+
+  if (preset > NEEDLE_PRESETS) preset = 0;
+  if (preset == needle_set) return;
+  if (preset && !needle_set) needle_db = power_db_pk;   // Start from the present level
+  needle_set = preset;
+  if (!preset) return;
+  needle_att  = 1 - exp(-(R.sample_timer / 1000.0) / tc[preset-1][0]);
+  needle_fall = 4.3429448 * (R.sample_timer / 1000.0) / tc[preset-1][1];
+}
+
+//-----------------------------------------------------------------------------------------
+// Multi resolution history, once every 10ms track the highest SWR, if meaningful power,
+// and once every 100ms add a slot of lowest, average and highest power and highest SWR
+void pswr_history_swr(void)
+{
+  float s;
+
+  if (power_mw <= pswr_kernel_t::min_pwr_for_swr_calc) return;
+  s = kernel.swr();
+  if (s > hist_swr) hist_swr = s;
+}
+
+void pswr_history_feed(void)
+{
+  History.add(hist_min_db / 100.0f, power_mw_avg, power_db_pk, hist_swr, millis());
+  hist_min_db = DB100_MAX;
+  hist_swr = 0;
+}
+
+//-----------------------------------------------------------------------------------------
+// Fade out the power distribution, once every 100ms, by the time constant R.hist_decay
+// in seconds, or hold if 0.  The factor is recalculated only when it has been changed
+void pswr_hist_decay(void)
+{
+  static uint16_t tc = 0;
+  static uint64_t keep = HIST_HOLD;
+
+  if (R.hist_decay != tc)
+  {
+    tc = R.hist_decay;
+    keep = hist_keep(tc);
+  }
+  Hist.decay(keep);
+}
+
 //
 //---------------------------------------------------------------------------------
-// Process circular buffers being fed by the Interrupt function
+// Process the ring buffer being fed by the Interrupt function
+//
+// New input is processed in blocks of contiguous entries, up to the end of the
+// ring and then from its start, if wrapped around.  Entries are handed back to
+// the Interrupt function once a block has been processed.  The ring publishes
+// its indexes with acquire/release ordering, hence no need to disable interrupts.
 //---------------------------------------------------------------------------------
 //
 void pswr_sync_from_interrupt(void)
 {
-  uint8_t in;
+  const uint32_t *ad;
+  uint16_t n;
 
-  noInterrupts();
-  in = measure.incount;
-  interrupts();
+  kernel.check(R, adc_ref);                   // Rebuild lookup tables if calibration has changed
+  pswr_idle_threshold();                      // Key down and power distribution threshold
 
-  while (measure.outcount != in)              // Read from circular buffer, while new input available
+  while ((n = measure.block(&ad)) > 0)        // Read from ring buffer, while new input available
   {
-    noInterrupts();
-    fwd = measure.fwd[measure.outcount];      // Transfer data from circular buffers
-    rev = measure.rev[measure.outcount];
-    interrupts();
-    measure.outcount++;                       // 8 bit value, rolls over at 256
-    
-    determine_power_pep_pk();                 // Determine Instantaneous power, pep, pk and avg
-
-    if (modScopeActive)                       // Modulation Scope
+    if (n > AD_BLOCK) n = AD_BLOCK;
+
+    kernel.decode(ad, n);                     // AD values to dBm x 100, if AD8307
+
+    for (uint16_t x = 0; x < n; x++)
     {
-      ModScope.adddata(power_mw, power_mw_long);    
-    }
+      fwd = ad[x];                            // Transfer data from ring buffer
+      rev = ad[x] >> 16;
+
+      determine_power_pep_pk(x);              // Determine Instantaneous power, pep, pk and avg
+
+      pswr_keying_feed();                     // CW keying waveform analyzer
 
-    noInterrupts();                           // Perhaps a bit redundant - squeeze every last drop while we're at it
-    in = measure.incount;
-    interrupts();
+      if (modScopeActive)                     // Modulation Scope
+      {
+        pswr_scope_feed();
+      }
+    }
+    measure.release(n);                       // Hand the entries back to the Interrupt function
   }
 }
 
@@ -224,16 +610,17 @@ void calc_SWR_and_power(void)
   static double  swr_plus;                       // averaging: all swr measurements within a short window added together
   static uint16_t a;                             // swr avg: short ring buffer counter
   
-  power_mw_pk   = pow(10,power_db_pk/10.0);
-  power_mw_pep  = pow(10,power_db_pep/10.0);   
-  power_mw_long = pow(10,power_db_long/10.0);   
+  power_mw_pk   = fast_db_to_lin(power_db_pk);
+  power_mw_pep  = fast_db_to_lin(power_db_pep);
+  power_mw_long = fast_db_to_lin(power_db_long);
+  power_mw_needle = fast_db_to_lin(needle_db);
   
   // Only calculate SWR if meaningful power
 
-  if ((power_mw > MIN_PWR_FOR_SWR_CALC) || (power_mw < -MIN_PWR_FOR_SWR_CALC))
+  if ((power_mw > pswr_kernel_t::min_pwr_for_swr_calc) || (power_mw < -pswr_kernel_t::min_pwr_for_swr_calc))
   {
-    // Calculate SWR
-    swr = (1+(r_inst/f_inst))/(1-(r_inst/f_inst));
+    // Calculate SWR, from most recent sample
+    swr = kernel.swr();
 
     // Check for high SWR and set alarm flag if trigger value is exceeded
     // If trigger is 40 (4:1), then Alarm function is Off
@@ -253,7 +640,7 @@ void calc_SWR_and_power(void)
   
   // If some power present, but not enough for an accurate SWR reading, then use
   // recent measured value
-  else if ((power_mw > MIN_PWR_FOR_SWR_SHOW) || (power_mw < -MIN_PWR_FOR_SWR_SHOW))
+  else if ((power_mw > pswr_kernel_t::min_pwr_for_swr_show) || (power_mw < -pswr_kernel_t::min_pwr_for_swr_show))
   {
     // Do nothing, in other words, swr remains the same
   }
@@ -273,49 +660,6 @@ void calc_SWR_and_power(void)
 }
 
 
-#if AD8307_INSTALLED
-//
-//-----------------------------------------------------------------------------------------
-//                Convert Voltage Reading into Power when using AD8307
-//-----------------------------------------------------------------------------------------
-//
-void pswr_determine_dBm(void)
-{
-  double  delta_db;
-  double  delta_F, delta_R;
-  double  delta_Fdb, delta_Rdb;
-  double  temp;
-
-  // Calculate the slope gradient between the two calibration points:
-  //
-  // (dB_Cal1 - dB_Cal2)/(V_Cal1 - V_Cal2) = slope_gradient
-  //
-  delta_db = (double)((R.cal_AD[1].db10m - R.cal_AD[0].db10m)/10.0);
-  delta_F = R.cal_AD[1].Fwd - R.cal_AD[0].Fwd;
-  delta_Fdb = delta_db/delta_F;
-  delta_R = R.cal_AD[1].Rev - R.cal_AD[0].Rev;
-  delta_Rdb = delta_db/delta_R;
-  //
-  // measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
-  ad8307_FdBm = (adc_ref * (fwd/4096.0) - R.cal_AD[0].Fwd) * delta_Fdb + R.cal_AD[0].db10m/10.0;
-  ad8307_RdBm = (adc_ref * (rev/4096.0) - R.cal_AD[0].Rev) * delta_Rdb + R.cal_AD[0].db10m/10.0;
-
-  // Test for direction of power - Always designate the higher power as "forward"
-  // while setting the "Reverse" flag on reverse condition.
-  if (ad8307_FdBm > ad8307_RdBm)        // Forward direction
-  {
-    Reverse = false;
-  }
-  else                                  // Reverse direction
-  {
-    temp = ad8307_RdBm;
-    ad8307_RdBm = ad8307_FdBm;
-    ad8307_FdBm = temp;
-    Reverse = true;
-  }
-}
-#endif
-
 //
 //-----------------------------------------------------------------------------------------
 //                Determine Forward and Reflected power
@@ -323,161 +667,117 @@ void pswr_determine_dBm(void)
 //                Also determine PEP, 100ms peak and Average, 100ms and 1s.
 //-----------------------------------------------------------------------------------------
 //
-void determine_power_pep_pk(void)
+void determine_power_pep_pk(uint16_t x)
 {
-  // For measurement of peak and average power
-  static int32_t  buff_short[BUF_SHORT];        // voltage db information in a 100 ms window
-  static int32_t  pepbuff[PEP_BUFFER];          // voltage db information in a 1, 2.5 or 5 second window
-  static int32_t  longbuff[LONG_BUFFER];        // voltage db information in a 30 second window
-  int32_t pk;                                   // Keep track of Max (1s) and Peak (100ms) dB voltage
-  static double   p_avg_buf[AVG_BUFSHORT];      // a short buffer of all instantaneous power measurements, for short average
-  static double   p_avg_buf1s[AVG_BUF1S];       // a one second buffer of instantanous power measurements, for 1s average
-  static double   p_1splus;                     // averaging: all power measurements within a 1s window added together
-  static double   p_plus;                       // averaging: all power measurements within a shorter window added together
-  static uint16_t a;                            // Pk:  100ms ring buffer counter
-  static uint16_t b;                            // PEP: ring buffer counter
-  static uint16_t c;                            // Long: ring buffer counter
-  static uint16_t d;                            // avg: short ring buffer counter
-  static uint16_t e;                            // avg: 1s ring buffer counter
-
-  #if AD8307_INSTALLED     
+  int32_t         p_db;                         // Real Power Output in dB x 100
+  uint32_t        p_uw;                         // Real Power Output in uW
+  uint32_t        m_uw;                         // Average of a 10ms period in uW
+
   //---------------------------------------------------------------------------------
-  // Process Forward and Reflected power measurements from 2x AD8307
+  // Forward and Reflected power from 2x AD8307 or from Diode Detectors, sample x of
+  // the block most recently decoded, see PSWRkernel.h
   //---------------------------------------------------------------------------------
+  p_db = kernel.power(x);
 
-  pswr_determine_dBm();                         // Determine dBm from AD8307 voltages
-  
-  // Instantaneous forward voltage and power, milliwatts and dBm
-  f_inst = pow(10,ad8307_FdBm/20.0);		        // (We use voltage later on, for SWR calc)
-  fwd_power_mw = SQR(f_inst);			              // P_mw = (V*V) (current and resistance have already been factored in)
-
-  // Instantaneous reverse voltage and power
-  r_inst = pow(10,(ad8307_RdBm)/20.0);
-  ref_power_mw = SQR(r_inst);
+  //------------------------------------------
+  // Decimate, max for Peak and PEP, mean for the averages.  Power is kept as
+  // integer microwatts, hence the sums are exact, no drift however long the
+  // meter runs.
+  if (power_mw < 4000000) p_uw = power_mw * 1000 + 0.5;
+  else p_uw = 4000000000UL;                     // 4kW, same boundary as for the AD8307
 
-  // We need some sane boundaries (4kW) to determine reasonable variable defs for further calculations
-  if (fwd_power_mw > 4000000) fwd_power_mw = 4000000;
-  if (ref_power_mw > 4000000) ref_power_mw = 4000000;
-  
-  // Instantaneous Real Power Output
-  power_mw = fwd_power_mw - ref_power_mw;
-  power_db = 10 * log10(power_mw);
+  pk_dec.add(p_db);
+  avg_dec.add(p_uw);
 
-  #else
-  //---------------------------------------------------------------------------------
-  // Measure Forward and Reflected power from Diode Detecotrs
-  //---------------------------------------------------------------------------------
-  // Test for direction of power - Always designate the higher power as "forward"
-  // while setting the "Reverse" flag on reverse condition.
-  if (fwd > rev)                                // Forward direction
+  if (!analyses_held)
   {
-    Reverse = false;
-  }
-  else                                          // Reverse direction
-  {
-    uint16_t temp = rev;
-    rev = fwd;
-    fwd = temp;
-    Reverse = true;
-  }
+    if (p_db >= idle_db100)                     // While transmitting
+    {
+      Hist.add(p_db);                           // Power distribution
+      pswr_quantile_feed();                     // Median, P90 and P99
+    }
+    if (p_db < hist_min_db) hist_min_db = p_db; // History, lowest power within 100ms
 
-  // Instantaneous forward voltage and power, milliwatts
-  //
-  // Establish actual measured voltage at diode
-  f_inst = (double) fwd * adc_ref/4096.0;
-  // Convert to VRMS in Bridge
-  if (f_inst >= D_VDROP) f_inst = 1/1.4142135 * (f_inst - D_VDROP) + D_VDROP;
-  // Take Bridge Coupling into account
-  f_inst = f_inst * BRIDGE_COUPLING * R.meter_cal/100.0;
-  // Convert into milliwatts
-  fwd_power_mw = 1000 * SQR(f_inst)/50.0;
-    
-  // Instantaneous reflected voltage and power
-  //
-  // Establish actual measured voltage at diode
-  r_inst = (double) rev * adc_ref/4096.0;
-  // Convert to VRMS in Bridge
-  if (r_inst >= D_VDROP) r_inst = 1/1.4142135 * (r_inst - D_VDROP) + D_VDROP;
-  // Take Bridge Coupling into account
-  r_inst = r_inst * BRIDGE_COUPLING * R.meter_cal/100.0;
-  // Convert into milliwatts
-  ref_power_mw = 1000 * SQR(r_inst)/50.0;
-  
-  // Instantaneous Real Power Output
-  power_mw = fwd_power_mw - ref_power_mw;
-  if (power_mw <  0) power_mw = power_mw * -1;
-  power_db = 10 * log10(power_mw);
+    //------------------------------------------
+    // Transmission burst log, SWR only within a burst and if meaningful power
+    if (Bursts.add(constrain(p_db, DB100_MIN, DB100_MAX), p_uw, Reverse, idle_db100, millis())
+        && (power_mw > pswr_kernel_t::min_pwr_for_swr_calc))
+      Bursts.swr(kernel.swr());
 
-  #endif
-   
-  //------------------------------------------
-  // Find peaks and averages
+    //------------------------------------------
+    // Needle ballistics, if selected for the active display mode, see pswr_needle_preset()
+    if (needle_set)
+    {
+      float db = p_db / 100.0f;
+      if (db > needle_db) needle_db += needle_att * (db - needle_db);
+      else if ((needle_db -= needle_fall) < db) needle_db = db;
+    }
+  }
+  if (++smp_cnt < smp_end) return;              // Nothing more until the end of the 10ms period
 
-  // Multiply by 100 to make suitable for integer value
-  // Store dB value in a ring buffer
-  buff_short[a++] = 100 * power_db;             // Get precision of two subdecimals
-  if (a == BUF_SHORT)    a = 0;
+  //------------------------------------------
+  // End of a 10ms period.  Feed the 100ms window with its max and retrieve the
+  // Peak value within the window
+  power_db_pk = pk_window.add(pk_dec.take()) / 100.0;   // Get precision of two subdecimals
 
   //------------------------------------------
-  // Find Peak value within a 100ms sliding window
-  pk =-0x7fffffff;
-  for (uint8_t x = 0; x < BUF_SHORT; x++)
-  {
-    if (pk < buff_short[x]) pk = buff_short[x];
-  }
-  power_db_pk = pk / 100.0;
+  // Determine averages, using a FIFO + add and subtract buffer methology,
+  // the short window being the most recent DECIM_TICKS entries of the 1s ring
+  m_uw = avg_dec.take();
+  p_plus   = p_plus + m_uw - p_avg_buf[avg_old];      // Add latest value and subtract the oldest in [100ms]
+  p_1splus = p_1splus + m_uw - p_avg_buf[avg_new];    // Add latest value and subtract the oldest in [1s]
+  p_avg_buf[avg_new] = m_uw;                          // Add the newest value onto ring buffer
+  if (++avg_old == AVG_TICKS1S) avg_old = 0;          // wrap around
+  if (++avg_new == AVG_TICKS1S) avg_new = 0;
+  power_mw_avg   = p_plus   / (1000.0 * DECIM_TICKS); // And finally, find the short period average
+  power_mw_1savg = p_1splus / (1000.0 * AVG_TICKS1S); // and the one second period average
+  if (!analyses_held) pswr_history_swr();             // History, highest SWR within 100ms
 
   //------------------------------------------
-  // Feed and Retrieve Max Value within a 1 to 5 second sliding window, 
-  // while using a resolution granularity of BUF_SHORT (100ms)
-  if (a == 0)                                   // Once every BUF_SHORT*SAMPLE_TIMER time
+  // Once every 100ms
+  if (++tick_cnt >= DECIM_TICKS)
   {
-    pepbuff[b++] = 100 * power_db_pk;           // Feed the PEP buffer with Pk values, precision of two subdecimals
-    if (b >= R.PEP_period) b = 0;
-   
-    pk =-0x7fffffff;
-    for (uint16_t x = 0; x < R.PEP_period; x++) // Retrieve a new PEP value
+    tick_cnt = 0;
+    smp_cnt  = 0;
+
+    if (!analyses_held)
     {
-      if (pk < pepbuff[x]) pk = pepbuff[x];
+      pswr_hist_decay();                        // Fade out the power distribution
+      pswr_quantile_window();                   // Quantile results, at the end of each window
+      pswr_needle_preset();                     // Needle ballistics for the active display mode
+      pswr_history_feed();                      // Multi resolution history, a new 100ms slot
     }
-    power_db_pep = pk / 100.0;
-  }
-  if (power_db_pep < power_db_pk)               // Correct for slow reaction of the above
-    power_db_pep = power_db_pk;
-  
-  //------------------------------------------
-  // Feed and Retrieve Max Value within a 30 second (or longer) sliding window
-  if (b == 0)                                   // Once every PEP (1s, 2.5s or 5s) time
-  {
-    longbuff[c++] = 100 *power_db_pep;          // Feed the long buffer with PEP values, precision of two subdecimals
-    if (c >= (LONG_BUFFER/(R.PEP_period/10))) c = 0;
 
-    pk =-0x7fffffff;
-    for (uint16_t x = 0; x < (LONG_BUFFER/(R.PEP_period/10)); x++)  // Retrieve a new LONG value
+    //------------------------------------------
+    // Resize PEP and LONG windows if PEP period has been changed, by Menu or USB.
+    // Values outside the new windows are expired, no rescan needed.
+    if (pep_window.length() != R.PEP_period)
+    {
+      pep_window.length(R.PEP_period);
+      long_window.length(LONG_BUFFER/(R.PEP_period/10));
+    }
+
+    //------------------------------------------
+    // Feed and Retrieve Max Value within a 1 to 5 second sliding window, 
+    // while using a resolution granularity of 100ms
+    power_db_pep = pep_window.add(100 * power_db_pk) / 100.0;
+
+    //------------------------------------------
+    // Feed and Retrieve Max Value within a 30 second (or longer) sliding window
+    if (++pep_cnt >= R.PEP_period)              // Once every PEP (1s, 2.5s or 5s) time
     {
-      if (pk < longbuff[x]) pk = longbuff[x];
+      pep_cnt = 0;
+      // Feed the long window with PEP values, precision of two subdecimals
+      power_db_long = long_window.add(100 * power_db_pep) / 100.0;
     }
-    power_db_long = pk / 100.0;
   }
+  if (power_db_pep < power_db_pk)               // Correct for slow reaction of the above
+    power_db_pep = power_db_pk;
   if (power_db_long < power_db_pep)             // Correct for slow reaction of the above
     power_db_long = power_db_pep;
-  
-  //------------------------------------------
-  // Determine averages, using a FIFO + add and subtract buffer methology
-
-  //------------------------------------------
-  // Average power buffers, short period (100 ms)
-  p_avg_buf[d++] = power_mw;                    // Add the newest value onto ring buffer
-  p_plus = p_plus + power_mw;                   // Add latest value to the total sum of all measurements in [100ms]
-  if (d == AVG_BUFSHORT) d = 0;                 // wrap around
-  p_plus = p_plus - p_avg_buf[d];               // and subtract the oldest value in the ring buffer from the total sum
-  power_mw_avg = p_plus / (AVG_BUFSHORT-1);     // And finally, find the short period average
 
   //------------------------------------------
-  // Average power buffers, 1 second
-  p_avg_buf1s[e++] = power_mw;                  // Add the newest value onto ring buffer
-  p_1splus = p_1splus + power_mw;               // Add latest value to the total sum of all measurements in 1s
-  if (e == AVG_BUF1S) e = 0;                    // wrap around
-  p_1splus = p_1splus - p_avg_buf1s[e];         // and subtract the oldest value in the ring buffer from the total sum
-  power_mw_1savg = p_1splus / (AVG_BUF1S-1);    // And finally, find the one second period average
+  // End of the next 10ms period, the remainder of uneven sample counts is
+  // spread over the periods
+  smp_end = ((uint32_t) (tick_cnt + 1) * buf_short) / DECIM_TICKS;
 }
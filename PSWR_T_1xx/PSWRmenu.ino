@@ -33,48 +33,50 @@
 
 #if SSD1306               // OLED display version 
 #if BATTERY_POWER
-const uint8_t level0_menu_size = 10;
+const uint8_t level0_menu_size = 11;
 #else
-const uint8_t level0_menu_size = 9;
+const uint8_t level0_menu_size = 10;
 #endif
 const char *level0_menu_items[] =
           {  "1 SWR Alarm",
              "2 SWR Alarm Power",
              "3 PEP Period",
+             "4 Sample Rate",
              #if BATTERY_POWER
-             "4 Display&Battery",
+             "5 Display&Battery",
              #else
-             "4 Display Setup",
+             "5 Display Setup",
              #endif
-             "5 Scale Ranges",					
-             "6 Calibrate",
-             "7 Debug Display",
-             "8 Reset-> Default",
+             "6 Scale Ranges",					
+             "7 Calibrate",
+             "8 Debug Display",
+             "9 Reset-> Default",
              #if BATTERY_POWER
              "X Power Off",
              #endif
              "0 Exit"  };
 #else                     // TFT Colour LCD version
 #if BATTERY_POWER
-const uint8_t level0_menu_size = 12;
+const uint8_t level0_menu_size = 13;
 #else
-const uint8_t level0_menu_size = 11;
+const uint8_t level0_menu_size = 12;
 #endif
 const char *level0_menu_items[] =
           {  "1 SWR Alarm",
              "2 SWR Alarm Power",
              "3 PEP Period",
+             "4 Sample Rate",
              #if BATTERY_POWER
-             "4 Display&Battery",
+             "5 Display&Battery",
              #else
-             "4 Display Setup",
+             "5 Display Setup",
              #endif
-             "5 Scale Ranges",          
-             "6 Modulation Scope",
-             "7 Calibrate",
-             "8 Debug Display",
-             "9 Debug2 Display",
-             "10 Reset-> Default",
+             "6 Scale Ranges",          
+             "7 Modulation Scope",
+             "8 Calibrate",
+             "9 Debug Display",
+             "10 Debug2 Display",
+             "11 Reset-> Default",
              #if BATTERY_POWER             
              "X Power Off",
              #endif
@@ -97,11 +99,29 @@ const char *swr_alarm_pwr_thresh_menu_items[] =
 // Flag for PEP Sample Period select
 #define PEP_MENU                 3
 // PEP Sample Period select menu Items
-const uint8_t pep_menu_size = 3;
+const uint8_t pep_menu_size = 6;
 const char *pep_menu_items[] =
           {  "1    1s",
              "2  2.5s",
-             "3    5s"  };
+             "3    5s",
+             "4 Needle Fast",
+             "5 Needle Med",
+             "6 Needle Slow"  };
+
+// Flag for Sample Rate select
+#define SAMPLERATE_MENU          4
+// Sample Rate select menu Items, and the corresponding sample timer in microseconds
+const uint8_t samplerate_menu_size = 7;
+const char *samplerate_menu_items[] =
+          {  "1   200/s",
+             "2   500/s",
+             "3  1000/s",
+             "4  1500/s",
+             "5  2000/s",
+             "6  3000/s",
+             "7  4000/s"  };
+const uint16_t samplerate_menu_timer[] =
+          {  5000, 2000, 1000, 667, 500, 333, 250  };
 
 // Flag for Encoder Resolution Change
 //#define ENCODER_MENU	8
@@ -188,17 +208,7 @@ const char *idle_poweroff_menu_items[] =
 // Flag for Modulation Scope menu
 #define MODSCOPE_MENU          50
 const uint8_t modscope_menu_size = 7;
-    #if F_CPU >= 144000000         // CPU is overclocked at 144 MHz
-const char *modscope_menu_items[] =
-          {  "0  Go Back",
-             "1   200 ms",         // divisor = 1
-             "2   400 ms",         // 2
-             "3   600 ms",         // 3
-             "4   800 ms",         // 4
-             "5    1.0 s",         // 5
-             "6    2.0 s"  };      // 10             
-#else                              // CPU is at normal speed
-const char *modscope_menu_items[] =
+const char *modscope_menu_items[] =            // Scan period, independent of the sample rate
           {  "0  Go Back",
              "1   300 ms",         // divisor = 1
              "2   600 ms",         // 2
@@ -206,7 +216,6 @@ const char *modscope_menu_items[] =
              "4  1200 ms",         // 4
              "5    1.5 s",         // 5
              "6    3.0 s"  };      // 10             
-#endif
 
 // Flag for Calibrate menu
 #define CAL_MENU               60
@@ -634,9 +643,10 @@ void pep_menu(void)
 {
   static int8_t	current_selection;
 
-  // Get Current value
-  if (R.PEP_period == (5000000/SAMPLE_TIMER)/BUF_SHORT) current_selection = 2;          // 5 seconds
-  else if (R.PEP_period == (2500000/SAMPLE_TIMER)/BUF_SHORT)    current_selection = 1;  // 2.5 seconds
+  // Get Current value, Needle for the active display mode, else PEP period
+  if (R.needle[mode_display]) current_selection = R.needle[mode_display] + 2;
+  else if (R.PEP_period == 50) current_selection = 2;     // 5 seconds
+  else if (R.PEP_period == 25) current_selection = 1;     // 2.5 seconds
   else current_selection = 0;         // Any other value, other than 1s, is invalid
 
   // Selection modified by encoder.  We remember last selection, even if exit and re-entry
@@ -669,14 +679,16 @@ void pep_menu(void)
     while(current_selection < 0)
       current_selection += menu_size;
 
-    if      (current_selection == 2) R.PEP_period = (5000000/SAMPLE_TIMER)/BUF_SHORT;
-    else if (current_selection == 1) R.PEP_period = (2500000/SAMPLE_TIMER)/BUF_SHORT;
-    else R.PEP_period = (1000000/SAMPLE_TIMER)/BUF_SHORT;			
+    R.needle[mode_display] = 0;
+    if      (current_selection >= 3) R.needle[mode_display] = current_selection - 2;
+    else if (current_selection == 2) R.PEP_period = 50;
+    else if (current_selection == 1) R.PEP_period = 25;
+    else R.PEP_period = 10;			
 
     VirtLCDw.clear();
     VirtLCDy.clear();
     VirtLCDy.setCursor(0,0);
-    VirtLCDy.print("PEP sampling period:");
+    VirtLCDy.print("PEP period or Needle");
 
     // Print the Rotary Encoder scroll Menu
     lcd_scroll_Menu((char**)pep_menu_items, menu_size, current_selection, 1, 7,3);
@@ -687,6 +699,10 @@ void pep_menu(void)
     VirtLCDw.print("Available periods");
     VirtLCDw.setCursor(0,6);
     VirtLCDw.print("1, 2.5 or 5 seconds");
+    VirtLCDw.setCursor(0,7);
+    VirtLCDw.print("or Needle ballistics");
+    VirtLCDw.setCursor(0,8);
+    VirtLCDw.print("for this Display");
   }
 
   // Enact selection
@@ -700,7 +716,7 @@ void pep_menu(void)
 
     // Check if selected threshold is not same as previous
     EEPROM_readAnything(1,eeprom_R);
-    if (eeprom_R.PEP_period != R.PEP_period)
+    if ((eeprom_R.PEP_period != R.PEP_period) || (eeprom_R.needle[mode_display] != R.needle[mode_display]))
     {
       EEPROM_writeAnything(1,R);
       VirtLCDy.print("Value Stored");
@@ -719,6 +735,99 @@ void pep_menu(void)
 }
 
 
+//--------------------------------------------------------------------
+// Sample Rate selection Menu
+// The new rate is only put to use when enacted, as sampling has to be
+// restarted and all windows started over for it
+//--------------------------------------------------------------------
+void samplerate_menu(void)
+{
+  static int8_t	current_selection = -1;
+
+  // Get Current value, nearest entry if set to something else by USB
+  if (current_selection < 0)
+  {
+    current_selection = 0;
+    while ((current_selection < samplerate_menu_size-1) && (samplerate_menu_timer[current_selection] > R.sample_timer))
+      current_selection++;
+  }
+
+  // Selection modified by encoder.  We remember last selection, even if exit and re-entry
+  if (Enc.read()/ENC_RESDIVIDE != 0)
+  {
+    if (Enc.read()/ENC_RESDIVIDE > 0)
+    {
+      current_selection++;
+    }
+    else if (Enc.read()/ENC_RESDIVIDE < 0)
+    {
+      current_selection--;
+    }
+    // Reset data from Encoder
+    Enc.write(0);
+
+    // Indicate that an LCD update is needed
+    flag.menu_lcd_upd = false;
+  }
+
+  // If LCD update is needed
+  if (!flag.menu_lcd_upd)
+  {
+    flag.menu_lcd_upd = true;					// We have serviced LCD
+
+    // Keep Encoder Selection Within Bounds of the Menu Size
+    uint8_t menu_size = samplerate_menu_size;
+    while(current_selection >= menu_size)
+      current_selection -= menu_size;
+    while(current_selection < 0)
+      current_selection += menu_size;
+
+    VirtLCDw.clear();
+    VirtLCDy.clear();
+    VirtLCDy.setCursor(0,0);
+    VirtLCDy.print("Samples per second:");
+
+    // Print the Rotary Encoder scroll Menu
+    lcd_scroll_Menu((char**)samplerate_menu_items, menu_size, current_selection, 1, 7,3);
+    VirtLCDy.setCursor(0,2);
+    VirtLCDy.print("Select");
+
+    VirtLCDw.setCursor(0,5);
+    VirtLCDw.print("Faster is finer PEP");
+    VirtLCDw.setCursor(0,6);
+    VirtLCDw.print("at more CPU load");
+  }
+
+  // Enact selection
+  if (flag.short_push)
+  {
+    VirtLCDw.clear();
+    VirtLCDy.clear();
+    VirtLCDy.setCursor(0,1);
+
+    flag.short_push = false;                    // Clear pushbutton status
+
+    // Check if selected rate is not same as previous
+    if (R.sample_timer != samplerate_menu_timer[current_selection])
+    {
+      pswr_sample_rate(samplerate_menu_timer[current_selection]);
+      EEPROM_writeAnything(1,R);
+      VirtLCDy.print("Value Stored");
+    }
+    else VirtLCDy.print("Nothing Changed");
+
+    Menu_exit_timer = 100;                      // Show on LCD for 1 second
+    flag.idle_refresh = true;                   // Force screensaver reprint upon exit
+    flag.config_mode = true;                    // Not done yet, bac to Config Menu
+    menu_level = 0;                             // We are done with this menu level
+    flag.menu_lcd_upd = false;                  // Make ready for next time
+    current_selection = -1;                     // Start from the active rate next time
+    VirtLCDw.transfer();
+    VirtLCDy.transfer();
+  }
+}
+
+
 //--------------------------------------------------------------------
 // Display Rotate.  Not really a Menu function
 //--------------------------------------------------------------------
@@ -1789,11 +1898,7 @@ void modscope_menu(void)
     VirtLCDw.setCursor(0,5);
     VirtLCDw.print("Available Scan Rates");
     VirtLCDw.setCursor(0,6);
-    #if F_CPU >= 144000000            // CPU is overclocked at 144 MHz
-    VirtLCDw.print("0.2 to 2 seconds");
-    #else                             // CPU is at normal speed
     VirtLCDw.print("0.3 to 3 seconds");
-    #endif
   }
 
   // Enact selection
@@ -1811,7 +1916,6 @@ void modscope_menu(void)
     {
       EEPROM_writeAnything(1,R);
       VirtLCDy.print("Value Stored");
-      ModScope.rate(R.modscopeDivisor);         // Update Modulation scope rate divisor
     }
     else                                        // Either 0 for Exit, or no change
     {
@@ -2436,28 +2540,32 @@ void menu_level0(void)
         menu_level = PEP_MENU;
         break;
 
-      case 3:                       // Display and Battery
+      case 3:                       // Sample rate select
+        menu_level = SAMPLERATE_MENU;
+        break;
+
+      case 4:                       // Display and Battery
         menu_level = DISPLAY_BATT_MENU;
         break;
       
-      case 4:                       // Scale Range Set
+      case 5:                       // Scale Range Set
         menu_level = SCALERANGE_MENU;
         break;
 
-      case 5:                       // Calibrate
+      case 6:                       // Calibrate
         menu_level = CAL_MENU;
         break;
 
-      case 6:                       // Display Debug stuff
+      case 7:                       // Display Debug stuff
         menu_level = DEBUG_MENU;
         break;
 
-      case 7:                       // Factory Reset
+      case 8:                       // Factory Reset
         menu_level = FACTORY_MENU;
         break;
 
       #if BATTERY_POWER  
-      case 8:                       // Shut Down
+      case 9:                       // Shut Down
         menu_level = POWEROFF_NOW;
         break;
       #endif
@@ -2477,36 +2585,40 @@ void menu_level0(void)
         menu_level = PEP_MENU;
         break;
 
-      case 3:                       // Display and Battery
+      case 3:                       // Sample rate select
+        menu_level = SAMPLERATE_MENU;
+        break;
+
+      case 4:                       // Display and Battery
         menu_level = DISPLAY_BATT_MENU;
         break;
       
-      case 4:                       // Scale Range Set
+      case 5:                       // Scale Range Set
         menu_level = SCALERANGE_MENU;
         break;
 
-      case 5:                       // Modulation Scope Scan Rate
+      case 6:                       // Modulation Scope Scan Rate
         menu_level = MODSCOPE_MENU;
         break;
 
-      case 6:                       // Calibrate
+      case 7:                       // Calibrate
         menu_level = CAL_MENU;
         break;
 
-      case 7:                       // Display Debug stuff
+      case 8:                       // Display Debug stuff
         menu_level = DEBUG_MENU;
         break;
 
-      case 8:                       // Display more Debug stuff
+      case 9:                       // Display more Debug stuff
         menu_level = DEBUG2_MENU;
         break;
 
-      case 9:                       // Factory Reset
+      case 10:                      // Factory Reset
         menu_level = FACTORY_MENU;
         break;
 
       #if BATTERY_POWER  
-      case 10:                      // Shut Down
+      case 11:                      // Shut Down
         menu_level = POWEROFF_NOW;
         break;          
       #endif
@@ -2549,6 +2661,7 @@ void ConfigMenu(void)
   else if (menu_level == SWR_ALARM_PWR_THRESHOLD) swr_alarm_power_threshold_menu();
 
   else if (menu_level == PEP_MENU) pep_menu();
+  else if (menu_level == SAMPLERATE_MENU) samplerate_menu();
 
   else if (menu_level == DISPLAY_BATT_MENU)      display_batt_menu();
   else if (menu_level == DISPLAYROTATE_MENU)     displayrotate_menu();
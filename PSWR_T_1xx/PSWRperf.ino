@@ -0,0 +1,422 @@
+//*********************************************************************************
+//**
+//** Project.........: A menu driven Multi Display RF Power and SWR Meter
+//**                   using a Tandem Match Coupler and 2x AD8307; or
+//**                   diode detectors.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+//
+//-----------------------------------------------------------------------------------------
+//      Cycle counter, free running at F_CPU
+//-----------------------------------------------------------------------------------------
+//
+void perf_cycle_counter_init(void)
+{
+  ARM_DEMCR |= ARM_DEMCR_TRCENA;                // Enable the DWT unit
+  ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;       // and its cycle counter
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Hot path profiler ($perf, $perfreset)
+//
+// Each scope keeps min, max, count and sum of CPU cycles, from PERF_BEGIN() to
+// PERF_END(), see PSWR_T.h.  The sampler scope is updated from interrupt context,
+// hence it is read and reset with interrupts disabled.
+//-----------------------------------------------------------------------------------------
+//
+perf_t perf[PERF_SCOPES];
+
+const char *perf_name[PERF_SCOPES] =
+{
+  "sampler", "sync", "swr", "touch", "usb",
+  "menu", "pk", "avg", "avg1s", "inst", "dbm", "mixed", "modscope", "keying", "ccdf"
+};
+
+void perf_add(uint8_t id, uint32_t cycles)
+{
+  perf_t *p = &perf[id];
+
+  if ((p->count == 0) || (cycles < p->min)) p->min = cycles;
+  if (cycles > p->max) p->max = cycles;
+  p->count++;
+  p->sum += cycles;
+}
+
+void perf_reset(void)
+{
+  noInterrupts();
+  memset(perf, 0, sizeof(perf));
+  interrupts();
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Print the profiler table, one key=value line per scope which has been run,
+//      times in microseconds
+//-----------------------------------------------------------------------------------------
+//
+void perf_print(void)
+{
+  perf_t p;
+
+  for (uint8_t x = 0; x < PERF_SCOPES; x++)
+  {
+    noInterrupts();
+    p = perf[x];
+    interrupts();
+    if (p.count == 0) continue;
+
+    Serial.print(F("perf scope="));
+    Serial.print(perf_name[x]);
+    Serial.print(F(" count="));
+    Serial.print(p.count);
+    Serial.print(F(" min_us="));
+    Serial.print(p.min * (1e6 / F_CPU), 2);
+    Serial.print(F(" avg_us="));
+    Serial.print((double) p.sum / p.count * (1e6 / F_CPU), 2);
+    Serial.print(F(" max_us="));
+    Serial.println(p.max * (1e6 / F_CPU), 2);
+  }
+}
+
+#if ISRMON_ENABLED
+//
+//-----------------------------------------------------------------------------------------
+//      Sampler interrupt monitor ($isrstat, $isrreset)
+//
+// Each sampler interrupt, timer polled or PDB, is timestamped at entry with the cycle
+// counter.  The time since the previous entry is compared with the nominal sample period,
+// and the deviation (jitter) goes into one histogram, the time spent in the interrupt
+// into another.  A gap of one and a half periods or more means that sample periods went
+// by without an interrupt, and those are counted as missed.  Lost samples are the missed
+// ones plus those dropped because the ring was full, see SpscRing::push().
+//-----------------------------------------------------------------------------------------
+//
+volatile isrmon_t isrmon;
+
+const uint16_t isrmon_edge_us[ISRMON_BINS-1] = { 2, 5, 10, 20, 50, 100, 200, 500 };
+uint32_t isrmon_edge[ISRMON_BINS-1];            // Histogram bin edges in CPU cycles
+
+void isrmon_init(uint32_t period_us)
+{
+  for (uint8_t x = 0; x < ISRMON_BINS-1; x++)
+    isrmon_edge[x] = isrmon_edge_us[x] * (F_CPU / 1000000);
+  noInterrupts();
+  isrmon.period = period_us * (F_CPU / 1000000);
+  isrmon.primed = false;                        // Next entry starts a new period
+  interrupts();
+}
+
+static inline uint8_t isrmon_bin(uint32_t cycles)
+{
+  uint8_t x = 0;
+  while ((x < ISRMON_BINS-1) && (cycles >= isrmon_edge[x])) x++;
+  return x;
+}
+
+void isrmon_add(uint32_t entry, uint32_t exit)
+{
+  uint32_t p, n, dev, dur;
+
+  if (isrmon.primed)
+  {
+    p = entry - isrmon.last;
+    n = (p + isrmon.period/2) / isrmon.period;  // Sample periods since previous entry
+    if (n > 1) isrmon.missed += n - 1;
+    if (n == 0) n = 1;
+    dev = (p > n * isrmon.period) ? p - n * isrmon.period : n * isrmon.period - p;
+    if (dev > isrmon.jitter_max) isrmon.jitter_max = dev;
+    isrmon.jitter[isrmon_bin(dev)]++;
+  }
+  isrmon.last = entry;
+  isrmon.primed = true;
+
+  dur = exit - entry;
+  if (dur > isrmon.dur_max) isrmon.dur_max = dur;
+  isrmon.dur[isrmon_bin(dur)]++;
+  isrmon.count++;
+}
+
+void isrmon_reset(void)
+{
+  noInterrupts();
+  isrmon.count = 0;
+  isrmon.missed = 0;
+  isrmon.jitter_max = 0;
+  isrmon.dur_max = 0;
+  isrmon.drops_base = measure.dropped();
+  for (uint8_t x = 0; x < ISRMON_BINS; x++) isrmon.jitter[x] = isrmon.dur[x] = 0;
+  isrmon.primed = false;
+  interrupts();
+  flag.samples_dropped = false;
+}
+
+//-----------------------------------------------------------------------------------------
+// Samples lost since last reset, missed by the interrupt or dropped by a full ring
+uint32_t isrmon_lost(void)
+{
+  uint32_t missed;
+
+  noInterrupts();
+  missed = isrmon.missed;
+  interrupts();
+  return missed + measure.dropped() - isrmon.drops_base;
+}
+
+//-----------------------------------------------------------------------------------------
+// Raise the SAMPLES DROPPED flag, called from the main loop
+void isrmon_check(void)
+{
+  if (isrmon_lost()) flag.samples_dropped = true;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Print the interrupt monitor, a summary line and one line per histogram,
+//      times in microseconds, e.g:
+//
+// isr backend=pdb count=90210 missed=0 dropped=0 jitter_max_us=1.21 dur_max_us=3.40
+// isr hist=jitter_us <2=90209 <5=0 <10=0 <20=0 <50=0 <100=0 <200=0 <500=0 >=500=0
+//-----------------------------------------------------------------------------------------
+//
+void isrmon_print_hist(const char *name, volatile uint32_t *hist)
+{
+  uint32_t h[ISRMON_BINS];
+
+  noInterrupts();
+  for (uint8_t x = 0; x < ISRMON_BINS; x++) h[x] = hist[x];
+  interrupts();
+
+  Serial.print(F("isr hist="));
+  Serial.print(name);
+  for (uint8_t x = 0; x < ISRMON_BINS; x++)
+  {
+    Serial.print(x < ISRMON_BINS-1 ? F(" <") : F(" >="));
+    Serial.print(isrmon_edge_us[x < ISRMON_BINS-1 ? x : x-1]);
+    Serial.print(F("="));
+    Serial.print(h[x]);
+  }
+  Serial.println();
+}
+
+void isrmon_print(void)
+{
+  uint32_t count, missed, jitter_max, dur_max;
+
+  noInterrupts();
+  count = isrmon.count;
+  missed = isrmon.missed;
+  jitter_max = isrmon.jitter_max;
+  dur_max = isrmon.dur_max;
+  interrupts();
+
+  if (flag.samples_dropped) Serial.println(F("SAMPLES DROPPED"));
+  Serial.print(F("isr backend="));
+  Serial.print(acq->name());
+  Serial.print(F(" count="));
+  Serial.print(count);
+  Serial.print(F(" missed="));
+  Serial.print(missed);
+  Serial.print(F(" dropped="));
+  Serial.print(measure.dropped() - isrmon.drops_base);
+  Serial.print(F(" jitter_max_us="));
+  Serial.print(jitter_max * (1e6 / F_CPU), 2);
+  Serial.print(F(" dur_max_us="));
+  Serial.println(dur_max * (1e6 / F_CPU), 2);
+  isrmon_print_hist("jitter_us", isrmon.jitter);
+  isrmon_print_hist("dur_us", isrmon.dur);
+}
+#endif
+
+//
+//-----------------------------------------------------------------------------------------
+//      Benchmark the per sample pipeline stages ($bench)
+//
+// Sampling is stopped, and each stage is run over BENCH_RUNS blocks of simulated two
+// tone input, see AcqSimulated.  One line per stage is printed in key=value format,
+// along with the build configuration, for comparison between builds, e.g:
+//
+// bench stage=power ad8307=1 twentytoone=0 sample_timer=667 f_cpu=96000000 n=2048 cycles=... ns=...
+//
+// ns is per sample, or per call for the swr stage, which runs once every POLL_TIMER.
+// The analyses of the power (distribution, burst log, quantiles, needle, history)
+// are held meanwhile, so that the simulated samples do not end up in their results,
+// and the power stage does not include them.  Peak, PEP and LONG windows are
+// restarted afterwards, as the bench has fed them with simulated data.
+//
+// The host benchmarks (host/bench) time the analyses, every detector and coupler
+// build, and the PM firmware, and count allocations, of which there are none.
+//-----------------------------------------------------------------------------------------
+//
+#define BENCH_RUNS                8           // Blocks of AD_BLOCK samples per stage
+
+uint32_t bench_ad[AD_BLOCK];                  // Block of simulated AD value pairs
+uint16_t bench_n;                             // Number of pairs in block
+
+void bench_feed(uint32_t pair)
+{
+  if (bench_n < AD_BLOCK) bench_ad[bench_n++] = pair;
+}
+
+void bench_print(const char *stage, uint32_t n, uint32_t cycles)
+{
+  Serial.print(F("bench stage="));
+  Serial.print(stage);
+  Serial.print(F(" ad8307="));
+  Serial.print(AD8307_INSTALLED);
+  Serial.print(F(" twentytoone="));
+  Serial.print(TWENTYTOONE);
+  Serial.print(F(" sample_timer="));
+  Serial.print(R.sample_timer);
+  Serial.print(F(" f_cpu="));
+  Serial.print(F_CPU);
+  Serial.print(F(" n="));
+  Serial.print(n);
+  Serial.print(F(" cycles="));
+  Serial.print(cycles);
+  Serial.print(F(" ns="));
+  Serial.println(cycles * (1e9 / F_CPU) / n, 1);
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Fast dB conversions against libm, see PSWRfastmath.h.  Speed as bench stages,
+//      and the max error over -100 to +100 dBm in 0.01 dB steps, e.g:
+//
+// bench math=lin_to_db err_max_db=0.000054
+//-----------------------------------------------------------------------------------------
+//
+#define BENCH_MATH_N           1000           // Conversions per stage, 0.2 dB apart
+
+void bench_math_err(const char *conv, double err)
+{
+  Serial.print(F("bench math="));
+  Serial.print(conv);
+  Serial.print(F(" err_max_db="));
+  Serial.println(err, 6);
+}
+
+void bench_math(void)
+{
+  volatile double sink;                       // Keep the compiler from dropping the loops
+  double   mw, db, e;
+  double   err_lin_to_db = 0, err_db_to_lin = 0;
+  uint32_t t;
+
+  // 10 x log10(), from -100 to +100 dBm
+  mw = 1e-10;
+  t = ARM_DWT_CYCCNT;
+  for (uint16_t x = 0; x < BENCH_MATH_N; x++, mw *= 1.0471285) sink = 10 * log10(mw);
+  bench_print("lin_to_db_libm", BENCH_MATH_N, ARM_DWT_CYCCNT - t);
+  mw = 1e-10;
+  t = ARM_DWT_CYCCNT;
+  for (uint16_t x = 0; x < BENCH_MATH_N; x++, mw *= 1.0471285) sink = fast_lin_to_db(mw);
+  bench_print("lin_to_db_fast", BENCH_MATH_N, ARM_DWT_CYCCNT - t);
+
+  // 10^(x/10), from -100 to +100 dBm
+  db = -100;
+  t = ARM_DWT_CYCCNT;
+  for (uint16_t x = 0; x < BENCH_MATH_N; x++, db += 0.2) sink = pow(10, db/10.0);
+  bench_print("db_to_lin_libm", BENCH_MATH_N, ARM_DWT_CYCCNT - t);
+  db = -100;
+  t = ARM_DWT_CYCCNT;
+  for (uint16_t x = 0; x < BENCH_MATH_N; x++, db += 0.2) sink = fast_db_to_lin(db);
+  bench_print("db_to_lin_fast", BENCH_MATH_N, ARM_DWT_CYCCNT - t);
+  (void) sink;
+
+  // Max error, in dB
+  for (int16_t x = DB100_MIN; x <= DB100_MAX; x++)
+  {
+    db = x / 100.0;
+    mw = pow(10, db/10.0);
+    e = fabs(fast_lin_to_db(mw) - db);
+    if (err_lin_to_db < e) err_lin_to_db = e;
+    e = fabs(10 * log10(fast_db_to_lin(db)) - db);
+    if (err_db_to_lin < e) err_db_to_lin = e;
+  }
+  bench_math_err("lin_to_db", err_lin_to_db);
+  bench_math_err("db_to_lin", err_db_to_lin);
+}
+
+void perf_bench(void)
+{
+  AcqSimulated sim;
+  uint32_t t;
+  uint32_t n = 0;                             // Samples processed by each stage
+  uint32_t c_decode = 0, c_power = 0, c_scope = 0, c_swr = 0;
+
+  acq->end();                                 // Stop sampling
+  pswr_analyses_hold(true);                   // Keep the simulated samples out of the analyses
+  perf_cycle_counter_init();
+  sim.signal(AcqSimulated::TWOTONE, 3000, 2000, 1000, 3);
+  sim.begin(bench_feed, R.sample_timer);
+
+  for (uint8_t r = 0; r < BENCH_RUNS; r++)
+  {
+    bench_n = 0;
+    sim.run(AD_BLOCK);
+    n += bench_n;
+
+    // AD decode and dBm conversion, nothing if Diode detectors
+    t = ARM_DWT_CYCCNT;
+    kernel.decode(bench_ad, bench_n);
+    c_decode += ARM_DWT_CYCCNT - t;
+
+    // Instantaneous power, decimation, peak, PEP, LONG and averages
+    t = ARM_DWT_CYCCNT;
+    for (uint16_t x = 0; x < bench_n; x++)
+    {
+      fwd = bench_ad[x];
+      rev = bench_ad[x] >> 16;
+      determine_power_pep_pk(x);
+    }
+    c_power += ARM_DWT_CYCCNT - t;
+
+    // Modulation Scope feed, decimated to the scan rate
+    t = ARM_DWT_CYCCNT;
+    for (uint16_t x = 0; x < bench_n; x++)
+    {
+      pswr_scope_feed();
+    }
+    c_scope += ARM_DWT_CYCCNT - t;
+
+    // SWR and derived power values, once per block
+    t = ARM_DWT_CYCCNT;
+    calc_SWR_and_power();
+    c_swr += ARM_DWT_CYCCNT - t;
+  }
+
+  #if AD8307_INSTALLED
+  bench_print("decode", n, c_decode);
+  #endif
+  bench_print("power", n, c_power);
+  bench_print("modscope", n, c_scope);
+  bench_print("swr", BENCH_RUNS, c_swr);
+  bench_math();
+
+  pswr_window_reset();                        // Forget the simulated data
+  pswr_analyses_hold(false);
+  #if ISRMON_ENABLED
+  isrmon_init(R.sample_timer);                // The pause is not a missed sample
+  #endif
+  acq->begin(ad_feed, R.sample_timer);        // and resume sampling
+}
@@ -0,0 +1,162 @@
+//*********************************************************************************
+//**
+//** Streaming quantile estimators, P-square algorithm (R. Jain and I. Chlamtac,
+//** "The P2 Algorithm for Dynamic Calculation of Quantiles and Histograms Without
+//** Storing Observations", Communications of the ACM, 1985).
+//**
+//** Five markers are kept, the minimum, the p/2, p and (1+p)/2 quantiles and the
+//** maximum.  Each observation moves the marker positions, and the three middle
+//** markers are adjusted towards their desired positions by piecewise parabolic
+//** (or, failing that, linear) interpolation.  O(1) per observation, about 60
+//** bytes per quantile, no observations stored.
+//**
+//** P2Quantiles tracks the median, P90 and P99 of one quantity.  The estimators
+//** are not windowed as such, the caller takes the result at the end of each
+//** window and starts over.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRquantile_h_
+#define _PSWRquantile_h_
+
+#include <stdint.h>
+
+class P2Quantile
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Start over, estimating the p quantile, 0 < p < 1
+    void init(float p)
+    {
+      prob = p;
+      n = 0;
+      rate[0] = p/2 * 4294967296.0f;
+      rate[1] = p * 4294967296.0f;
+      rate[2] = (1 + p)/2 * 4294967296.0f;
+    }
+    //------------------------------------------------------------------------------
+    // Add one observation
+    void add(float x)
+    {
+      uint8_t i, k;
+
+      if (n < 5)                        // The first five are kept as they are, sorted
+      {
+        for (i = n++; (i > 0) && (q[i-1] > x); i--) q[i] = q[i-1];
+        q[i] = x;
+        if (n == 5) for (i = 0; i < 5; i++) pos[i] = i + 1;
+        return;
+      }
+
+      // Cell k holding x, extend the extremes if needed
+      if (x < q[0])
+      {
+        q[0] = x;
+        k = 0;
+      }
+      else if (x >= q[4])
+      {
+        q[4] = x;
+        k = 3;
+      }
+      else for (k = 0; x >= q[k+1]; k++) ;
+
+      // Markers above the cell move up
+      for (i = k + 1; i < 5; i++) pos[i]++;
+      n++;
+
+      // Adjust the middle markers, if off their desired positions by one or more.
+      // The desired positions are worked out from the count each time, in 32.32
+      // fixed point.  A float sum of the steps would drift away once it grows
+      // large next to them, and so would the float difference of two large values.
+      for (i = 1; i < 4; i++)
+      {
+        float   d = (int64_t) ((uint64_t) (n - 1) * rate[i-1] + (1ULL << 32) - ((uint64_t) pos[i] << 32))
+                    * (1 / 4294967296.0f);
+        int32_t s;
+        float   h;
+
+        if (((d >= 1) && (pos[i+1] - pos[i] > 1)) || ((d <= -1) && (pos[i-1] - pos[i] < -1)))
+        {
+          s = (d > 0) ? 1 : -1;
+          h = parabolic(i, s);
+          if ((q[i-1] < h) && (h < q[i+1])) q[i] = h;
+          else q[i] += s * (q[i+s] - q[i]) / (pos[i+s] - pos[i]);
+          pos[i] += s;
+        }
+      }
+    }
+    //------------------------------------------------------------------------------
+    // Observations so far, and the estimate, 0 if none
+    uint32_t count(void) { return n; }
+    float value(void)
+    {
+      if (n >= 5) return q[2];
+      return n ? q[(uint8_t) (prob * (n - 1) + 0.5f)] : 0;
+    }
+
+  private:
+    float parabolic(uint8_t i, int32_t s)
+    {
+      return q[i] + (float) s / (pos[i+1] - pos[i-1]) *
+             ((pos[i] - pos[i-1] + s) * (q[i+1] - q[i]) / (pos[i+1] - pos[i]) +
+              (pos[i+1] - pos[i] - s) * (q[i] - q[i-1]) / (pos[i] - pos[i-1]));
+    }
+
+    float    prob;                      // Quantile estimated
+    uint32_t n;                         // Observations
+    float    q[5];                      // Marker heights
+    int32_t  pos[5];                    // Marker positions, 1 based
+    uint32_t rate[3];                   // Desired positions of the middle markers, per observation, 0.32
+};
+
+typedef struct {
+          float    p50, p90, p99;       // Median, P90 and P99
+          uint32_t n;                   // Observations, 0 if none within the window
+               }  quant_t;
+
+class P2Quantiles
+{
+  public:
+    void init(void)
+    {
+      q50.init(0.50);
+      q90.init(0.90);
+      q99.init(0.99);
+    }
+    void add(float x)
+    {
+      q50.add(x);
+      q90.add(x);
+      q99.add(x);
+    }
+    void result(quant_t &r)
+    {
+      r.p50 = q50.value();
+      r.p90 = q90.value();
+      r.p99 = q99.value();
+      r.n   = q50.count();
+    }
+
+  private:
+    P2Quantile q50, q90, q99;
+};
+
+#endif
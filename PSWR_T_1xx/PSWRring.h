@@ -0,0 +1,104 @@
+//*********************************************************************************
+//**
+//** Single producer / single consumer ring buffer, carrying the sampled adc-input
+//** pairs from the interrupt function to the main loop.
+//**
+//** The producer (interrupt function) only ever writes head, and the consumer
+//** (main loop) only ever writes tail.  Each side publishes its index with release
+//** semantics after it is done with the entries, and reads the other side's index
+//** with acquire semantics before it touches them.  Hence neither side ever needs
+//** to disable interrupts.  A full ring drops the newest sample rather than
+//** overwriting unread ones, and the drop is counted.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRring_h_
+#define _PSWRring_h_
+
+#include <stdint.h>
+
+template <typename T, uint16_t DEPTH>
+class SpscRing
+{
+  static_assert(DEPTH >= 2 && (DEPTH & (DEPTH - 1)) == 0, "SpscRing depth has to be a power of two");
+
+  public:
+    //------------------------------------------------------------------------------
+    // Producer side, only to be called from the interrupt function.
+    // Returns false, and counts a drop, if the ring is full.
+    bool push(T value)
+    {
+      uint32_t h = head;                                  // Our own index, no ordering needed
+      uint32_t used = h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+      if (used >= DEPTH)
+      {
+        drops++;
+        return false;
+      }
+      buf[h & (DEPTH - 1)] = value;
+      __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);   // Publish entry to the consumer
+      if (used + 1 > hiwater) hiwater = used + 1;
+      return true;
+    }
+    //------------------------------------------------------------------------------
+    // Consumer side, only to be called from the main loop.
+    // Number of entries waiting, also updates the max lag seen by the consumer
+    uint16_t available(void)
+    {
+      uint16_t used = __atomic_load_n(&head, __ATOMIC_ACQUIRE) - tail;
+      if (used > maxlag) maxlag = used;
+      return used;
+    }
+    // Pointer to the oldest entry waiting, and the number of entries which can be
+    // read from there in one contiguous block, up to the end of the ring
+    uint16_t block(const T **p)
+    {
+      uint16_t used = available();
+      uint16_t pos  = tail & (DEPTH - 1);
+      *p = &buf[pos];
+      if (used > DEPTH - pos) used = DEPTH - pos;
+      return used;
+    }
+    // Hand n consumed entries back to the producer
+    void release(uint16_t n) { __atomic_store_n(&tail, tail + n, __ATOMIC_RELEASE); }
+    //------------------------------------------------------------------------------
+    // Statistics
+    uint16_t depth(void)    { return DEPTH; }
+    uint32_t dropped(void)  { return __atomic_load_n(&drops, __ATOMIC_RELAXED); }
+    uint16_t highwater(void){ return __atomic_load_n(&hiwater, __ATOMIC_RELAXED); }
+    uint16_t lag(void)      { return __atomic_load_n(&head, __ATOMIC_RELAXED) - tail; }
+    uint16_t lagmax(void)   { return maxlag; }
+    void     clear_stats(void)
+    {
+      __atomic_store_n(&drops, 0, __ATOMIC_RELAXED);  // A drop racing with this is lost, which is harmless
+      __atomic_store_n(&hiwater, 0, __ATOMIC_RELAXED);
+      maxlag = 0;
+    }
+
+  private:
+    T        buf[DEPTH];                // Ring storage
+    uint32_t head;                      // Free running count of entries written, producer owned
+    uint32_t tail;                      // Free running count of entries read, consumer owned
+    uint32_t drops;                     // Samples dropped because the ring was full
+    uint16_t hiwater;                   // Highest fill level seen by the producer
+    uint16_t maxlag;                    // Highest fill level seen by the consumer
+};
+
+#endif
@@ -314,7 +314,7 @@ void VSWRmeter::drawscale(int16_t colour)
   // Draw the Scale
   for (uint8_t i = 0; i < 10; i++)         // Draw full size scale ticks and numbers
   { 
-    offs = x+1 + len * log10(scalemark[i]);
+    offs = x+1 + len * fast_log10(scalemark[i]);
     tft.drawFastVLine(offs, y+height+2, 5, colour);
 
     if ((scalemark[i] < 10) &&             // Decide whether we have subdecimals or not
@@ -332,7 +332,7 @@ void VSWRmeter::drawscale(int16_t colour)
   }
   for (uint8_t i = 0; i < 20; i++)         // Draw half size scale ticks
   {
-    offs = x+1 + len * log10(scaletick[i]);
+    offs = x+1 + len * fast_log10(scaletick[i]);
     tft.drawFastVLine(offs, y+height+2, 3, colour);
   }
 }
@@ -361,8 +361,8 @@ void VSWRmeter::graph(double mid, double high, double swr)
     swr = 1.0;                                    // Set SWR at 1.0:1 (eq. 0)                 
 
     // Prepare scale thresholds
-    scalemid  = len * log10(mid);                 // Recalculate Mid and High threshold in bar lengths
-    scalehigh = len * log10(high);
+    scalemid  = len * fast_log10(mid);            // Recalculate Mid and High threshold in bar lengths
+    scalehigh = len * fast_log10(high);
     lastlow = scalemid;                           // Set previous value as the highest
     lastmid = scalehigh-scalemid;                 // possible value, to force a redraw
     lasthigh = len-scalehigh;
@@ -372,7 +372,7 @@ void VSWRmeter::graph(double mid, double high, double swr)
   
   // Prepare input values
   if (swr > 10) swr = 10;
-  barlow  = len * log10(swr);                     // Determine overall bar length
+  barlow  = len * fast_log10(swr);                // Determine overall bar length
   barhigh = barlow - scalehigh;                   // Determine length of high bar
   if (barhigh < 0) barhigh = 0;
   if (barhigh > 0) barmid = scalehigh - scalemid; // Determine length of mid bar
@@ -451,10 +451,6 @@ void ModulationScope::erase(void)
     drawn = false;   
   }
 }
-void ModulationScope::rate(int16_t rate)
-{  
-  rateDivisor = rate;
-}
 
 //
 //-----------------------------------------------------------------------------------------
@@ -463,35 +459,29 @@ void ModulationScope::rate(int16_t rate)
 //
 void ModulationScope::adddata(double level, double fullscale)
 {
-  if (rateCount <= 0)                           // Only add data every 1/rateDivisor time.
-  {
-    rateCount = rateDivisor;
-              
-    if (fullscale < level) fullscale = level;   // Set sane limits
+  if (fullscale < level) fullscale = level;     // Set sane limits
     
-    switch (R.low_power_floor)                  // Set minimum fullscale at 50x selected Low Power Floor
-    {
-      case FLOOR_TEN_mW:
-        if (fullscale<500.0) fullscale = 500.0; // 500 mW
-        break;
-      case FLOOR_ONE_mW:
-        if (fullscale < 50.0) fullscale = 50.0; // 50 mW
-        break;
-      case FLOOR_100_uW:
-        if (fullscale < 5) fullscale = 5;       // 5 mW
-        break;
-      case FLOOR_TEN_uW:
-        if (fullscale < 0.5) fullscale = 0.5;   // 500 uW
-        break;
-      case FLOOR_ONE_uW:
-      default:
-        if (fullscale < .05) fullscale = .05;   // 50 uW      
-    }    
-
-    newdata[in_pos++] = level/fullscale*y_max;  // Prepare and store incoming level
-    if (in_pos >= len) in_pos = 0; 
-  }
-  rateCount--; 
+  switch (R.low_power_floor)                    // Set minimum fullscale at 50x selected Low Power Floor
+  {
+    case FLOOR_TEN_mW:
+      if (fullscale<500.0) fullscale = 500.0;   // 500 mW
+      break;
+    case FLOOR_ONE_mW:
+      if (fullscale < 50.0) fullscale = 50.0;   // 50 mW
+      break;
+    case FLOOR_100_uW:
+      if (fullscale < 5) fullscale = 5;         // 5 mW
+      break;
+    case FLOOR_TEN_uW:
+      if (fullscale < 0.5) fullscale = 0.5;     // 500 uW
+      break;
+    case FLOOR_ONE_uW:
+    default:
+      if (fullscale < .05) fullscale = .05;     // 50 uW      
+  }    
+
+  newdata[in_pos++] = level/fullscale*y_max;    // Prepare and store incoming level
+  if (in_pos >= len) in_pos = 0; 
 }
 
 //
@@ -519,7 +509,7 @@ void ModulationScope::update(void)
        
   draw();                                      // Draw scope widget if need be
   
-  while (out_pos != in_pos)                    // Only draw every 1/rateDivisor time.
+  while (out_pos != in_pos)                    // Draw all data pending in the circular buffer
   {
  
     if (newdata[out_pos] > olddata[out_pos])   // Draw/Add Above y0
@@ -47,7 +47,7 @@ class PowerMeter
     // Draw, Redraw or Erase Meter Scale.  range provides optinal unit information, such as "mW", "W", "kW"
     // input argument is a number from 1.0 and up, divided into 10  or 11 segments (11 if (scale*10)%11=0 )
     void scale(double s, char *range);      // Scale Erases if required and then draws everything
-    void scale(double s) { scale(s, '\0'); }// Blank if no scale range string
+    void scale(double s) { scale(s, (char *) ""); }// Blank if no scale range string
     void erase(void);                       // Erases everything
     //------------------------------------------------------------------------------
     // Draw Meter Graph
@@ -132,11 +132,8 @@ class ModulationScope
     // Erase the scope widget
     void erase(void);
     //------------------------------------------------------------------------------
-    // Update rate divisor
-    void rate(int16_t);
-    //------------------------------------------------------------------------------
-    // Add one measurement to the x axis sweep (run from within interrupt function)
-    // input arguments are level and fullscale
+    // Add one measurement to the x axis sweep, input arguments are level and fullscale.
+    // Fed at the scan rate, already decimated, see pswr_scope_feed()
     void adddata(double, double);
 
   private:
@@ -158,8 +155,6 @@ class ModulationScope
     int16_t in_pos;                 // Two circular buffer pointers
     int16_t out_pos;                // this one is also current position on the x axis
     int16_t olddata[SCOPE_BUFSIZE]; // Current data on the scope - to add or subtract from...
-    int16_t rateDivisor=1;          // Rate divisor other than 1 results in only every n_th request drawn
-    int16_t rateCount;
     bool    erased = false;         // Keep track of whether scope needs to be erased
     bool    drawn  = false;         // Keep track of whether scope needs to be redrawn
 
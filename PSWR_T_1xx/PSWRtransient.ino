@@ -0,0 +1,198 @@
+//*********************************************************************************
+//**
+//** Project.........: A menu driven Multi Display RF Power and SWR Meter
+//**                   using a Tandem Match Coupler and 2x AD8307; or
+//**                   diode detectors.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#if CAPTURE_ENABLED && ADC_PDB_ENABLED
+//
+//-----------------------------------------------------------------------------------------
+//      High rate transient capture ($burst)
+//
+// Normal sampling is stopped and the builtin ADCs are set up for speed, no hardware
+// averaging and high speed conversion, then triggered by the PDB every CAPTURE_TIMER
+// microseconds, using the same acquisition backend and the conversion complete
+// interrupt as for normal sampling, but feeding the capture buffer instead of the ring.
+//
+// While armed, pairs are written into the capture buffer round robin.  The trigger is
+// the first pair where either direction reaches the threshold power.  Up to 1/8 of the
+// buffer is kept from before the trigger, the rest is filled after it.  Then the main
+// loop restores the ADCs, resumes normal sampling and dumps the buffer over USB.
+// Last, the buffer is run through a CW keying analyzer, CAPTURE_CHUNK pairs per main
+// loop pass, the results are retrieved by the $keying USB command.
+//
+// Dump format, a text header line, the pairs in binary and a text trailer line:
+//
+//   burst n=<pairs> period_us=<us> trigger=<index of trigger pair> ad_fwd=<threshold AD> ad_rev=<threshold AD>\r\n
+//   <n x 4 bytes, little endian, Forward AD value in lower and Reverse in upper 16 bits>
+//   \r\nburst end\r\n
+//-----------------------------------------------------------------------------------------
+//
+#define CAPTURE_IDLE           0              // Normal metering
+#define CAPTURE_ARMED          1              // Waiting for trigger
+#define CAPTURE_RUNNING        2              // Triggered, filling the buffer
+#define CAPTURE_DONE           3              // Buffer full, waiting for the main loop
+#define CAPTURE_ANALYZE        4              // Dumped, keying analysis in progress
+
+typedef struct {
+          volatile uint8_t  state;            // One of the above
+          uint16_t n;                         // Pairs to capture
+          volatile uint16_t w;                // Next write position, round robin
+          volatile uint16_t pre;              // Pairs kept from before and including the trigger
+          volatile uint16_t post;             // Pairs remaining to be captured after the trigger
+          uint16_t r;                         // Pairs analyzed, oldest first
+          uint16_t ad_fwd, ad_rev;            // Trigger thresholds, AD values
+          uint32_t t_armed;                   // millis() when armed
+               }  capture_t;
+
+capture_t capture;
+uint32_t  capture_buf[CAPTURE_BUFFER];        // Packed fwd/rev AD pairs, same as the sample ring
+KeyingAnalyzer capture_keying;                // CW keying waveform, from the capture buffer
+
+//-----------------------------------------------------------------------------------------
+// Feed function, run from the ADC1 conversion complete interrupt
+void capture_feed(uint32_t pair)
+{
+  uint16_t w;
+
+  if (capture.state == CAPTURE_DONE) return;
+
+  w = capture.w;
+  capture_buf[w] = pair;
+  if (++w >= capture.n) w = 0;
+  capture.w = w;
+
+  if (capture.state == CAPTURE_ARMED)
+  {
+    if (capture.pre < capture.n/8) capture.pre++;
+    if (((pair & 0xffff) >= capture.ad_fwd) || ((pair >> 16) >= capture.ad_rev))
+    {
+      capture.post  = capture.n - capture.pre;
+      capture.state = CAPTURE_RUNNING;
+    }
+  }
+  else if (--capture.post == 0) capture.state = CAPTURE_DONE;
+}
+
+//-----------------------------------------------------------------------------------------
+// Arm a capture of n pairs, triggered at mw milliwatts.  Returns false if not possible
+bool capture_start(uint16_t n, double mw)
+{
+  if ((capture.state != CAPTURE_IDLE) || (acq != &acq_pdb)) return false;  // Not with AD7991
+  if ((n < 16) || (n > CAPTURE_BUFFER)) return false;
+
+  acq->end();                                 // Stop normal sampling
+  capture.n      = n;
+  capture.w      = 0;
+  capture.pre    = 0;
+  capture.post   = 0;
+  capture.ad_fwd = kernel.ad_at(mw, false);
+  capture.ad_rev = kernel.ad_at(mw, true);
+  capture.r      = 0;
+  capture.t_armed = millis();
+  capture.state  = CAPTURE_ARMED;
+  capture_keying.init(CAPTURE_TIMER);
+  capture_keying.threshold(max(lround(100 * fast_lin_to_db(mw)), KEYING_FLOOR));
+
+  adc->adc0->setAveraging(0);                 // No hardware averaging
+  adc->adc1->setAveraging(0);
+  adc->adc0->setSamplingSpeed(ADC_SAMPLING_SPEED::HIGH_SPEED);
+  adc->adc1->setSamplingSpeed(ADC_SAMPLING_SPEED::HIGH_SPEED);
+  adc->adc0->setConversionSpeed(ADC_CONVERSION_SPEED::HIGH_SPEED);
+  adc->adc1->setConversionSpeed(ADC_CONVERSION_SPEED::HIGH_SPEED);
+  acq_pdb.begin(capture_feed, CAPTURE_TIMER);
+  return true;
+}
+
+//-----------------------------------------------------------------------------------------
+// Restore the ADCs and resume normal sampling
+void capture_stop(void)
+{
+  acq_pdb.end();
+  adc_init();
+  acq_start();
+}
+
+//-----------------------------------------------------------------------------------------
+// Dump the capture buffer, oldest pair first
+void capture_dump(void)
+{
+  uint16_t w = capture.w;                     // Oldest pair, the buffer is full
+
+  Serial.print(F("burst n="));
+  Serial.print(capture.n);
+  Serial.print(F(" period_us="));
+  Serial.print(CAPTURE_TIMER);
+  Serial.print(F(" trigger="));
+  Serial.print(capture.pre - 1);
+  Serial.print(F(" ad_fwd="));
+  Serial.print(capture.ad_fwd);
+  Serial.print(F(" ad_rev="));
+  Serial.print(capture.ad_rev);
+  Serial.print(F("\r\n"));
+  Serial.write((const uint8_t *) &capture_buf[w], (capture.n - w) * sizeof(uint32_t));
+  Serial.write((const uint8_t *) &capture_buf[0], w * sizeof(uint32_t));
+  Serial.print(F("\r\nburst end\r\n"));
+}
+
+//-----------------------------------------------------------------------------------------
+// Run the next part of the capture buffer, oldest pair first, through the keying analyzer
+void capture_analyze(void)
+{
+  uint16_t end = min(capture.r + CAPTURE_CHUNK, capture.n);
+  uint16_t x = capture.r + capture.w;         // Buffer position of pair r
+
+  kernel.check(R, adc_ref);
+  for (; capture.r < end; capture.r++, x++)
+  {
+    if (x >= capture.n) x -= capture.n;
+    capture_keying.add(kernel.db100(capture_buf[x]));
+  }
+  if (capture.r == capture.n)
+  {
+    capture_keying.flush();                   // Key down until the end of the buffer
+    capture.state = CAPTURE_IDLE;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+// Called from the main loop.  Once the buffer is full, or if no trigger within
+// CAPTURE_TIMEOUT, normal metering is resumed
+void capture_poll(void)
+{
+  if (capture.state == CAPTURE_IDLE) return;
+
+  if ((capture.state == CAPTURE_ARMED) && (millis() - capture.t_armed > CAPTURE_TIMEOUT))
+  {
+    capture_stop();
+    capture.state = CAPTURE_IDLE;
+    Serial.println(F("burst timeout"));
+  }
+  else if (capture.state == CAPTURE_DONE)
+  {
+    capture_stop();
+    capture_dump();
+    capture.state = CAPTURE_ANALYZE;
+  }
+  else if (capture.state == CAPTURE_ANALYZE) capture_analyze();
+}
+#endif
@@ -160,7 +160,7 @@ void usb_poll_avgdb(void)
 {
   //------------------------------------------
   // Power indication, 100ms average power, formatted, dB
-  print_dbm((int16_t) (log10(power_mw_avg)*100.0));
+  print_dbm((int16_t) (fast_lin_to_db(power_mw_avg)*10.0));
   Serial.print(lcd_buf);
   //------------------------------------------
   // SWR indication
@@ -172,7 +172,7 @@ void usb_poll_1savgdb(void)
 {
   //------------------------------------------
   // Power indication, 1s average power, formatted, dB
-  print_dbm((int16_t) (log10(power_mw_1savg)*100.0));
+  print_dbm((int16_t) (fast_lin_to_db(power_mw_1savg)*10.0));
   Serial.print(lcd_buf);
   //------------------------------------------
   // SWR indication
@@ -187,6 +187,31 @@ void usb_poll_1savgdb(void)
 //                      Long and Human Readable Format
 //-----------------------------------------------------------------------------------------
 //
+// Prints median, P90 and P99 of one window, power in mW or SWR, "-" if no observations
+void usb_print_quant(const quant_t &q, bool power)
+{
+  if (q.n == 0) Serial.print(F("-"));
+  else if (power)
+  {
+    print_p_mw(q.p50);
+    Serial.print(lcd_buf);
+    Serial.print(F(", "));
+    print_p_mw(q.p90);
+    Serial.print(lcd_buf);
+    Serial.print(F(", "));
+    print_p_mw(q.p99);
+    Serial.print(lcd_buf);
+  }
+  else
+  {
+    Serial.print(q.p50,2);
+    Serial.print(F(", "));
+    Serial.print(q.p90,2);
+    Serial.print(F(", "));
+    Serial.print(q.p99,2);
+  }
+}
+
 void usb_poll_long(void)
 {
   //------------------------------------------
@@ -229,6 +254,25 @@ void usb_poll_long(void)
   Serial.print(F("VSWR"));
   print_swr();
   Serial.println(lcd_buf);
+
+  //------------------------------------------
+  // Median, P90 and P99 of Forward Power and SWR while transmitting, 1s, PEP and 30s windows
+  Serial.println(F("Forward Power (median, P90, P99; 1s, PEP, 30s):"));
+  for (uint8_t w = 0; w < QWINDOWS; w++)
+  {
+    usb_print_quant(fwd_q[w], true);
+    Serial.print((w < QWINDOWS-1) ? F("; ") : F("\r\n"));
+  }
+  Serial.println(F("VSWR (median, P90, P99; 1s, PEP, 30s):"));
+  for (uint8_t w = 0; w < QWINDOWS; w++)
+  {
+    usb_print_quant(swr_q[w], false);
+    Serial.print((w < QWINDOWS-1) ? F("; ") : F("\r\n"));
+  }
+
+  //------------------------------------------
+  // Lost samples, PEP and Peak values may be low
+  if (flag.samples_dropped) Serial.println(F("SAMPLES DROPPED"));
   Serial.println();
 }
 
@@ -242,6 +286,208 @@ void usb_poll_ad_debug(void)
   Serial.println(rev);
 }
 //------------------------------------------
+// Prints statistics for the ring buffer carrying samples from the interrupt function
+void usb_poll_ring_stats(void)
+{
+  Serial.print(F("AD ring: backend "));
+  Serial.print(acq->name());
+  Serial.print(F(", depth "));
+  Serial.print(measure.depth());
+  Serial.print(F(", dropped "));
+  Serial.print(measure.dropped());
+  Serial.print(F(", high water "));
+  Serial.print(measure.highwater());
+  Serial.print(F(", lag "));
+  Serial.print(measure.lag());
+  Serial.print(F(", max lag "));
+  Serial.println(measure.lagmax());
+}
+//------------------------------------------
+// Prints the RAM taken by the large buffers, their total against RAM_BUDGET, and
+// the free RAM between heap and stack
+extern "C" char *sbrk(int incr);
+void usb_print_ram_stats(void)
+{
+  char top;
+
+  Serial.print(F("RAM: ring "));
+  Serial.print(sizeof(measure));
+  Serial.print(F(", capture "));
+  Serial.print(RAM_CAPTURE);
+  Serial.print(F(", keying "));
+  Serial.print(sizeof(Keying));
+  Serial.print(F(", ccdf "));
+  Serial.print(sizeof(Hist));
+  Serial.print(F(", bursts "));
+  Serial.print(sizeof(Bursts));
+  Serial.print(F(", history "));
+  Serial.print(sizeof(History));
+  Serial.print(F(", scope "));
+  Serial.println(sizeof(ModScope));
+  Serial.print(F("RAM: total "));
+  Serial.print(RAM_LARGE);
+  Serial.print(F(" of budget "));
+  Serial.print(RAM_BUDGET);
+  Serial.print(F(", free "));
+  Serial.println(&top - sbrk(0));
+}
+//------------------------------------------
+// Prints one set of CW keying results, times in us and levels in dB
+void usb_print_keying_t(const __FlashStringHelper *src, const keying_t &k)
+{
+  Serial.print(F("keying src="));
+  Serial.print(src);
+  Serial.print(F(" count="));
+  Serial.print(k.count);
+  Serial.print(F(" rise_us="));
+  Serial.print(k.rise_us);
+  Serial.print(F(" fall_us="));
+  Serial.print(k.fall_us);
+  Serial.print(F(" full_us="));
+  Serial.print(k.full_us);
+  Serial.print(F(" length_us="));
+  Serial.print(k.length_us);
+  Serial.print(F(" overshoot_db="));
+  Serial.print(k.overshoot/100.0, 2);
+  Serial.print(F(" droop_db="));
+  Serial.print(k.droop/100.0, 2);
+  Serial.print(F(" level_dbm="));
+  Serial.println(k.level/100.0, 2);
+}
+//------------------------------------------
+// Prints CW keying results, most recent key down and worst seen, from the sample
+// ring and from the most recent $burst capture
+void usb_print_keying(void)
+{
+  usb_print_keying_t(F("live"), Keying.last());
+  usb_print_keying_t(F("live_worst"), Keying.worst());
+  #if CAPTURE_ENABLED && ADC_PDB_ENABLED
+  if (capture.state == CAPTURE_IDLE)
+  {
+    usb_print_keying_t(F("burst"), capture_keying.last());
+    usb_print_keying_t(F("burst_worst"), capture_keying.worst());
+  }
+  #endif
+}
+//------------------------------------------
+// Prints the power distribution summary, then the CCDF, one line for each bin in use
+// from the highest down: its lower edge, in dBm and in dB above average power, and
+// the fraction of samples at or above it
+void usb_print_ccdf(void)
+{
+  static const char *pname[HIST_QUANTILES] = { "p50", "p90", "p99", "p999", "p9999", "p99999" };
+  hist_t   h;
+  uint64_t cum = 0, total = Hist.counted();
+
+  Hist.summary(h);
+  Serial.print(F("ccdf samples="));
+  Serial.print(h.samples, 0);
+  Serial.print(F(" decay_s="));
+  Serial.print(R.hist_decay);
+  Serial.print(F(" avg_dbm="));
+  Serial.print(h.avg/100.0, 2);
+  Serial.print(F(" peak_dbm="));
+  Serial.print(h.peak/100.0, 2);
+  Serial.print(F(" papr_db="));
+  Serial.print((h.peak - h.avg)/100.0, 2);
+  for (uint8_t k = 0; k < HIST_QUANTILES; k++)
+  {
+    Serial.print(' ');
+    Serial.print(pname[k]);
+    Serial.print(F("_dbm="));
+    Serial.print(h.p[k]/100.0, 2);
+  }
+  Serial.println();
+
+  for (int16_t b = HIST_BINS - 1; (b >= 0) && (cum < total); b--)
+  {
+    if (Hist.count(b) == 0) continue;
+    cum += Hist.count(b);
+    Serial.print(F("ccdf_bin dbm="));
+    Serial.print(Hist.level(b)/100.0, 2);
+    Serial.print(F(" above_avg_db="));
+    Serial.print((Hist.level(b) - h.avg)/100.0, 2);
+    Serial.print(F(" prob="));
+    Serial.println((double) cum / total, 6);
+  }
+}
+//------------------------------------------
+// Prints a range of the multi resolution history, count slots of a tier, oldest first,
+// the newest of which is from slots old (0 the most recent), as binary hslot_t records
+// between a header and a trailer line.  The range is clipped to the slots held
+void usb_print_history(uint8_t tier, uint32_t from, uint32_t count)
+{
+  uint16_t held = History.count(tier);
+  uint16_t n;
+
+  if (from >= held) from = held;
+  if (count > held - from) count = held - from;
+  n = count;
+
+  Serial.print(F("hist tier="));
+  Serial.print(tier);
+  Serial.print(F(" slot_ms="));
+  Serial.print(History.slot_ms(tier));
+  Serial.print(F(" from="));
+  Serial.print(from);
+  Serial.print(F(" n="));
+  Serial.print(n);
+  Serial.print(F(" size="));
+  Serial.print(sizeof(hslot_t));
+  Serial.print(F(" newest_ms="));
+  Serial.print(History.last_ms(tier));
+  Serial.print(F(" now_ms="));
+  Serial.print(millis());
+  Serial.print(F("\r\n"));
+  while (n--) Serial.write((const uint8_t *) &History.get(tier, from + n), sizeof(hslot_t));
+  Serial.print(F("\r\nhist end\r\n"));
+}
+//------------------------------------------
+// Prints the transmission burst log, oldest first, as binary burst_t records between a
+// header and a trailer line, or as csv
+void usb_print_bursts(bool csv)
+{
+  uint16_t n = Bursts.count();
+
+  if (!csv)
+  {
+    Serial.print(F("bursts n="));
+    Serial.print(n);
+    Serial.print(F(" size="));
+    Serial.print(sizeof(burst_t));
+    Serial.print(F(" recorded="));
+    Serial.print(Bursts.recorded());
+    Serial.print(F("\r\n"));
+    for (uint16_t i = 0; i < n; i++)
+      Serial.write((const uint8_t *) &Bursts.get(i), sizeof(burst_t));
+    Serial.print(F("\r\nbursts end\r\n"));
+    return;
+  }
+
+  Serial.println(F("seq,start_ms,duration_us,peak_dbm,avg_dbm,energy_j,swr_min,swr_max,reverse"));
+  for (uint16_t i = 0; i < n; i++)
+  {
+    const burst_t &b = Bursts.get(i);
+    Serial.print(b.seq);
+    Serial.print(',');
+    Serial.print(b.start_ms);
+    Serial.print(',');
+    Serial.print(b.duration_us);
+    Serial.print(',');
+    Serial.print(b.peak/100.0, 2);
+    Serial.print(',');
+    Serial.print(b.avg/100.0, 2);
+    Serial.print(',');
+    Serial.print(b.energy_j, 6);
+    Serial.print(',');
+    Serial.print(b.swr_min/100.0, 2);
+    Serial.print(',');
+    Serial.print(b.swr_max/100.0, 2);
+    Serial.print(',');
+    Serial.println((b.flags & BURST_REVERSE) ? 1 : 0);
+  }
+}
+//------------------------------------------
 // Prints the selected PSWR report type on a continuous basis, once every 100 milliseconds
 void usb_cont_report(void)
 {
@@ -314,6 +560,9 @@ void usb_print_help(void)
             "\r\n"
             "$pepperiodset x    x = 1, 2.5 or 5 seconds.  PEP sampling period.\r\n"
             "$pepperiodget      Return current value.\r\n"
+            "$samplerateset x   x = 200 to 4000 samples per second.  Peak, PEP and AVG windows\r\n"
+            "                   keep their durations, sampling restarts at the new rate.\r\n"
+            "$samplerateget     Return current value.\r\n"
             "\r\n"
             #if AD8307_INSTALLED                // --------------Only used with AD8307:            
             "$calset cal1 AD1-1 AD2-1 cal2 AD1-2 AD2-2\r\n"
@@ -350,6 +599,47 @@ void usb_print_help(void)
             "                   The third and largest value has to be less than ten times the first value.\r\n"
             "\r\n"
             "$addebug           read raw AD input - also works with $pcont, same as $ppoll etc...\r\n"
+            "$ringstat          Retrieve sample ring statistics: depth, dropped samples, high water mark,\r\n"
+            "                   current and max lag between interrupt function and main loop.\r\n"
+            "$ringreset         Reset sample ring statistics.\r\n"
+            "$ramstat           Retrieve RAM taken by the sample ring, capture buffer, analyses and\r\n"
+            "                   Modulation Scope, their total against the budget, and free RAM.\r\n"
+            "$bench             Benchmark the per sample processing stages on simulated input,\r\n"
+            "                   one key=value line per stage.  Sampling pauses while running.\r\n"
+            "                   Also fast dB conversions against libm, speed and max error.\r\n"
+            #if CAPTURE_ENABLED && ADC_PDB_ENABLED
+            "$burst n [x]       Capture n fwd/rev AD pairs at high rate, see CAPTURE_TIMER, triggered\r\n"
+            "                   at x mW, or at the Screensaver Threshold if omitted.\r\n"
+            "                   Metering pauses until done, then a header line, n x 4 bytes binary\r\n"
+            "                   (fwd in lower, rev in upper 16 bits) and \"burst end\".\r\n"
+            #endif
+            "$bursts [csv]      Retrieve the transmission burst log, oldest first.  A header line,\r\n"
+            "                   n x 24 bytes binary (see burst_t) and \"bursts end\", or csv.\r\n"
+            "$burstsreset       Clear the transmission burst log.\r\n"
+            "$keying            Retrieve CW keying analysis: rise, fall, full power and length in us,\r\n"
+            "                   overshoot and droop in dB, key down level in dBm.  Most recent\r\n"
+            "                   and worst key down, also for the most recent $burst capture.\r\n"
+            "$keyingreset       Reset CW keying analysis.\r\n"
+            "$ccdf              Retrieve power distribution: average, peak, PAPR and percentile\r\n"
+            "                   power, then one CCDF line for each 0.25dB bin in use.\r\n"
+            "$ccdfreset         Reset power distribution.\r\n"
+            "$ccdfdecayset x    x = 0 to 3600 seconds, time constant for old samples to fade out,\r\n"
+            "                   0 to hold until reset.\r\n"
+            "$ccdfdecayget      Return current value.\r\n"
+            "$hist t from n     Retrieve n slots of the power history, tier t = 0, 1 or 2 for 100ms,\r\n"
+            "                   1s or 1 minute slots, oldest first, the newest being from slots old.\r\n"
+            "                   A header line, n x 4 bytes binary (min, avg, max power and max SWR,\r\n"
+            "                   see PSWRhistory.h) and \"hist end\".\r\n"
+            #if ISRMON_ENABLED
+            "$isrstat           Retrieve sampler interrupt monitor: missed and dropped samples, and\r\n"
+            "                   histograms of sample period jitter and interrupt run time in us.\r\n"
+            "$isrreset          Reset sampler interrupt monitor and clear the SAMPLES DROPPED flag.\r\n"
+            #endif
+            #if PERF_ENABLED
+            "$perf              Retrieve profiler table: min, avg and max run time in us of the sampler\r\n"
+            "                   interrupt, measurement, touch, USB and each display mode.\r\n"
+            "$perfreset         Reset profiler table.\r\n"
+            #endif
             "\r\n"
             "$version           Report version and date of firmware.\r\n"
             "$help              Display the above instructions.\r\n"
@@ -537,6 +827,112 @@ void usb_parse_incoming(void)
     R.usb_report_type = REPORT_AD_DEBUG;
     usb_poll_ad_debug();
   }
+  else if (!strcasecmp("ringstat",incoming_command_string))   // Retrieve sample ring statistics
+  {
+    usb_poll_ring_stats();
+  }
+  else if (!strcasecmp("ringreset",incoming_command_string))  // Reset sample ring statistics
+  {
+    measure.clear_stats();
+  }
+  else if (!strcasecmp("ramstat",incoming_command_string))    // Retrieve RAM taken by the large buffers
+  {
+    usb_print_ram_stats();
+  }
+  else if (!strcasecmp("bench",incoming_command_string))      // Benchmark per sample processing
+  {
+    perf_bench();
+  }
+  //    $bursts [csv]      Transmission burst log, before $burst as that is a prefix
+  else if (!strcasecmp("bursts",incoming_command_string))
+  {
+    usb_print_bursts(false);
+  }
+  else if (!strcasecmp("bursts csv",incoming_command_string))
+  {
+    usb_print_bursts(true);
+  }
+  else if (!strcasecmp("burstsreset",incoming_command_string))
+  {
+    Bursts.clear();
+  }
+  #if CAPTURE_ENABLED && ADC_PDB_ENABLED
+  //    $burst n [x]       Capture n pairs at high rate, triggered at x mW.  Only with a
+  //                       blank after burst, a mistyped $bursts command is not a capture
+  else if (!strncasecmp("burst ",incoming_command_string,6))
+  {
+    inp_val = strtol(incoming_command_string+5,&pEnd,10);
+    inp_double = strtod(pEnd,&pEnd);
+    if (inp_double <= 0) inp_double = R.idle_disp_thresh;
+    if (!capture_start(inp_val, inp_double))
+      Serial.println(F("burst not possible"));
+  }
+  #endif
+  else if (!strcasecmp("keying",incoming_command_string))     // Retrieve CW keying analysis
+  {
+    usb_print_keying();
+  }
+  else if (!strcasecmp("keyingreset",incoming_command_string))// Reset CW keying analysis
+  {
+    Keying.reset();
+  }
+  else if (!strcasecmp("ccdf",incoming_command_string))       // Retrieve power distribution
+  {
+    usb_print_ccdf();
+  }
+  else if (!strcasecmp("ccdfreset",incoming_command_string))  // Reset power distribution
+  {
+    Hist.clear();
+  }
+  //    $ccdfdecayset x    x = 0 to 3600 seconds
+  //    $ccdfdecayget      Return current value
+  else if (!strncasecmp("ccdfdecayset",incoming_command_string,12))
+  {
+    // Write value if valid
+    inp_val = strtol(incoming_command_string+12,&pEnd,10);
+    if (inp_val <= 3600)
+    {
+      EEPROM_readAnything(1,R);
+      R.hist_decay = inp_val;
+      EEPROM_writeAnything(1,R);
+    }
+  }
+  else if (!strcasecmp("ccdfdecayget",incoming_command_string))
+  {
+    Serial.print(F("Power distribution time constant (seconds, 0 = hold): "));
+    Serial.println(R.hist_decay);
+  }
+  //    $hist t from n     Multi resolution history, n slots of tier t
+  else if (!strncasecmp("hist",incoming_command_string,4))
+  {
+    inp_val = strtol(incoming_command_string+4,&pEnd,10);
+    uint32_t from  = strtoul(pEnd,&pEnd,10);
+    uint32_t count = strtoul(pEnd,&pEnd,10);
+    if (inp_val < HISTORY_TIERS)
+      usb_print_history(inp_val, from, count);
+    else
+      Serial.println(F("hist tier 0 to 2"));
+  }
+  #if ISRMON_ENABLED
+  else if (!strcasecmp("isrstat",incoming_command_string))    // Retrieve sampler interrupt monitor
+  {
+    isrmon_print();
+  }
+  else if (!strcasecmp("isrreset",incoming_command_string))   // Reset sampler interrupt monitor
+  {
+    isrmon_reset();
+  }
+  #endif
+  #if PERF_ENABLED
+  else if (!strcasecmp("perf",incoming_command_string))       // Retrieve profiler table
+  {
+    perf_print();
+  }
+  else if (!strcasecmp("perfreset",incoming_command_string))  // Reset profiler table
+  {
+    perf_reset();
+  }
+  #endif
   else if (!strcasecmp("pcont",incoming_command_string))      // Switch into Continuous Mode
   {
     // Enable continuous USB report mode ($pcont), and write to EEPROM, if previously disabled
@@ -723,6 +1119,27 @@ void usb_parse_incoming(void)
     Serial.println(R.PEP_period/(PEP_BUFFER/5.0),1);
   }
 
+  //    $samplerateset x   x = 200 to 4000 samples per second
+  //    $samplerateget     Return current value
+  else if (!strncasecmp("samplerateset",incoming_command_string,13))
+  {
+    // Write value if valid
+    inp_val = strtol(incoming_command_string+13,&pEnd,10);
+    if ((inp_val >= 200) && (inp_val <= 4000))
+    {
+      EEPROM_readAnything(1,R);
+      pswr_sample_rate((1000000UL + inp_val/2)/inp_val);
+      EEPROM_writeAnything(1,R);
+    }
+  }
+  else if (!strcasecmp("samplerateget",incoming_command_string))
+  {
+    Serial.print(F("Sample_rate (samples per second): "));
+    Serial.print(1000000.0/R.sample_timer,0);
+    Serial.print(F(", sample_timer (us): "));
+    Serial.println(R.sample_timer);
+  }
+
   else if (!strcasecmp("version",incoming_command_string))    // Poll for one single Human Readable report
   {
     Serial.println(F("Teensy 3.1/3.2 based Power & SWR Meter, by TF3LJ / VE2AO"));   
@@ -0,0 +1,99 @@
+//*********************************************************************************
+//**
+//** Sliding window helpers for the Power and SWR Meter measurement functions.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#include "PSWRwindow.h"
+
+//
+//-----------------------------------------------------------------------------------------
+//      Initialise Sliding Max,
+//      storage buffer, buffer size in entries and window length in samples
+//-----------------------------------------------------------------------------------------
+//
+void SlidingMax::init(slidingmax_t *buf, uint16_t bufsize, uint16_t winlen)
+{
+  q     = buf;
+  size  = bufsize;
+  clear();
+  length(winlen);
+}
+
+void SlidingMax::clear(void)
+{
+  head  = 0;
+  count = 0;
+  stamp = 0;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Change Sliding Max window length, bounded by the storage buffer size
+//-----------------------------------------------------------------------------------------
+//
+void SlidingMax::length(uint16_t winlen)
+{
+  if (winlen > size) winlen = size;
+  if (winlen < 1)    winlen = 1;
+  len = winlen;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//      Add one value to the Sliding Max window and return the max within the window
+//
+//      The queue holds values in decreasing order from head.  A new value removes all
+//      smaller values at the back, as these can never again become the max.  Values at
+//      the head are expired once they fall out of the window.  Each value is added and
+//      removed only once, hence amortized O(1) per sample.
+//-----------------------------------------------------------------------------------------
+//
+int32_t SlidingMax::add(int32_t value)
+{
+  uint16_t back;
+
+  // Expire values which have fallen out of the window (or a shortened window)
+  while (count && ((uint16_t)(stamp - q[head].stamp) >= len))
+  {
+    head++;
+    if (head >= size) head = 0;
+    count--;
+  }
+
+  // Remove values at the back which are not larger than the newest value
+  while (count)
+  {
+    back = head + count - 1;
+    if (back >= size) back -= size;
+    if (q[back].value > value) break;
+    count--;
+  }
+
+  // Add the newest value at the back
+  back = head + count;
+  if (back >= size) back -= size;
+  q[back].value = value;
+  q[back].stamp = stamp;
+  count++;
+  stamp++;
+
+  return q[head].value;
+}
@@ -0,0 +1,68 @@
+//*********************************************************************************
+//**
+//** Sliding window helpers for the Power and SWR Meter measurement functions.
+//** Sliding Max uses a monotonic queue (ascending minima style), giving the
+//** maximum value within a window of the most recent samples in amortized
+//** O(1) per sample, regardless of the window length.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Teensy 3.1 / 3.2 / 3.5 / 3.6 (http://www.pjrc.com)
+//**
+//*********************************************************************************
+
+#ifndef _PSWRwindow_h_
+#define _PSWRwindow_h_
+
+#include <stdint.h>
+
+#define SLIDINGMAX_EMPTY  -0x7fffffff   // Returned by peak() if no values in window
+
+typedef struct {
+          int32_t  value;               // Sample value
+          uint16_t stamp;               // Sequence number of sample when added
+               }  slidingmax_t;
+
+class SlidingMax
+{
+  public:
+    //------------------------------------------------------------------------------
+    // Init with a storage buffer, its size in entries, and the window length
+    // (window length is in samples, and can never be longer than the buffer size)
+    void init(slidingmax_t *, uint16_t, uint16_t);
+    //------------------------------------------------------------------------------
+    // Change window length at runtime.  Values older than the new window are
+    // expired when the next value is added, no rescan is needed.
+    void length(uint16_t);
+    uint16_t length(void) { return len; }
+    //------------------------------------------------------------------------------
+    // Add the newest value, returns max value within the window
+    int32_t add(int32_t);
+    //------------------------------------------------------------------------------
+    // Max value within the window, SLIDINGMAX_EMPTY if nothing has been added
+    int32_t peak(void) { return count ? q[head].value : SLIDINGMAX_EMPTY; }
+    void clear(void);                   // Empty the window
+
+  private:
+    slidingmax_t *q;                    // Monotonic queue, decreasing values from head
+    uint16_t size;                      // Storage buffer size
+    uint16_t len;                       // Window length
+    uint16_t head;                      // Oldest (and largest) queue entry
+    uint16_t count;                     // Number of entries in queue
+    uint16_t stamp;                     // Sequence number of next sample, rolls over
+};
+
+#endif
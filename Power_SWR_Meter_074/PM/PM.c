@@ -153,6 +153,8 @@ int16_t		ad8307_adF;						// Measured A/D value from the AD8307 Forward sensor a
 int16_t		ad8307_adR;						// Measured A/D value from the AD8307 Reverse sensor as a 10 bit value
 double		ad8307_FdBm;					// Measured AD8307 forward voltage in dBm
 double		ad8307_RdBm;					// Measured AD8307 reverse current in dBm
+int16_t		ad8307_Fdb100;					// Measured AD8307 forward voltage in dBm x 100
+int16_t		ad8307_Rdb100;					// Measured AD8307 reverse current in dBm x 100
 
 #endif										// >>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
 
@@ -206,19 +208,21 @@ void maintask(void)
 	#endif
 	
 	//-------------------------------------------------------------------------------
-	// Here we do routines which are to be accessed once every approx 5ms
+	// Here we do routines which are to be accessed once every sample, approx 5ms,
+	// or approx 1.25ms if the fixed point measurement path is used
 	// We have a free running timer which matures once every ~1.05 seconds
 	//-------------------------------------------------------------------------------
 	//Timer1val1 = TCNT1/328; // get current Timer1 value, changeable every ~5ms
-	Timer1val1 = TCNT1/313;   // get current Timer1 value, changeable every ~5ms
+	Timer1val1 = TCNT1/SAMPLE_TICKS;	// get current Timer1 value, changeable every sample
 	
-	if (Timer1val1 != lastIteration1)				// Once every 5ms, do stuff
+	if (Timer1val1 != lastIteration1)				// Once every sample, do stuff
 	{
 		lastIteration1 = Timer1val1;				// Make ready for next iteration
-		#if MS_LOOP_THRU_LED						// Blink LED every 5*2 ms, when going through the main loop 
+		#if MS_LOOP_THRU_LED						// Blink LED every 2 samples, when going through the main loop 
 		LED_PORT = LED_PORT ^ LED;  				// Blink a led
 		#endif
 
+		PERF_BEGIN(perf_t0);
 		adc_poll();									// Read AD, external or internal
 		#if PHASE_DETECTOR							// >>>>>>>>>>>>>>> Power & Phase Detector Code
 		imp_determine_dBm();						// Convert raw A/D values to dBm
@@ -228,6 +232,7 @@ void maintask(void)
 		pswr_determine_dBm();						// Convert raw A/D values to dBm
 		pswr_calc_Power();							// Calculate all kinds of Power
 		#endif										// >>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
+		PERF_END(PERF_MEASURE, perf_t0);
 	}
 
 	//-------------------------------------------------------------------------------
@@ -389,9 +394,21 @@ void maintask(void)
 			pushcount++;							//  then do nothing)
 		}
 
+		#if FIXEDPOINT_ENABLED
+		//-------------------------------------------------------------------
+		// Floating point Power and SWR values for display and USB
+		//
+		#if PHASE_DETECTOR						// >>>>>>>>>>>>>>> Power & Phase Detector Code
+		imp_calc_Derived();
+		#else									// >>>>>>>>>>>>>>> Simple Power & SWR Code
+		pswr_calc_Derived();
+		#endif									// >>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
+		#endif
+
 		//-------------------------------------------------------------------
 		// Various Menu (rotary encoder) selectable display/function modes
 		//
+		PERF_BEGIN(perf_t1);
 		if (Menu_Mode & CONFIG)					// Pushbutton Configuration Menu
 		{
 			PushButtonMenu();
@@ -430,6 +447,7 @@ void maintask(void)
 		{
 			lcd_display_mixed();
 		}
+		PERF_END(PERF_DISPLAY + ((Menu_Mode & CONFIG) ? 0 : current_mode + 1), perf_t1);
 
 		if (R.USB_data && (Status & USB_AVAILABLE))	// Handle USB serial port, if enabled and available
 		{
@@ -573,8 +591,10 @@ int main(void)
 			if (usb_configured() && (usb_serial_get_control() & USB_SERIAL_DTR))
 			{
 				Status |= USB_AVAILABLE;			// Enable USB communications
-				EXTLED_PORT |= EXT_G_LED;			// Turn Green LED On
-				usb_read_serial();
+				EXTLED_PORT |= EXT_G_LED;			// Turn Green LED On
+				PERF_BEGIN(perf_t2);
+				usb_read_serial();
+				PERF_END(PERF_USB, perf_t2);
 			}
 			else
 			{
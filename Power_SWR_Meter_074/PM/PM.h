@@ -68,7 +68,9 @@
 
 //-----------------------------------------------------------------------------
 // Simple 2xAD8307 Power & SWR Meter or also including the MCK12240 Phase detector
+#ifndef PHASE_DETECTOR						// May be given on the compiler command line
 #define PHASE_DETECTOR		0			
+#endif
 
 //-----------------------------------------------------------------------------
 // 20 to 1 Tandem Match with Power and SWR Meter - not used with Phase Detector code
@@ -184,10 +186,23 @@
 //
 // None, or only one of the four should be selected
 #define FAST_LOOP_THRU_LED	0		// Blink PB2 LED every time, when going through the mainloop *OR*
-#define	MS_LOOP_THRU_LED	1		// Blink PB2 LED every 5ms, when going through the mainloop *OR*
+#define	MS_LOOP_THRU_LED	1		// Blink PB2 LED every sample, when going through the mainloop *OR*
 #define	MED_LOOP_THRU_LED	0		// Blink PB2 LED every 10ms, when going through the mainloop *OR*
 #define SLOW_LOOP_THRU_LED	0		// Blink PB2 LED every 100ms, when going through the mainloop
 
+//-----------------------------------------------------------------------------
+// Hot path profiler, time spent in the measurement, display and USB paths,
+// in Timer1 ticks of 16us.  Reported by the USB command $perf
+#define PERF_ENABLED		1
+
+//-----------------------------------------------------------------------------
+// Fixed point measurement path.  Sample 4x faster (every ~1.25ms), integer only
+// per sample, floating point values for display and USB derived every 100ms.
+// With the Phase Detector code, the phase is also handled by lookup tables
+#ifndef FIXEDPOINT_ENABLED					// May be given on the compiler command line
+#define FIXEDPOINT_ENABLED	1
+#endif
+
 //-----------------------------------------------------------------------------
 // DEFS for LEDS
 #define LED_PORT			PORTD	// port for the LED
@@ -317,6 +332,28 @@ extern	uint16_t			Menu_Mode;		// Which Menu Mode is active
 #define	USBPCONT		(1 << 7)			// $pcont, continuous transmission of last selected
 
 
+// Range of dBm x 100 covered by the lookup tables in PM_Lookup.c
+#define DB100_MIN		-10000				// -100 dBm
+#define DB100_MAX		9999				// +99.99 dBm
+#define RL100_MAX		6000				// Return Loss table covers 0 to 60 dB, 0.01 dB steps
+
+// Sample timing, Timer1 runs at 62500 ticks per second
+#if FIXEDPOINT_ENABLED
+#define SAMPLE_TICKS	78					// Timer1 ticks between samples, ~1.25ms (800 per second)
+#define PK_SAMPLES		80					// Samples in the 100ms Peak window, also one 100ms block
+#define PEP_BLOCKS_MAX	50					// 100ms blocks in the longest PEP window (5s)
+#define AVG_BLOCKS		10					// 100ms blocks in the 1s Average window
+#define DB100_LIN_MAX	9000				// Highest dBm x 100 summed for the Average, +90 dBm
+#define LIN_SHIFT		24					// db100_to_lin() output is in units of 2^-24 mW
+#define LIN_UNITS_MAX	(1000000000ULL << LIN_SHIFT)	// db100_to_lin(DB100_LIN_MAX), 10^9 mW
+// The 1s Average sum, avg_sum, is the largest of the power sums
+_Static_assert(LIN_UNITS_MAX <= UINT64_MAX / ((uint64_t) AVG_BLOCKS * PK_SAMPLES),
+			"DB100_LIN_MAX too high, the 1s Average sum can overflow 64 bits");
+#else
+#define SAMPLE_TICKS	313					// Timer1 ticks between samples, ~5ms (200 per second)
+#endif
+
+
 //-----------------------------------------------------------------------------
 // Macros
 #ifndef SQR
@@ -325,11 +362,42 @@ extern	uint16_t			Menu_Mode;		// Which Menu Mode is active
 #ifndef ABS
 #define ABS(x) ((x>0)?(x):(-x))
 #endif
+#if PERF_ENABLED
+#define PERF_BEGIN(t)		uint16_t t = TCNT1			// Start of profiled scope
+#define PERF_END(id,t)		perf_add(id, TCNT1 - (t))	// End of profiled scope
+#else
+#define PERF_BEGIN(t)
+#define PERF_END(id,t)
+#endif
 
 
 //-----------------------------------------------------------------------------
 // Structures and Unions
 
+typedef struct
+{
+	uint16_t	swr_log;						// 1000 x log10(SWR), 65535 if infinite
+	uint16_t	ml;								// Mismatch Loss in dB x 100, 65535 if infinite
+} rl_t;
+
+typedef struct
+{
+	uint16_t	min;							// Shortest time through scope, Timer1 ticks
+	uint16_t	max;							// Longest time through scope, Timer1 ticks
+	uint16_t	count;							// Number of times through scope, saturates at 65535
+	uint32_t	sum;							// Total time through scope, Timer1 ticks
+} perf_t;
+
+// Profiler scopes
+#define PERF_MEASURE		0				// AD poll and Power calculations, every sample
+#define PERF_USB			1				// USB serial command parser
+#define PERF_DISPLAY		2				// Pushbutton Menu, followed by each display mode
+#if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
+#define PERF_SCOPES			(PERF_DISPLAY + 9)
+#else				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Simple Power & SWR Code
+#define PERF_SCOPES			(PERF_DISPLAY + 6)
+#endif				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
+
 typedef struct {
 	int16_t	db10m;							// Calibrate, value in dBm x 10
 	#if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
@@ -393,6 +461,8 @@ extern	int16_t		ad8307_adF;				// Measured A/D value from the AD8307 Forward sen
 extern	int16_t		ad8307_adR;				// Measured A/D value from the AD8307 Reverse sensor as a 12 bit value
 extern	double		ad8307_FdBm;			// Measured AD8307 forward voltage in dBm
 extern	double		ad8307_RdBm;			// Measured AD8307 reverse current in dBm
+extern	int16_t		ad8307_Fdb100;			// Measured AD8307 forward voltage in dBm x 100
+extern	int16_t		ad8307_Rdb100;			// Measured AD8307 reverse current in dBm x 100
 #endif				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
 
 extern	BOOL		Reverse;				// True if reverse power is greater than forward power
@@ -467,14 +537,36 @@ extern void			lcd_bargraph_Init(void);
 extern uint8_t		I2C_Init(void);			// Initialize I2C and determine if AD7991 is connected
 extern void			adc_poll(void);			// Read builtin or AD7991 AD inputs
 
+// PM_Lookup.c
+extern float		db100_to_mw(int32_t);	// Convert dBm x 100 to milliwatts
+extern rl_t			rl_lookup(int32_t);		// Return Loss in dB x 100 to SWR and Mismatch Loss
+#if FIXEDPOINT_ENABLED
+extern uint64_t		db100_to_lin(int16_t);	// Convert dBm x 100 to units of 2^-24 mW, integer only
+#if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
+extern int32_t		phase_cos(int16_t);		// Cosine of a phase in 0.1 degrees, x 32768
+extern uint16_t		ratio_db100(uint32_t, uint32_t);	// 1000 x log10 of a ratio, 0 if below 1
+#endif
+#endif
+
+// PM_Perf.c
+extern void			perf_add(uint8_t, uint16_t);	// Add one time measurement to a profiler scope
+extern void			perf_reset(void);				// Clear all profiler scopes
+extern void			perf_print(void);				// Write profiler scopes to USB
+
 // Determine Power, SWR etc...
 #if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
 extern void			imp_determine_dBm(void);		// Convert raw A/D values to dBm
 extern void			imp_determine_phase(void);		// Process Phase Detector outputs
 extern void			imp_calc_Power(void);			// Calculate all kinds of Power
+#if FIXEDPOINT_ENABLED
+extern void			imp_calc_Derived(void);			// Floating point values for display and USB
+#endif
 #else				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Simple Power & SWR Code
 extern void			pswr_determine_dBm(void);		// Convert raw A/D values to dBm
 extern void			pswr_calc_Power(void);			// Calculate all kinds of Power
+#if FIXEDPOINT_ENABLED
+extern void			pswr_calc_Derived(void);		// Floating point values for display and USB
+#endif
 #endif				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
 
 #endif
@@ -0,0 +1,103 @@
+//*********************************************************************************
+//**
+//** Project.........: A menu driven Multi Display RF Power and SWR Meter
+//**                   using a Tandem Match Coupler and 2x AD8307.
+//**                                 or alternately
+//**                   using 2 transformers in an V and I arrangement,
+//**                   to feed 2x AD8307 and a MCK12140 based 360 degree
+//**                   capable Phase Detector circuit, implementing an
+//**                   RF Power/SWR and Phase + Impedance meter
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: AT90usb1286 @ 16MHz
+//**
+//** Initial version.: 0.50, 2013-09-29  Loftur Jonasson, TF3LJ / VE2LJX
+//**                   (beta version)
+//**
+//** History.........: Check the PM.c file
+//**
+//*********************************************************************************
+
+//
+//-----------------------------------------------------------------------------------------
+//
+//	Hot path profiler
+//
+//	Each scope keeps min, max, count and sum of Timer1 ticks, from PERF_BEGIN() to
+//	PERF_END(), see PM.h.  Timer1 is free running at CLK/256, 16us per tick, so short
+//	scopes read as 0 or 1 tick each time, while the average still resolves them.
+//	Count saturates at 65535, which also keeps the sum within 32 bits.
+//
+//-----------------------------------------------------------------------------------------
+//
+
+#include "PM.h"
+
+#if PERF_ENABLED
+perf_t		perf[PERF_SCOPES];
+
+#if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
+static const char *perf_name[PERF_SCOPES] =
+{
+	"measure", "usb", "menu",
+	"rjx_pk", "rjx_avg", "rjx_inst", "pk", "avg", "inst", "dbm", "mixed"
+};
+#else				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Simple Power & SWR Code
+static const char *perf_name[PERF_SCOPES] =
+{
+	"measure", "usb", "menu",
+	"pk", "avg", "inst", "dbm", "mixed"
+};
+#endif				// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
+
+
+void perf_add(uint8_t id, uint16_t ticks)
+{
+	perf_t *p = &perf[id];
+
+	if (p->count == 0xffff) return;				// Saturated
+	if ((p->count == 0) || (ticks < p->min)) p->min = ticks;
+	if (ticks > p->max) p->max = ticks;
+	p->count++;
+	p->sum += ticks;
+}
+
+void perf_reset(void)
+{
+	memset(perf, 0, sizeof(perf));
+}
+
+//
+//-----------------------------------------------------------------------------------------
+//			Print the profiler table, one line per scope which has been run,
+//			times in microseconds
+//-----------------------------------------------------------------------------------------
+//
+void perf_print(void)
+{
+	uint8_t x;
+
+	for (x = 0; x < PERF_SCOPES; x++)
+	{
+		if (perf[x].count == 0) continue;
+		sprintf(lcd_buf,"perf scope=%s count=%u min_us=%lu avg_us=%lu max_us=%lu\r\n",
+				perf_name[x], perf[x].count, perf[x].min * 16UL,
+				perf[x].sum / perf[x].count * 16UL, perf[x].max * 16UL);
+		usb_serial_write(lcd_buf,strlen(lcd_buf));
+	}
+}
+#endif
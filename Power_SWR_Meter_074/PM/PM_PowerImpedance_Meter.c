@@ -45,9 +45,140 @@
 //
 
 
+#include <math.h>
 #include "PM.h"
+#include "PM_FastMath.h"
 
 #if PHASE_DETECTOR							// >>>>>>>>>>>>>>> Power & Phase Detector Code
+#if FIXEDPOINT_ENABLED
+static int16_t	v_db100;					// Measured AD8307 voltage in dBm x 100
+static int16_t	i_db100;					// Measured AD8307 current in dBm x 100
+static int16_t	ph_d10;						// Phase in 0.1 degrees
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Precalculate the slope gradients from the calibration values
+//
+// As in the Power & SWR code, fixed point integers, redone whenever the calibration
+// values change.  The dBm slopes have 12 fractional bits.  The phase slopes are in 0.1
+// degrees per 1/16th of an A/D value, 16 fractional bits, from the phase voltages.
+//-----------------------------------------------------------------------------------------
+//
+typedef struct {
+	int32_t	zero;							// Phase voltage at 0 degrees, 1/16ths of an A/D value
+	int32_t	above;							// Phase slope above the 0 degree voltage
+	int32_t	below;							// Phase slope below the 0 degree voltage
+} ph_slope_t;
+
+static int32_t		v_slope;				// Voltage dBm x 100 per A/D value, 12 fractional bits
+static int32_t		i_slope;				// Current dBm x 100 per A/D value, 12 fractional bits
+static ph_slope_t	ph_U, ph_D;				// Phase slopes for the U and D pins
+static cal_t		slope_cal[2];			// Calibration values used for the slope gradients
+static phase_t		slope_U, slope_D;		// Phase reference levels used for the slope gradients
+
+static int32_t imp_slope(int16_t db100, int16_t delta)
+{
+	double slope;
+	
+	if (delta == 0) return 0;				// Bad calibration
+	slope = 4096.0 * db100 / delta;
+	// Bounded to keep (V - V_Cal1) * slope_gradient within 32 bits
+	if (slope >  0x3ffff) slope =  0x3ffff;
+	if (slope < -0x3ffff) slope = -0x3ffff;
+	return slope;
+}
+
+static int32_t imp_ph_slope(double volts)	// 90 degrees over a difference of phase voltages
+{
+	double slope;
+
+	if (volts == 0) return 0;				// Bad calibration
+	slope = 900.0 * 65536 / (volts * 16 * 4096/5.0);
+	// Bounded to keep the phase within 32 bits
+	if (slope >  0x7fff) slope =  0x7fff;
+	if (slope < -0x7fff) slope = -0x7fff;
+	return slope;
+}
+
+static void imp_cal_slopes_build(void)
+{
+	int16_t	delta_db100;
+
+	delta_db100 = (R.cal_AD[1].db10m - R.cal_AD[0].db10m) * 10;
+	v_slope = imp_slope(delta_db100, R.cal_AD[1].V - R.cal_AD[0].V);
+	i_slope = imp_slope(delta_db100, R.cal_AD[1].I - R.cal_AD[0].I);
+	memcpy(slope_cal, R.cal_AD, sizeof(slope_cal));
+
+	// The same four regions as the floating point imp_determine_phase() below
+	ph_D.zero  = R.D.zerodeg * 16 * 4096/5.0;
+	ph_D.above = imp_ph_slope(R.D.pos90deg - R.D.zerodeg);	//   0 to  180 degrees
+	ph_D.below = imp_ph_slope(R.D.zerodeg - R.D.neg90deg);	//   0 to -180 degrees
+	ph_U.zero  = R.U.zerodeg * 16 * 4096/5.0;
+	ph_U.above = imp_ph_slope(R.U.zerodeg - R.U.neg90deg);	//   0 to -180 degrees
+	ph_U.below = imp_ph_slope(R.U.pos90deg - R.U.zerodeg);	//   0 to  180 degrees
+	slope_U = R.U;
+	slope_D = R.D;
+}
+
+static BOOL imp_cal_changed(void)
+{
+	return memcmp(slope_cal, R.cal_AD, sizeof(slope_cal))
+		|| memcmp(&slope_U, &R.U, sizeof(phase_t)) || memcmp(&slope_D, &R.D, sizeof(phase_t));
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Determine Phase between input signals, integer only
+//			See the floating point version below for the Phase Detector calibration
+//-----------------------------------------------------------------------------------------
+//
+void imp_determine_phase(void)
+{
+	const ph_slope_t *s;
+	int32_t	v, ph;
+
+	// The slopes are kept up to date by imp_determine_dBm(), which runs first
+
+	// Determine which signal contains the phase info, then the phase angle
+	if (mck12140neg > mck12140pos)
+	{
+		s = &ph_D;
+		v = (int32_t) mck12140neg * 16 - s->zero;
+	}
+	else
+	{
+		s = &ph_U;
+		v = (int32_t) mck12140pos * 16 - s->zero;
+	}
+	ph = (v * ((v > 0) ? s->above : s->below) + 0x8000) >> 16;
+	if (ph >  18000) ph =  18000;			// Out of range, bad calibration
+	if (ph < -18000) ph = -18000;
+	ph_d10 = ph;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Convert Voltage and Current into Power, integer only
+//-----------------------------------------------------------------------------------------
+//
+void imp_determine_dBm(void)
+{
+	int32_t	v_db, i_db;
+
+	if (imp_cal_changed()) imp_cal_slopes_build();
+
+	// measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
+	v_db = (((int32_t) (ad8307_adV - R.cal_AD[0].V) * v_slope) >> 12) + R.cal_AD[0].db10m * 10;
+	i_db = (((int32_t) (ad8307_adI - R.cal_AD[0].I) * i_slope) >> 12) + R.cal_AD[0].db10m * 10;
+	if (v_db < DB100_MIN) v_db = DB100_MIN;
+	if (v_db > DB100_MAX) v_db = DB100_MAX;
+	if (i_db < DB100_MIN) i_db = DB100_MIN;
+	if (i_db > DB100_MAX) i_db = DB100_MAX;
+	v_db100 = v_db;
+	i_db100 = i_db;
+}
+
+#else
 //
 //-----------------------------------------------------------------------------------------
 // 			Determine Phase between input signals, 
@@ -153,6 +284,7 @@ void imp_determine_dBm(void)
 	ad8307_VdBm = (ad8307_adV - R.cal_AD[0].V) * delta_Vdb + R.cal_AD[0].db10m/10.0;
 	ad8307_IdBm = (ad8307_adI - R.cal_AD[0].I) * delta_Idb + R.cal_AD[0].db10m/10.0;
 }
+#endif
 
 //
 //-----------------------------------------------------------------------------------------
@@ -170,7 +302,7 @@ void imp_calc_SWR(void)
 
 		// prepare SWR bargraph value as a logarithmic integer value between 0 and 1000
 		if (swr < 10.0)
-		swr_bar = 1000.0 * log10(swr);
+		swr_bar = 1000.0 * fast_log10(swr);
 		else
 		swr_bar = 1000;
 
@@ -205,6 +337,195 @@ void imp_calc_SWR(void)
 }
 
 
+#if FIXEDPOINT_ENABLED
+//
+//-----------------------------------------------------------------------------------------
+// 			Fixed point measurement path
+//
+// As in the Power & SWR code, everything done per sample is integer only, in dBm x 100,
+// with the same 100ms Peak, PEP and 1s Average windows.  In addition:
+// - Real Power is V x I x cos(phase), in dB the average of the V and I dBm plus
+//   10 x log10(cos(phase)), from a cosine table and an integer log
+// - Return Loss from the normalized impedance |Z| = 10^((V dBm - I dBm)/20) and the
+//   phase.  With q the smaller of |Z| and 1/|Z|, and c = |cos(phase)|:
+//     Gamma^2 = ((R-1)^2 + X^2)/((R+1)^2 + X^2) = (1 + q^2 - 2qc)/(1 + q^2 + 2qc)
+//   in 28 fractional bits, q by db100_to_lin(), then 1000 x log10() by ratio_db100()
+// The floating point values for display and USB are derived from these once every
+// 100ms, by imp_calc_Derived()
+//-----------------------------------------------------------------------------------------
+//
+static int16_t	pk_buff[PK_SAMPLES];		// dB x 100 in a 100ms window
+static int16_t	pk_max;						// Peak (100ms) dB x 100
+static uint8_t	pk_pos;						// 100ms ring buffer counter
+static int16_t	pep_buff[PEP_BLOCKS_MAX];	// Peak dB x 100 of each 100ms block
+static uint8_t	pep_pos;					// PEP ring buffer counter
+static uint64_t	avg_buff[AVG_BLOCKS];		// Power sum of each 100ms block
+static uint64_t	avg_sum;					// Power sum of all blocks in the 1s window
+static uint8_t	avg_pos;					// 1s average ring buffer counter
+static int16_t	blk_max;					// Peak dB x 100 within the current 100ms block
+static uint64_t	blk_sum;					// Power sum within the current 100ms block
+static uint8_t	blk_cnt;					// Samples within the current 100ms block
+static int16_t	p_db100;					// Latest Real Power in dB x 100
+static uint16_t	p_rl100;					// Latest Return Loss in dB x 100
+static int32_t	p_cos;						// Latest cos(phase) x 32768
+static BOOL		primed = FALSE;				// Ring buffers have been initialised
+
+static void imp_rings_init(void)
+{
+	uint8_t x;
+
+	for (x = 0; x < PK_SAMPLES; x++) pk_buff[x] = DB100_MIN;
+	for (x = 0; x < PEP_BLOCKS_MAX; x++) pep_buff[x] = DB100_MIN;
+	pk_max = blk_max = p_db100 = DB100_MIN;
+	primed = TRUE;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Calculate all kinds of power, integer only, once every sample
+//-----------------------------------------------------------------------------------------
+//
+void imp_calc_Power(void)
+{
+	int32_t	p_db;							// Real Power in dB x 100
+	int32_t	z_db;							// 20 x log10(|Z|) x 100, normalized
+	uint32_t c;								// |cos(phase)| x 32768
+	uint32_t q, d;							// q and 1 - q, 15 fractional bits
+	uint32_t num;							// 1 + q^2 - 2qc, 28 fractional bits
+	int16_t	old;							// Value leaving the 100ms window
+	uint8_t	x;
+
+	if (!primed) imp_rings_init();
+
+	// Take care of power in opposite direction, negative R
+	p_cos = phase_cos(ph_d10);
+	Reverse = (p_cos < 0);
+	c = Reverse ? -p_cos : p_cos;
+
+	// Real Power, 10 x log10(V x I x |cos(phase)|) in dBm
+	if (c == 0) p_db = DB100_MIN;
+	else p_db = ((int32_t) v_db100 + i_db100) / 2 - ratio_db100(32768, c);
+	if (p_db < DB100_MIN) p_db = DB100_MIN;
+	if (p_db > DB100_MAX) p_db = DB100_MAX;
+	p_db100 = p_db;
+
+	// Return Loss, which is the same for |Z| and 1/|Z|
+	z_db = (int32_t) v_db100 - i_db100;
+	if (z_db < 0) z_db = -z_db;
+	// 10^(-z_db/2000), 24 fractional bits, the mean of two steps if z_db is odd
+	q = (db100_to_lin(-(z_db >> 1)) + db100_to_lin(-((z_db + 1) >> 1)) + 1) >> 1;
+	d = ((1UL << 24) - q + (1 << 8)) >> 9;
+	q = (q + (1 << 8)) >> 9;
+	// As (1 - q)^2 + 2q(1 - c), no cancellation when close to a match
+	num = ((d * d) >> 2) + ((q * (32768 - c)) >> 1);
+	if (num) p_rl100 = ratio_db100(num + q * c, num);	// 1 + q^2 + 2qc = num + 4qc
+	else p_rl100 = RL100_MAX;						// Matched, no reflected power
+	if (p_rl100 > RL100_MAX) p_rl100 = RL100_MAX;
+
+	// Peak (100 milliseconds), only rescan if the Peak is leaving the window
+	old = pk_buff[pk_pos];
+	pk_buff[pk_pos] = p_db;
+	pk_pos++;
+	if (pk_pos == PK_SAMPLES) pk_pos = 0;
+	if (p_db >= pk_max) pk_max = p_db;
+	else if (old == pk_max)
+	{
+		pk_max = DB100_MIN;
+		for (x = 0; x < PK_SAMPLES; x++)
+		{
+			if (pk_max < pk_buff[x]) pk_max = pk_buff[x];
+		}
+	}
+
+	// Peak and Power sum within the current 100ms block
+	if (blk_max < p_db) blk_max = p_db;
+	blk_sum += db100_to_lin(p_db);
+	blk_cnt++;
+
+	if (blk_cnt == PK_SAMPLES)				// Once every 100ms, advance PEP and Average windows
+	{
+		pep_buff[pep_pos] = blk_max;
+		pep_pos++;
+		if (pep_pos == PEP_BLOCKS_MAX) pep_pos = 0;
+
+		avg_sum = avg_sum - avg_buff[avg_pos] + blk_sum;	// Exact, the same integer is subtracted
+		avg_buff[avg_pos] = blk_sum;						// when the block leaves the window
+		avg_pos++;
+		if (avg_pos == AVG_BLOCKS) avg_pos = 0;
+
+		blk_max = DB100_MIN;
+		blk_sum = 0;
+		blk_cnt = 0;
+	}
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Floating point Power, Impedance and SWR values for display and USB,
+//			once every 100ms
+//-----------------------------------------------------------------------------------------
+//
+void imp_calc_Derived(void)
+{
+	double	z;								// |Z|, normalized
+	int16_t	max;							// PEP dB x 100
+	uint8_t	n, i, x;
+
+	if (!primed) imp_rings_init();
+
+	ad8307_VdBm = v_db100 / 100.0;
+	ad8307_IdBm = i_db100 / 100.0;
+	phase = ph_d10 * (3.14159/1800.0);
+
+	// R and jX (normalized, need to multiply by 50 for actual value)
+	z = fast_db_to_lin(((int32_t) v_db100 - i_db100) / 200.0);	// 10^((V dBm - I dBm)/20)
+	imp_R  = z * p_cos * (1.0/32768);
+	imp_jX = z * phase_cos(ph_d10 - 900) * (1.0/32768);	// sin(phase)
+
+	// Real Power, Gamma and Reflected Power
+	power_mw = db100_to_mw(p_db100);
+	power_db = p_db100 / 100.0;
+	Gamma = fast_db_to_lin(p_rl100 / -200.0);	// 10^(-RL/20)
+	ref_power_mw = db100_to_mw((int32_t) p_db100 - p_rl100);
+	ref_power_db = ((int32_t) p_db100 - p_rl100) / 100.0;
+
+	// Forward Power
+	fwd_power_mw = power_mw + ref_power_mw;
+	fwd_power_db = fast_lin_to_db(fwd_power_mw);
+
+	// PEP, the current 100ms block and the R.PEP_period/20 blocks preceding it
+	n = R.PEP_period / 20;
+	if (n > PEP_BLOCKS_MAX) n = PEP_BLOCKS_MAX;
+	max = blk_max;
+	i = pep_pos;
+	for (x = 0; x < n; x++)
+	{
+		i = i ? i - 1 : PEP_BLOCKS_MAX - 1;
+		if (max < pep_buff[i]) max = pep_buff[i];
+	}
+	power_db_pep = max / 100.0;
+	power_mw_pep = db100_to_mw(max);
+
+	// Peak (100 milliseconds)
+	power_db_pk = pk_max / 100.0;
+	power_mw_pk = db100_to_mw(pk_max);
+
+	// Average power (1 second), milliwatts and dBm
+	if (avg_sum)
+	{
+		power_mw_avg = avg_sum * (1.0 / ((double) AVG_BLOCKS * PK_SAMPLES * (1UL << LIN_SHIFT)));
+		power_db_avg = fast_lin_to_db(power_mw_avg);
+	}
+	else									// Below the resolution of the sums
+	{
+		power_mw_avg = db100_to_mw(DB100_MIN);
+		power_db_avg = DB100_MIN / 100.0;
+	}
+
+	imp_calc_SWR();
+}
+
+#else
 
 //
 //-----------------------------------------------------------------------------------------
@@ -232,8 +553,8 @@ void imp_calc_Power(void)
 	int16_t max=-32767, pk=-32767;			// Keep track of Max (1s) and Peak (100ms) dB voltage
 
 	// Calculate voltage and current (normalized) in absolute values
-	v_inst = pow(10,ad8307_VdBm/20.0);
-	i_inst = pow(10,ad8307_IdBm/20.0);
+	v_inst = fast_exp10(ad8307_VdBm/20.0);
+	i_inst = fast_exp10(ad8307_IdBm/20.0);
 
 	// Calculate R and jX (normalized, need to multiply by 50 for actual value)
 	imp_R  = v_inst/i_inst * cos(phase);
@@ -253,7 +574,7 @@ void imp_calc_Power(void)
 	
 	// Determine incident Power
 	power_mw = SQR(i_inst) * imp_R_unsigned;
-	power_db = 10 * log10(power_mw);
+	power_db = fast_lin_to_db(power_mw);
 	
 	// Determine Gamma
 	Gamma = sqrt( ( SQR(imp_R_unsigned-1)+SQR(imp_jX) )
@@ -262,11 +583,11 @@ void imp_calc_Power(void)
 	
 	// Reflected Power
 	ref_power_mw = SQR(Gamma) * power_mw;
-	ref_power_db = 10 * log10(ref_power_mw);
+	ref_power_db = fast_lin_to_db(ref_power_mw);
 
 	// Forward Power
 	fwd_power_mw = power_mw + ref_power_mw;
-	fwd_power_db = 10 * log10(fwd_power_mw);
+	fwd_power_db = fast_lin_to_db(fwd_power_mw);
 
 	// Find PEP and 100ms peak
 	// Multiply dB value by 100 to make suitable for an integer value
@@ -291,11 +612,11 @@ void imp_calc_Power(void)
 
 	// PEP (1 second)
 	power_db_pep = max / 100.0;
-	power_mw_pep = pow(10,power_db_pep/10.0);
+	power_mw_pep = fast_db_to_lin(power_db_pep);
 
 	// Peak (100 milliseconds)
 	power_db_pk = pk / 100.0;
-	power_mw_pk = pow(10,power_db_pk/10.0);
+	power_mw_pk = fast_db_to_lin(power_db_pk);
 
 	// Average power (1 second), milliwatts and dBm
 	p_avg_buf[c] = power_mw;				// Add the newest value onto ring buffer
@@ -307,7 +628,7 @@ void imp_calc_Power(void)
 	c++;									// Rotate window by advancing ring buffer counter
 	if (c == AVG_BUF) c = 0;
 	power_mw_avg = p_plus / (AVG_BUF);		// And finally, find the average
-	power_db_avg = 10 * log10(power_mw_avg);
+	power_db_avg = fast_lin_to_db(power_mw_avg);
 
 	//// Modulation index in a 1s window
 	//double v1, v2;
@@ -317,5 +638,6 @@ void imp_calc_Power(void)
 	
 	imp_calc_SWR();
 }
+#endif
 
-#endif					// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
\ No newline at end of file
+#endif					// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
\ No newline at end of file
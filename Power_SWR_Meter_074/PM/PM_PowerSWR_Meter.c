@@ -45,67 +45,109 @@
 
 
 #include "PM.h"
+#include "PM_FastMath.h"
 
 #if !PHASE_DETECTOR							// >>>>>>>>>>>>>>> Simple Power and SWR Meter Code
 //
 //-----------------------------------------------------------------------------------------
-// 			Convert Voltage Reading into Power
+// 			Precalculate the slope gradients from the calibration values
+//
+// There is not enough RAM for a lookup table entry per A/D value, instead the slope
+// gradient is precalculated as a fixed point integer with 12 fractional bits.  This is
+// redone whenever the calibration values change, whether by the Calibrate Menu,
+// USB $calset or a factory reset.
 //-----------------------------------------------------------------------------------------
 //
-void pswr_determine_dBm(void)
+static int32_t	fwd_slope;					// Forward dBm x 100 per A/D value, 12 fractional bits
+static int32_t	rev_slope;					// Reverse dBm x 100 per A/D value, 12 fractional bits
+static cal_t	slope_cal[2];				// Calibration values used for the slope gradients
+
+static int32_t pswr_slope(int16_t db100, int16_t delta)
 {
-	double 	delta_db;
+	double slope;
+	
+	if (delta == 0) return 0;				// Bad calibration
+	slope = 4096.0 * db100 / delta;
+	// Bounded to keep (V - V_Cal1) * slope_gradient within 32 bits
+	if (slope >  0x3ffff) slope =  0x3ffff;
+	if (slope < -0x3ffff) slope = -0x3ffff;
+	return slope;
+}
 
-	int16_t	delta_F, delta_R;
-	double	delta_Fdb, delta_Rdb;
-	double transfer;
+void pswr_cal_slopes_build(void)
+{
+	int16_t	delta_db100;
 
 	// Calculate the slope gradient between the two calibration points:
 	//
 	// (dB_Cal1 - dB_Cal2)/(V_Cal1 - V_Cal2) = slope_gradient
 	//
-	delta_db = (double)((R.cal_AD[1].db10m - R.cal_AD[0].db10m)/10.0);
-	delta_F = R.cal_AD[1].Fwd - R.cal_AD[0].Fwd;
-	delta_Fdb = delta_db/delta_F;
-	delta_R = R.cal_AD[1].Rev - R.cal_AD[0].Rev;
-	delta_Rdb = delta_db/delta_R;
-	//
+	delta_db100 = (R.cal_AD[1].db10m - R.cal_AD[0].db10m) * 10;
+	fwd_slope = pswr_slope(delta_db100, R.cal_AD[1].Fwd - R.cal_AD[0].Fwd);
+	rev_slope = pswr_slope(delta_db100, R.cal_AD[1].Rev - R.cal_AD[0].Rev);
+	memcpy(slope_cal, R.cal_AD, sizeof(slope_cal));
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Convert Voltage Reading into Power
+//-----------------------------------------------------------------------------------------
+//
+void pswr_determine_dBm(void)
+{
+	int32_t	f_db, r_db;
+	int16_t	transfer;
+
+	// Redo slope gradients if calibration has changed
+	if (memcmp(slope_cal, R.cal_AD, sizeof(slope_cal))) pswr_cal_slopes_build();
+
 	// measured dB values are: (V - V_Cal1) * slope_gradient + dB_Cal1
-	ad8307_FdBm = (ad8307_adF - R.cal_AD[0].Fwd) * delta_Fdb + R.cal_AD[0].db10m/10.0;
-	ad8307_RdBm = (ad8307_adR - R.cal_AD[0].Rev) * delta_Rdb + R.cal_AD[0].db10m/10.0;
+	f_db = (((int32_t) (ad8307_adF - R.cal_AD[0].Fwd) * fwd_slope) >> 12) + R.cal_AD[0].db10m * 10;
+	r_db = (((int32_t) (ad8307_adR - R.cal_AD[0].Rev) * rev_slope) >> 12) + R.cal_AD[0].db10m * 10;
+	if (f_db < DB100_MIN) f_db = DB100_MIN;
+	if (f_db > DB100_MAX) f_db = DB100_MAX;
+	if (r_db < DB100_MIN) r_db = DB100_MIN;
+	if (r_db > DB100_MAX) r_db = DB100_MAX;
+	ad8307_Fdb100 = f_db;
+	ad8307_Rdb100 = r_db;
 
 	// Test for direction of power - Always designate the higher power as "forward"
 	// while setting the "Reverse" flag on reverse condition.
-	if (ad8307_FdBm > ad8307_RdBm)	// Forward direction
+	if (ad8307_Fdb100 > ad8307_Rdb100)	// Forward direction
 	{
 		Reverse = FALSE;
 	}
 	else							// Reverse direction
 	{
-		transfer = ad8307_RdBm;
-		ad8307_RdBm = ad8307_FdBm;
-		ad8307_FdBm = transfer;
+		transfer = ad8307_Rdb100;
+		ad8307_Rdb100 = ad8307_Fdb100;
+		ad8307_Fdb100 = transfer;
 		Reverse = TRUE;
 	}
+	#if !FIXEDPOINT_ENABLED						// Otherwise done by pswr_calc_Derived()
+	ad8307_FdBm = ad8307_Fdb100 / 100.0;
+	ad8307_RdBm = ad8307_Rdb100 / 100.0;
+	#endif
 }
 
 //
 //-----------------------------------------------------------------------------------------
 // 			Calculate SWR if we have sufficient input power
+//			swr_log is 1000 x log10(SWR)
 //-----------------------------------------------------------------------------------------
 //
-void pswr_calc_SWR(double v_fwd, double v_rev)
+void pswr_calc_SWR(uint16_t swr_log)
 {
 	// Only calculate SWR if meaningful power
 
 	if ((power_mw > MIN_PWR_FOR_SWR_CALC) || (power_mw < -MIN_PWR_FOR_SWR_CALC))
 	{
-		// Calculate SWR
-		swr = (1+(v_rev/v_fwd))/(1-(v_rev/v_fwd));
+		// SWR from its logarithmic value:  10^(swr_log/1000)
+		swr = db100_to_mw(swr_log);
 
 		// prepare SWR bargraph value as a logarithmic integer value between 0 and 1000
-		if (swr < 10.0)
-		swr_bar = 1000.0 * log10(swr);
+		if (swr_log < 1000)
+		swr_bar = swr_log;
 		else
 		swr_bar = 1000;		// Show as maxed out above SWR 10:1
 
@@ -139,6 +181,165 @@ void pswr_calc_SWR(double v_fwd, double v_rev)
 }
 
 
+#if FIXEDPOINT_ENABLED
+//
+//-----------------------------------------------------------------------------------------
+// 			Fixed point measurement path
+//
+// Everything done per sample is integer only, in dBm x 100:
+// - 100ms Peak from a ring buffer which is only rescanned when the value leaving
+//   the window was the Peak
+// - PEP from a ring buffer holding the Peak of each 100ms block, up to 5s
+// - 1s Average from the power sums of each 100ms block, in units of 2^-24 mW.
+//   The sums are exact, hence do not drift like a floating point running sum
+// The floating point values for display and USB are derived from these once every
+// 100ms, by pswr_calc_Derived()
+//-----------------------------------------------------------------------------------------
+//
+static int16_t	pk_buff[PK_SAMPLES];		// dB x 100 in a 100ms window
+static int16_t	pk_max;						// Peak (100ms) dB x 100
+static uint8_t	pk_pos;						// 100ms ring buffer counter
+static int16_t	pep_buff[PEP_BLOCKS_MAX];	// Peak dB x 100 of each 100ms block
+static uint8_t	pep_pos;					// PEP ring buffer counter
+static uint64_t	avg_buff[AVG_BLOCKS];		// Power sum of each 100ms block
+static uint64_t	avg_sum;					// Power sum of all blocks in the 1s window
+static uint8_t	avg_pos;					// 1s average ring buffer counter
+static int16_t	blk_max;					// Peak dB x 100 within the current 100ms block
+static uint64_t	blk_sum;					// Power sum within the current 100ms block
+static uint8_t	blk_cnt;					// Samples within the current 100ms block
+static int16_t	p_db100;					// Latest Real Power Output in dB x 100
+static uint16_t	p_swr_log;					// Latest 1000 x log10(SWR)
+static BOOL		primed = FALSE;				// Ring buffers have been initialised
+
+static void pswr_rings_init(void)
+{
+	uint8_t x;
+
+	for (x = 0; x < PK_SAMPLES; x++) pk_buff[x] = DB100_MIN;
+	for (x = 0; x < PEP_BLOCKS_MAX; x++) pep_buff[x] = DB100_MIN;
+	pk_max = blk_max = p_db100 = DB100_MIN;
+	primed = TRUE;
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Calculate all kinds of power, integer only, once every sample
+//-----------------------------------------------------------------------------------------
+//
+void pswr_calc_Power(void)
+{
+	rl_t	rl;								// SWR and Mismatch Loss
+	int32_t	p_db;							// Real Power Output in dB x 100
+	int16_t	old;							// Value leaving the 100ms window
+	uint8_t	x;
+
+	if (!primed) pswr_rings_init();
+
+	// SWR and Mismatch Loss, both from the Return Loss
+	rl = rl_lookup(ad8307_Fdb100 - ad8307_Rdb100);
+	p_swr_log = rl.swr_log;
+
+	// Instantaneous Real Power Output, which is the forward power less the Mismatch Loss
+	p_db = (int32_t) ad8307_Fdb100 - rl.ml;
+	if (p_db < DB100_MIN) p_db = DB100_MIN;
+	p_db100 = p_db;
+
+	// Peak (100 milliseconds), only rescan if the Peak is leaving the window
+	old = pk_buff[pk_pos];
+	pk_buff[pk_pos] = p_db;
+	pk_pos++;
+	if (pk_pos == PK_SAMPLES) pk_pos = 0;
+	if (p_db >= pk_max) pk_max = p_db;
+	else if (old == pk_max)
+	{
+		pk_max = DB100_MIN;
+		for (x = 0; x < PK_SAMPLES; x++)
+		{
+			if (pk_max < pk_buff[x]) pk_max = pk_buff[x];
+		}
+	}
+
+	// Peak and Power sum within the current 100ms block
+	if (blk_max < p_db) blk_max = p_db;
+	blk_sum += db100_to_lin(p_db);
+	blk_cnt++;
+
+	if (blk_cnt == PK_SAMPLES)				// Once every 100ms, advance PEP and Average windows
+	{
+		pep_buff[pep_pos] = blk_max;
+		pep_pos++;
+		if (pep_pos == PEP_BLOCKS_MAX) pep_pos = 0;
+
+		avg_sum = avg_sum - avg_buff[avg_pos] + blk_sum;	// Exact, the same integer is subtracted
+		avg_buff[avg_pos] = blk_sum;						// when the block leaves the window
+		avg_pos++;
+		if (avg_pos == AVG_BLOCKS) avg_pos = 0;
+
+		blk_max = DB100_MIN;
+		blk_sum = 0;
+		blk_cnt = 0;
+	}
+}
+
+//
+//-----------------------------------------------------------------------------------------
+// 			Floating point Power and SWR values for display and USB,
+//			once every 100ms
+//-----------------------------------------------------------------------------------------
+//
+void pswr_calc_Derived(void)
+{
+	int16_t	max;							// PEP dB x 100
+	uint8_t	n, i, x;
+
+	if (!primed) pswr_rings_init();
+
+	ad8307_FdBm = ad8307_Fdb100 / 100.0;
+	ad8307_RdBm = ad8307_Rdb100 / 100.0;
+
+	// Instantaneous forward and reverse power, milliwatts and dBm
+	fwd_power_mw = db100_to_mw(ad8307_Fdb100);
+	fwd_power_db = ad8307_FdBm;
+	ref_power_mw = db100_to_mw(ad8307_Rdb100);
+	ref_power_db = ad8307_RdBm;
+
+	// Instantaneous Real Power Output
+	power_mw = db100_to_mw(p_db100);
+	power_db = p_db100 / 100.0;
+
+	// PEP, the current 100ms block and the R.PEP_period/20 blocks preceding it
+	n = R.PEP_period / 20;
+	if (n > PEP_BLOCKS_MAX) n = PEP_BLOCKS_MAX;
+	max = blk_max;
+	i = pep_pos;
+	for (x = 0; x < n; x++)
+	{
+		i = i ? i - 1 : PEP_BLOCKS_MAX - 1;
+		if (max < pep_buff[i]) max = pep_buff[i];
+	}
+	power_db_pep = max / 100.0;
+	power_mw_pep = db100_to_mw(max);
+
+	// Peak (100 milliseconds)
+	power_db_pk = pk_max / 100.0;
+	power_mw_pk = db100_to_mw(pk_max);
+
+	// Average power (1 second), milliwatts and dBm
+	if (avg_sum)
+	{
+		power_mw_avg = avg_sum * (1.0 / ((double) AVG_BLOCKS * PK_SAMPLES * (1UL << LIN_SHIFT)));
+		power_db_avg = fast_lin_to_db(power_mw_avg);
+	}
+	else									// Below the resolution of the sums
+	{
+		power_mw_avg = db100_to_mw(DB100_MIN);
+		power_db_avg = DB100_MIN / 100.0;
+	}
+
+	pswr_calc_SWR(p_swr_log);
+}
+
+#else
 //
 //-----------------------------------------------------------------------------------------
 // 			Calculate all kinds of power
@@ -150,8 +351,8 @@ void pswr_calc_Power(void)
 	#define	BUF_SHORT	20					// Buffer size for 100ms Peak
 	#define	AVG_BUF		200					// Buffer size for 1s Average measurement
 
-	double f_inst;							// Calculated Forward voltage
-	double r_inst;							// Calculated Reverse voltage
+	rl_t	rl;								// SWR and Mismatch Loss
+	int32_t	p_db;							// Real Power Output in dB x 100
 	
 	// For measurement of peak and average power
 	static int16_t db_buff[PEP_BUFFER];		// dB voltage information in a one second window
@@ -163,24 +364,25 @@ void pswr_calc_Power(void)
 	static uint8_t c=0;						// 1s average ring buffer counter
 	int16_t max=-32767, pk=-32767;			// Keep track of Max (1s) and Peak (100ms) dB voltage
 
-	// Instantaneous forward voltage and power, milliwatts and dBm
-	f_inst = pow(10,ad8307_FdBm/20.0);		// (We use voltage later on, for SWR calc)
-	fwd_power_mw = SQR(f_inst);				// P_mw = (V*V) (current and resistance have already been factored in
-	fwd_power_db = 10 * log10(fwd_power_mw);
-	
-	// Instantaneous reverse voltage and power
-	r_inst = pow(10,(ad8307_RdBm)/20.0);
-	ref_power_mw = SQR(r_inst);
-	ref_power_db = 10 * log10(ref_power_mw);
+	// Instantaneous forward and reverse power, milliwatts and dBm
+	// (current and resistance have already been factored in)
+	fwd_power_mw = db100_to_mw(ad8307_Fdb100);
+	fwd_power_db = ad8307_FdBm;
+	ref_power_mw = db100_to_mw(ad8307_Rdb100);
+	ref_power_db = ad8307_RdBm;
 	
-	// Instantaneous Real Power Output
-	power_mw = fwd_power_mw - ref_power_mw;
-	power_db = 10 * log10(power_mw);
+	// SWR and Mismatch Loss, both from the Return Loss
+	rl = rl_lookup(ad8307_Fdb100 - ad8307_Rdb100);
+
+	// Instantaneous Real Power Output, which is the forward power less the Mismatch Loss
+	p_db = (int32_t) ad8307_Fdb100 - rl.ml;
+	if (p_db < DB100_MIN) p_db = DB100_MIN;
+	power_mw = db100_to_mw(p_db);
+	power_db = p_db / 100.0;
 
 	// Find peaks and averages
-	// Multiply by 100 to make suitable for integer value
-	// Store dB value in two ring buffers
-	db_buff[a] = db_buff_short[b] = 100 * power_db;
+	// Store dB value x 100 in two ring buffers
+	db_buff[a] = db_buff_short[b] = p_db;
 	// Advance PEP (1, 2.5 or 5s) and 100ms ringbuffer counters
 	a++, b++;
 	if (a >= R.PEP_period) a = 0;
@@ -200,11 +402,11 @@ void pswr_calc_Power(void)
 
 	// PEP
 	power_db_pep = max / 100.0;
-	power_mw_pep = pow(10,power_db_pep/10.0);
+	power_mw_pep = db100_to_mw(max);
 	
 	// Peak (100 milliseconds)
 	power_db_pk = pk / 100.0;
-	power_mw_pk = pow(10,power_db_pk/10.0);
+	power_mw_pk = db100_to_mw(pk);
 	
 	// Average power (1 second), milliwatts and dBm
 	p_avg_buf[c] = power_mw;				// Add the newest value onto ring buffer
@@ -216,7 +418,7 @@ void pswr_calc_Power(void)
 	c++;									// Rotate window by advancing ring buffer counter
 	if (c == AVG_BUF) c = 0;
 	power_mw_avg = p_plus / (AVG_BUF);		// And finally, find the average
-	power_db_avg = 10 * log10(power_mw_avg);
+	power_db_avg = fast_lin_to_db(power_mw_avg);
 
 
 	//// Modulation index in a 1s window
@@ -225,7 +427,8 @@ void pswr_calc_Power(void)
 	//v2 = sqrt(ABS(power_mw_avg));
 	//modulation_index = (v1-v2) / v2;
 	
-	pswr_calc_SWR(f_inst, r_inst);
+	pswr_calc_SWR(rl.swr_log);
 }
+#endif
 
-#endif					// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
\ No newline at end of file
+#endif					// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> End Power&Phase vs Power&SWR code selection
\ No newline at end of file
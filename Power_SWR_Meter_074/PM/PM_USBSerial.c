@@ -336,6 +336,10 @@ void usb_poll_long(void)
 //
 //			$version			Report version and date of firmware
 //
+//			$perf				Report time spent in measurement, display and USB code paths,
+//								min, avg and max in microseconds
+//			$perfreset			Clear the above
+//
 //	In addition, the Power & Impedance Meter version of the code supports the following commands:
 //
 //			$phasesetu a.aaaa b.bbbb c.cccc		Commands to enter a set of calibrated MCK12140+MC100ELT23
@@ -671,6 +675,16 @@ void usb_parse_incoming(void)
 		sprintf(lcd_buf,"Rotary_Encoder_Resolution: %u\r\n",R.encoderRes);
 		usb_serial_write(lcd_buf,strlen(lcd_buf));
 	}
+	#if PERF_ENABLED
+	else if (!strcmp("perf",incoming_command_string))		// Report hot path profiler
+	{
+		perf_print();
+	}
+	else if (!strcmp("perfreset",incoming_command_string))	// Clear hot path profiler
+	{
+		perf_reset();
+	}
+	#endif
 
 	#if PHASE_DETECTOR	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Power & Phase Detector Code
 	else if (!strcmp("phasegetu",incoming_command_string))	// Retrieve Phase calibration values
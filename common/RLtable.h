@@ -0,0 +1,769 @@
+// Generated table of SWR and Mismatch Loss vs. Return Loss
+// Return Loss   : 0 to 60 dB in 0.01 dB steps, index is Return Loss in dB x 100
+// SWR           : 1000 x log10(SWR), saturated at 65535 (infinite SWR at 0 dB RL)
+// Mismatch Loss : dB x 100, saturated at 65535 (all power lost at 0 dB RL)
+//
+//   Gamma = 10^(-RL/20),  SWR = (1+Gamma)/(1-Gamma),  ML = -10*log10(1-Gamma^2)
+//
+// Shared by all three firmwares.  This file, common/RLtable.h, is the source;
+// _RLtable.h (PSWR_T_1xx, PSWR_A019b) and PM_RLtable.h are byte identical copies,
+// see common/fastmath.h.  PROGMEM comes from <avr/pgmspace.h> on AVR, Teensy 3.x
+// flash is directly addressable.
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+static const rl_t rl_table[RL100_MAX+1] PROGMEM = {
+  {65535,65535}, { 3240, 2638}, { 2939, 2338}, { 2763, 2162}, { 2638, 2038}, { 2541, 1941}, { 2462, 1863}, { 2395, 1796},   // RL  0.00 dB
+  { 2337, 1739}, { 2286, 1688}, { 2240, 1643}, { 2198, 1602}, { 2161, 1565}, { 2126, 1530}, { 2094, 1499}, { 2064, 1469},   // RL  0.08 dB
+  { 2036, 1442}, { 2009, 1416}, { 1985, 1391}, { 1961, 1368}, { 1939, 1347}, { 1918, 1326}, { 1897, 1306}, { 1878, 1288},   // RL  0.16 dB
+  { 1860, 1270}, { 1842, 1252}, { 1825, 1236}, { 1809, 1220}, { 1793, 1205}, { 1777, 1190}, { 1763, 1176}, { 1749, 1162},   // RL  0.24 dB
+  { 1735, 1149}, { 1721, 1136}, { 1708, 1123}, { 1696, 1111}, { 1684, 1099}, { 1672, 1088}, { 1660, 1077}, { 1649, 1066},   // RL  0.32 dB
+  { 1638, 1056}, { 1627, 1045}, { 1617, 1035}, { 1606, 1026}, { 1596, 1016}, { 1587, 1007}, { 1577,  998}, { 1568,  989},   // RL  0.40 dB
+  { 1559,  980}, { 1550,  972}, { 1541,  964}, { 1532,  955}, { 1524,  948}, { 1516,  940}, { 1508,  932}, { 1500,  925},   // RL  0.48 dB
+  { 1492,  917}, { 1484,  910}, { 1477,  903}, { 1469,  896}, { 1462,  889}, { 1455,  883}, { 1448,  876}, { 1441,  870},   // RL  0.56 dB
+  { 1434,  863}, { 1427,  857}, { 1421,  851}, { 1414,  845}, { 1408,  839}, { 1401,  833}, { 1395,  827}, { 1389,  822},   // RL  0.64 dB
+  { 1383,  816}, { 1377,  810}, { 1371,  805}, { 1365,  800}, { 1359,  794}, { 1354,  789}, { 1348,  784}, { 1343,  779},   // RL  0.72 dB
+  { 1337,  774}, { 1332,  769}, { 1326,  764}, { 1321,  760}, { 1316,  755}, { 1311,  750}, { 1306,  746}, { 1301,  741},   // RL  0.80 dB
+  { 1296,  737}, { 1291,  732}, { 1286,  728}, { 1281,  723}, { 1276,  719}, { 1272,  715}, { 1267,  711}, { 1263,  707},   // RL  0.88 dB
+  { 1258,  703}, { 1254,  699}, { 1249,  695}, { 1245,  691}, { 1240,  687}, { 1236,  683}, { 1232,  679}, { 1228,  675},   // RL  0.96 dB
+  { 1223,  672}, { 1219,  668}, { 1215,  664}, { 1211,  661}, { 1207,  657}, { 1203,  654}, { 1199,  650}, { 1195,  647},   // RL  1.04 dB
+  { 1191,  643}, { 1187,  640}, { 1184,  637}, { 1180,  633}, { 1176,  630}, { 1172,  627}, { 1169,  624}, { 1165,  620},   // RL  1.12 dB
+  { 1161,  617}, { 1158,  614}, { 1154,  611}, { 1151,  608}, { 1147,  605}, { 1144,  602}, { 1140,  599}, { 1137,  596},   // RL  1.20 dB
+  { 1133,  593}, { 1130,  590}, { 1127,  587}, { 1123,  584}, { 1120,  582}, { 1117,  579}, { 1114,  576}, { 1110,  573},   // RL  1.28 dB
+  { 1107,  570}, { 1104,  568}, { 1101,  565}, { 1098,  562}, { 1095,  560}, { 1092,  557}, { 1089,  555}, { 1085,  552},   // RL  1.36 dB
+  { 1082,  549}, { 1079,  547}, { 1077,  544}, { 1074,  542}, { 1071,  539}, { 1068,  537}, { 1065,  535}, { 1062,  532},   // RL  1.44 dB
+  { 1059,  530}, { 1056,  527}, { 1053,  525}, { 1051,  523}, { 1048,  520}, { 1045,  518}, { 1042,  516}, { 1040,  513},   // RL  1.52 dB
+  { 1037,  511}, { 1034,  509}, { 1032,  507}, { 1029,  505}, { 1026,  502}, { 1024,  500}, { 1021,  498}, { 1018,  496},   // RL  1.60 dB
+  { 1016,  494}, { 1013,  492}, { 1011,  490}, { 1008,  487}, { 1006,  485}, { 1003,  483}, { 1001,  481}, {  998,  479},   // RL  1.68 dB
+  {  996,  477}, {  993,  475}, {  991,  473}, {  989,  471}, {  986,  469}, {  984,  467}, {  981,  466}, {  979,  464},   // RL  1.76 dB
+  {  977,  462}, {  974,  460}, {  972,  458}, {  970,  456}, {  967,  454}, {  965,  452}, {  963,  451}, {  961,  449},   // RL  1.84 dB
+  {  958,  447}, {  956,  445}, {  954,  443}, {  952,  442}, {  949,  440}, {  947,  438}, {  945,  436}, {  943,  435},   // RL  1.92 dB
+  {  941,  433}, {  939,  431}, {  936,  430}, {  934,  428}, {  932,  426}, {  930,  425}, {  928,  423}, {  926,  421},   // RL  2.00 dB
+  {  924,  420}, {  922,  418}, {  920,  416}, {  918,  415}, {  916,  413}, {  914,  412}, {  912,  410}, {  910,  408},   // RL  2.08 dB
+  {  908,  407}, {  906,  405}, {  904,  404}, {  902,  402}, {  900,  401}, {  898,  399}, {  896,  398}, {  894,  396},   // RL  2.16 dB
+  {  892,  395}, {  890,  393}, {  888,  392}, {  886,  390}, {  884,  389}, {  883,  387}, {  881,  386}, {  879,  385},   // RL  2.24 dB
+  {  877,  383}, {  875,  382}, {  873,  380}, {  871,  379}, {  870,  378}, {  868,  376}, {  866,  375}, {  864,  373},   // RL  2.32 dB
+  {  862,  372}, {  861,  371}, {  859,  369}, {  857,  368}, {  855,  367}, {  854,  365}, {  852,  364}, {  850,  363},   // RL  2.40 dB
+  {  848,  361}, {  847,  360}, {  845,  359}, {  843,  358}, {  841,  356}, {  840,  355}, {  838,  354}, {  836,  353},   // RL  2.48 dB
+  {  835,  351}, {  833,  350}, {  831,  349}, {  830,  348}, {  828,  346}, {  826,  345}, {  825,  344}, {  823,  343},   // RL  2.56 dB
+  {  822,  342}, {  820,  340}, {  818,  339}, {  817,  338}, {  815,  337}, {  814,  336}, {  812,  334}, {  810,  333},   // RL  2.64 dB
+  {  809,  332}, {  807,  331}, {  806,  330}, {  804,  329}, {  803,  328}, {  801,  326}, {  799,  325}, {  798,  324},   // RL  2.72 dB
+  {  796,  323}, {  795,  322}, {  793,  321}, {  792,  320}, {  790,  319}, {  789,  318}, {  787,  317}, {  786,  316},   // RL  2.80 dB
+  {  784,  314}, {  783,  313}, {  781,  312}, {  780,  311}, {  779,  310}, {  777,  309}, {  776,  308}, {  774,  307},   // RL  2.88 dB
+  {  773,  306}, {  771,  305}, {  770,  304}, {  768,  303}, {  767,  302}, {  766,  301}, {  764,  300}, {  763,  299},   // RL  2.96 dB
+  {  761,  298}, {  760,  297}, {  759,  296}, {  757,  295}, {  756,  294}, {  754,  293}, {  753,  292}, {  752,  291},   // RL  3.04 dB
+  {  750,  290}, {  749,  289}, {  748,  288}, {  746,  287}, {  745,  287}, {  744,  286}, {  742,  285}, {  741,  284},   // RL  3.12 dB
+  {  740,  283}, {  738,  282}, {  737,  281}, {  736,  280}, {  734,  279}, {  733,  278}, {  732,  277}, {  730,  277},   // RL  3.20 dB
+  {  729,  276}, {  728,  275}, {  727,  274}, {  725,  273}, {  724,  272}, {  723,  271}, {  721,  270}, {  720,  270},   // RL  3.28 dB
+  {  719,  269}, {  718,  268}, {  716,  267}, {  715,  266}, {  714,  265}, {  713,  264}, {  711,  264}, {  710,  263},   // RL  3.36 dB
+  {  709,  262}, {  708,  261}, {  706,  260}, {  705,  259}, {  704,  259}, {  703,  258}, {  702,  257}, {  700,  256},   // RL  3.44 dB
+  {  699,  255}, {  698,  255}, {  697,  254}, {  696,  253}, {  694,  252}, {  693,  251}, {  692,  251}, {  691,  250},   // RL  3.52 dB
+  {  690,  249}, {  689,  248}, {  687,  248}, {  686,  247}, {  685,  246}, {  684,  245}, {  683,  245}, {  682,  244},   // RL  3.60 dB
+  {  680,  243}, {  679,  242}, {  678,  242}, {  677,  241}, {  676,  240}, {  675,  239}, {  674,  239}, {  672,  238},   // RL  3.68 dB
+  {  671,  237}, {  670,  236}, {  669,  236}, {  668,  235}, {  667,  234}, {  666,  234}, {  665,  233}, {  664,  232},   // RL  3.76 dB
+  {  663,  231}, {  661,  231}, {  660,  230}, {  659,  229}, {  658,  229}, {  657,  228}, {  656,  227}, {  655,  227},   // RL  3.84 dB
+  {  654,  226}, {  653,  225}, {  652,  224}, {  651,  224}, {  650,  223}, {  649,  222}, {  647,  222}, {  646,  221},   // RL  3.92 dB
+  {  645,  220}, {  644,  220}, {  643,  219}, {  642,  219}, {  641,  218}, {  640,  217}, {  639,  217}, {  638,  216},   // RL  4.00 dB
+  {  637,  215}, {  636,  215}, {  635,  214}, {  634,  213}, {  633,  213}, {  632,  212}, {  631,  211}, {  630,  211},   // RL  4.08 dB
+  {  629,  210}, {  628,  210}, {  627,  209}, {  626,  208}, {  625,  208}, {  624,  207}, {  623,  207}, {  622,  206},   // RL  4.16 dB
+  {  621,  205}, {  620,  205}, {  619,  204}, {  618,  204}, {  617,  203}, {  616,  202}, {  615,  202}, {  614,  201},   // RL  4.24 dB
+  {  613,  201}, {  612,  200}, {  611,  199}, {  610,  199}, {  609,  198}, {  608,  198}, {  607,  197}, {  606,  196},   // RL  4.32 dB
+  {  606,  196}, {  605,  195}, {  604,  195}, {  603,  194}, {  602,  194}, {  601,  193}, {  600,  193}, {  599,  192},   // RL  4.40 dB
+  {  598,  191}, {  597,  191}, {  596,  190}, {  595,  190}, {  594,  189}, {  593,  189}, {  593,  188}, {  592,  188},   // RL  4.48 dB
+  {  591,  187}, {  590,  187}, {  589,  186}, {  588,  185}, {  587,  185}, {  586,  184}, {  585,  184}, {  584,  183},   // RL  4.56 dB
+  {  583,  183}, {  583,  182}, {  582,  182}, {  581,  181}, {  580,  181}, {  579,  180}, {  578,  180}, {  577,  179},   // RL  4.64 dB
+  {  576,  179}, {  576,  178}, {  575,  178}, {  574,  177}, {  573,  177}, {  572,  176}, {  571,  176}, {  570,  175},   // RL  4.72 dB
+  {  569,  175}, {  569,  174}, {  568,  174}, {  567,  173}, {  566,  173}, {  565,  172}, {  564,  172}, {  563,  171},   // RL  4.80 dB
+  {  563,  171}, {  562,  170}, {  561,  170}, {  560,  169}, {  559,  169}, {  558,  168}, {  558,  168}, {  557,  167},   // RL  4.88 dB
+  {  556,  167}, {  555,  166}, {  554,  166}, {  553,  166}, {  553,  165}, {  552,  165}, {  551,  164}, {  550,  164},   // RL  4.96 dB
+  {  549,  163}, {  549,  163}, {  548,  162}, {  547,  162}, {  546,  161}, {  545,  161}, {  545,  161}, {  544,  160},   // RL  5.04 dB
+  {  543,  160}, {  542,  159}, {  541,  159}, {  541,  158}, {  540,  158}, {  539,  157}, {  538,  157}, {  537,  157},   // RL  5.12 dB
+  {  537,  156}, {  536,  156}, {  535,  155}, {  534,  155}, {  533,  154}, {  533,  154}, {  532,  154}, {  531,  153},   // RL  5.20 dB
+  {  530,  153}, {  530,  152}, {  529,  152}, {  528,  151}, {  527,  151}, {  526,  151}, {  526,  150}, {  525,  150},   // RL  5.28 dB
+  {  524,  149}, {  523,  149}, {  523,  149}, {  522,  148}, {  521,  148}, {  520,  147}, {  520,  147}, {  519,  147},   // RL  5.36 dB
+  {  518,  146}, {  517,  146}, {  517,  145}, {  516,  145}, {  515,  145}, {  514,  144}, {  514,  144}, {  513,  143},   // RL  5.44 dB
+  {  512,  143}, {  511,  143}, {  511,  142}, {  510,  142}, {  509,  141}, {  509,  141}, {  508,  141}, {  507,  140},   // RL  5.52 dB
+  {  506,  140}, {  506,  140}, {  505,  139}, {  504,  139}, {  503,  138}, {  503,  138}, {  502,  138}, {  501,  137},   // RL  5.60 dB
+  {  501,  137}, {  500,  137}, {  499,  136}, {  498,  136}, {  498,  135}, {  497,  135}, {  496,  135}, {  496,  134},   // RL  5.68 dB
+  {  495,  134}, {  494,  134}, {  494,  133}, {  493,  133}, {  492,  133}, {  491,  132}, {  491,  132}, {  490,  131},   // RL  5.76 dB
+  {  489,  131}, {  489,  131}, {  488,  130}, {  487,  130}, {  487,  130}, {  486,  129}, {  485,  129}, {  485,  129},   // RL  5.84 dB
+  {  484,  128}, {  483,  128}, {  483,  128}, {  482,  127}, {  481,  127}, {  481,  127}, {  480,  126}, {  479,  126},   // RL  5.92 dB
+  {  478,  126}, {  478,  125}, {  477,  125}, {  476,  125}, {  476,  124}, {  475,  124}, {  475,  124}, {  474,  123},   // RL  6.00 dB
+  {  473,  123}, {  473,  123}, {  472,  122}, {  471,  122}, {  471,  122}, {  470,  121}, {  469,  121}, {  469,  121},   // RL  6.08 dB
+  {  468,  120}, {  467,  120}, {  467,  120}, {  466,  119}, {  465,  119}, {  465,  119}, {  464,  118}, {  463,  118},   // RL  6.16 dB
+  {  463,  118}, {  462,  118}, {  462,  117}, {  461,  117}, {  460,  117}, {  460,  116}, {  459,  116}, {  458,  116},   // RL  6.24 dB
+  {  458,  115}, {  457,  115}, {  456,  115}, {  456,  114}, {  455,  114}, {  455,  114}, {  454,  114}, {  453,  113},   // RL  6.32 dB
+  {  453,  113}, {  452,  113}, {  451,  112}, {  451,  112}, {  450,  112}, {  450,  112}, {  449,  111}, {  448,  111},   // RL  6.40 dB
+  {  448,  111}, {  447,  110}, {  447,  110}, {  446,  110}, {  445,  109}, {  445,  109}, {  444,  109}, {  444,  109},   // RL  6.48 dB
+  {  443,  108}, {  442,  108}, {  442,  108}, {  441,  108}, {  441,  107}, {  440,  107}, {  439,  107}, {  439,  106},   // RL  6.56 dB
+  {  438,  106}, {  438,  106}, {  437,  106}, {  436,  105}, {  436,  105}, {  435,  105}, {  435,  104}, {  434,  104},   // RL  6.64 dB
+  {  433,  104}, {  433,  104}, {  432,  103}, {  432,  103}, {  431,  103}, {  430,  103}, {  430,  102}, {  429,  102},   // RL  6.72 dB
+  {  429,  102}, {  428,  102}, {  428,  101}, {  427,  101}, {  426,  101}, {  426,  100}, {  425,  100}, {  425,  100},   // RL  6.80 dB
+  {  424,  100}, {  424,   99}, {  423,   99}, {  422,   99}, {  422,   99}, {  421,   98}, {  421,   98}, {  420,   98},   // RL  6.88 dB
+  {  420,   98}, {  419,   97}, {  419,   97}, {  418,   97}, {  417,   97}, {  417,   96}, {  416,   96}, {  416,   96},   // RL  6.96 dB
+  {  415,   96}, {  415,   95}, {  414,   95}, {  414,   95}, {  413,   95}, {  412,   94}, {  412,   94}, {  411,   94},   // RL  7.04 dB
+  {  411,   94}, {  410,   93}, {  410,   93}, {  409,   93}, {  409,   93}, {  408,   93}, {  408,   92}, {  407,   92},   // RL  7.12 dB
+  {  406,   92}, {  406,   92}, {  405,   91}, {  405,   91}, {  404,   91}, {  404,   91}, {  403,   90}, {  403,   90},   // RL  7.20 dB
+  {  402,   90}, {  402,   90}, {  401,   89}, {  401,   89}, {  400,   89}, {  399,   89}, {  399,   89}, {  398,   88},   // RL  7.28 dB
+  {  398,   88}, {  397,   88}, {  397,   88}, {  396,   87}, {  396,   87}, {  395,   87}, {  395,   87}, {  394,   87},   // RL  7.36 dB
+  {  394,   86}, {  393,   86}, {  393,   86}, {  392,   86}, {  392,   85}, {  391,   85}, {  391,   85}, {  390,   85},   // RL  7.44 dB
+  {  390,   85}, {  389,   84}, {  389,   84}, {  388,   84}, {  388,   84}, {  387,   84}, {  387,   83}, {  386,   83},   // RL  7.52 dB
+  {  386,   83}, {  385,   83}, {  385,   82}, {  384,   82}, {  384,   82}, {  383,   82}, {  383,   82}, {  382,   81},   // RL  7.60 dB
+  {  382,   81}, {  381,   81}, {  381,   81}, {  380,   81}, {  380,   80}, {  379,   80}, {  379,   80}, {  378,   80},   // RL  7.68 dB
+  {  378,   80}, {  377,   79}, {  377,   79}, {  376,   79}, {  376,   79}, {  375,   79}, {  375,   78}, {  374,   78},   // RL  7.76 dB
+  {  374,   78}, {  373,   78}, {  373,   78}, {  372,   77}, {  372,   77}, {  371,   77}, {  371,   77}, {  370,   77},   // RL  7.84 dB
+  {  370,   76}, {  369,   76}, {  369,   76}, {  368,   76}, {  368,   76}, {  367,   76}, {  367,   75}, {  366,   75},   // RL  7.92 dB
+  {  366,   75}, {  366,   75}, {  365,   75}, {  365,   74}, {  364,   74}, {  364,   74}, {  363,   74}, {  363,   74},   // RL  8.00 dB
+  {  362,   73}, {  362,   73}, {  361,   73}, {  361,   73}, {  360,   73}, {  360,   73}, {  359,   72}, {  359,   72},   // RL  8.08 dB
+  {  359,   72}, {  358,   72}, {  358,   72}, {  357,   71}, {  357,   71}, {  356,   71}, {  356,   71}, {  355,   71},   // RL  8.16 dB
+  {  355,   71}, {  354,   70}, {  354,   70}, {  354,   70}, {  353,   70}, {  353,   70}, {  352,   70}, {  352,   69},   // RL  8.24 dB
+  {  351,   69}, {  351,   69}, {  350,   69}, {  350,   69}, {  349,   68}, {  349,   68}, {  349,   68}, {  348,   68},   // RL  8.32 dB
+  {  348,   68}, {  347,   68}, {  347,   67}, {  346,   67}, {  346,   67}, {  345,   67}, {  345,   67}, {  345,   67},   // RL  8.40 dB
+  {  344,   66}, {  344,   66}, {  343,   66}, {  343,   66}, {  342,   66}, {  342,   66}, {  342,   65}, {  341,   65},   // RL  8.48 dB
+  {  341,   65}, {  340,   65}, {  340,   65}, {  339,   65}, {  339,   65}, {  338,   64}, {  338,   64}, {  338,   64},   // RL  8.56 dB
+  {  337,   64}, {  337,   64}, {  336,   64}, {  336,   63}, {  335,   63}, {  335,   63}, {  335,   63}, {  334,   63},   // RL  8.64 dB
+  {  334,   63}, {  333,   62}, {  333,   62}, {  333,   62}, {  332,   62}, {  332,   62}, {  331,   62}, {  331,   62},   // RL  8.72 dB
+  {  330,   61}, {  330,   61}, {  330,   61}, {  329,   61}, {  329,   61}, {  328,   61}, {  328,   60}, {  328,   60},   // RL  8.80 dB
+  {  327,   60}, {  327,   60}, {  326,   60}, {  326,   60}, {  325,   60}, {  325,   59}, {  325,   59}, {  324,   59},   // RL  8.88 dB
+  {  324,   59}, {  323,   59}, {  323,   59}, {  323,   59}, {  322,   58}, {  322,   58}, {  321,   58}, {  321,   58},   // RL  8.96 dB
+  {  321,   58}, {  320,   58}, {  320,   58}, {  319,   57}, {  319,   57}, {  319,   57}, {  318,   57}, {  318,   57},   // RL  9.04 dB
+  {  317,   57}, {  317,   57}, {  317,   56}, {  316,   56}, {  316,   56}, {  315,   56}, {  315,   56}, {  315,   56},   // RL  9.12 dB
+  {  314,   56}, {  314,   55}, {  313,   55}, {  313,   55}, {  313,   55}, {  312,   55}, {  312,   55}, {  311,   55},   // RL  9.20 dB
+  {  311,   55}, {  311,   54}, {  310,   54}, {  310,   54}, {  310,   54}, {  309,   54}, {  309,   54}, {  308,   54},   // RL  9.28 dB
+  {  308,   53}, {  308,   53}, {  307,   53}, {  307,   53}, {  306,   53}, {  306,   53}, {  306,   53}, {  305,   53},   // RL  9.36 dB
+  {  305,   52}, {  305,   52}, {  304,   52}, {  304,   52}, {  303,   52}, {  303,   52}, {  303,   52}, {  302,   52},   // RL  9.44 dB
+  {  302,   51}, {  301,   51}, {  301,   51}, {  301,   51}, {  300,   51}, {  300,   51}, {  300,   51}, {  299,   51},   // RL  9.52 dB
+  {  299,   50}, {  299,   50}, {  298,   50}, {  298,   50}, {  297,   50}, {  297,   50}, {  297,   50}, {  296,   50},   // RL  9.60 dB
+  {  296,   49}, {  296,   49}, {  295,   49}, {  295,   49}, {  294,   49}, {  294,   49}, {  294,   49}, {  293,   49},   // RL  9.68 dB
+  {  293,   49}, {  293,   48}, {  292,   48}, {  292,   48}, {  292,   48}, {  291,   48}, {  291,   48}, {  290,   48},   // RL  9.76 dB
+  {  290,   48}, {  290,   47}, {  289,   47}, {  289,   47}, {  289,   47}, {  288,   47}, {  288,   47}, {  288,   47},   // RL  9.84 dB
+  {  287,   47}, {  287,   47}, {  287,   46}, {  286,   46}, {  286,   46}, {  285,   46}, {  285,   46}, {  285,   46},   // RL  9.92 dB
+  {  284,   46}, {  284,   46}, {  284,   46}, {  283,   45}, {  283,   45}, {  283,   45}, {  282,   45}, {  282,   45},   // RL 10.00 dB
+  {  282,   45}, {  281,   45}, {  281,   45}, {  281,   45}, {  280,   44}, {  280,   44}, {  280,   44}, {  279,   44},   // RL 10.08 dB
+  {  279,   44}, {  279,   44}, {  278,   44}, {  278,   44}, {  277,   44}, {  277,   43}, {  277,   43}, {  276,   43},   // RL 10.16 dB
+  {  276,   43}, {  276,   43}, {  275,   43}, {  275,   43}, {  275,   43}, {  274,   43}, {  274,   43}, {  274,   42},   // RL 10.24 dB
+  {  273,   42}, {  273,   42}, {  273,   42}, {  272,   42}, {  272,   42}, {  272,   42}, {  271,   42}, {  271,   42},   // RL 10.32 dB
+  {  271,   42}, {  270,   41}, {  270,   41}, {  270,   41}, {  269,   41}, {  269,   41}, {  269,   41}, {  268,   41},   // RL 10.40 dB
+  {  268,   41}, {  268,   41}, {  267,   41}, {  267,   40}, {  267,   40}, {  266,   40}, {  266,   40}, {  266,   40},   // RL 10.48 dB
+  {  265,   40}, {  265,   40}, {  265,   40}, {  265,   40}, {  264,   40}, {  264,   39}, {  264,   39}, {  263,   39},   // RL 10.56 dB
+  {  263,   39}, {  263,   39}, {  262,   39}, {  262,   39}, {  262,   39}, {  261,   39}, {  261,   39}, {  261,   39},   // RL 10.64 dB
+  {  260,   38}, {  260,   38}, {  260,   38}, {  259,   38}, {  259,   38}, {  259,   38}, {  258,   38}, {  258,   38},   // RL 10.72 dB
+  {  258,   38}, {  258,   38}, {  257,   38}, {  257,   37}, {  257,   37}, {  256,   37}, {  256,   37}, {  256,   37},   // RL 10.80 dB
+  {  255,   37}, {  255,   37}, {  255,   37}, {  254,   37}, {  254,   37}, {  254,   37}, {  253,   36}, {  253,   36},   // RL 10.88 dB
+  {  253,   36}, {  253,   36}, {  252,   36}, {  252,   36}, {  252,   36}, {  251,   36}, {  251,   36}, {  251,   36},   // RL 10.96 dB
+  {  250,   36}, {  250,   36}, {  250,   35}, {  249,   35}, {  249,   35}, {  249,   35}, {  249,   35}, {  248,   35},   // RL 11.04 dB
+  {  248,   35}, {  248,   35}, {  247,   35}, {  247,   35}, {  247,   35}, {  246,   35}, {  246,   34}, {  246,   34},   // RL 11.12 dB
+  {  246,   34}, {  245,   34}, {  245,   34}, {  245,   34}, {  244,   34}, {  244,   34}, {  244,   34}, {  243,   34},   // RL 11.20 dB
+  {  243,   34}, {  243,   34}, {  243,   33}, {  242,   33}, {  242,   33}, {  242,   33}, {  241,   33}, {  241,   33},   // RL 11.28 dB
+  {  241,   33}, {  241,   33}, {  240,   33}, {  240,   33}, {  240,   33}, {  239,   33}, {  239,   33}, {  239,   32},   // RL 11.36 dB
+  {  239,   32}, {  238,   32}, {  238,   32}, {  238,   32}, {  237,   32}, {  237,   32}, {  237,   32}, {  237,   32},   // RL 11.44 dB
+  {  236,   32}, {  236,   32}, {  236,   32}, {  235,   32}, {  235,   31}, {  235,   31}, {  235,   31}, {  234,   31},   // RL 11.52 dB
+  {  234,   31}, {  234,   31}, {  233,   31}, {  233,   31}, {  233,   31}, {  233,   31}, {  232,   31}, {  232,   31},   // RL 11.60 dB
+  {  232,   31}, {  231,   30}, {  231,   30}, {  231,   30}, {  231,   30}, {  230,   30}, {  230,   30}, {  230,   30},   // RL 11.68 dB
+  {  229,   30}, {  229,   30}, {  229,   30}, {  229,   30}, {  228,   30}, {  228,   30}, {  228,   30}, {  228,   29},   // RL 11.76 dB
+  {  227,   29}, {  227,   29}, {  227,   29}, {  226,   29}, {  226,   29}, {  226,   29}, {  226,   29}, {  225,   29},   // RL 11.84 dB
+  {  225,   29}, {  225,   29}, {  225,   29}, {  224,   29}, {  224,   29}, {  224,   29}, {  223,   28}, {  223,   28},   // RL 11.92 dB
+  {  223,   28}, {  223,   28}, {  222,   28}, {  222,   28}, {  222,   28}, {  222,   28}, {  221,   28}, {  221,   28},   // RL 12.00 dB
+  {  221,   28}, {  221,   28}, {  220,   28}, {  220,   28}, {  220,   28}, {  219,   27}, {  219,   27}, {  219,   27},   // RL 12.08 dB
+  {  219,   27}, {  218,   27}, {  218,   27}, {  218,   27}, {  218,   27}, {  217,   27}, {  217,   27}, {  217,   27},   // RL 12.16 dB
+  {  217,   27}, {  216,   27}, {  216,   27}, {  216,   27}, {  216,   26}, {  215,   26}, {  215,   26}, {  215,   26},   // RL 12.24 dB
+  {  215,   26}, {  214,   26}, {  214,   26}, {  214,   26}, {  214,   26}, {  213,   26}, {  213,   26}, {  213,   26},   // RL 12.32 dB
+  {  213,   26}, {  212,   26}, {  212,   26}, {  212,   26}, {  211,   25}, {  211,   25}, {  211,   25}, {  211,   25},   // RL 12.40 dB
+  {  210,   25}, {  210,   25}, {  210,   25}, {  210,   25}, {  209,   25}, {  209,   25}, {  209,   25}, {  209,   25},   // RL 12.48 dB
+  {  208,   25}, {  208,   25}, {  208,   25}, {  208,   25}, {  207,   25}, {  207,   24}, {  207,   24}, {  207,   24},   // RL 12.56 dB
+  {  206,   24}, {  206,   24}, {  206,   24}, {  206,   24}, {  206,   24}, {  205,   24}, {  205,   24}, {  205,   24},   // RL 12.64 dB
+  {  205,   24}, {  204,   24}, {  204,   24}, {  204,   24}, {  204,   24}, {  203,   24}, {  203,   24}, {  203,   23},   // RL 12.72 dB
+  {  203,   23}, {  202,   23}, {  202,   23}, {  202,   23}, {  202,   23}, {  201,   23}, {  201,   23}, {  201,   23},   // RL 12.80 dB
+  {  201,   23}, {  200,   23}, {  200,   23}, {  200,   23}, {  200,   23}, {  199,   23}, {  199,   23}, {  199,   23},   // RL 12.88 dB
+  {  199,   23}, {  199,   22}, {  198,   22}, {  198,   22}, {  198,   22}, {  198,   22}, {  197,   22}, {  197,   22},   // RL 12.96 dB
+  {  197,   22}, {  197,   22}, {  196,   22}, {  196,   22}, {  196,   22}, {  196,   22}, {  195,   22}, {  195,   22},   // RL 13.04 dB
+  {  195,   22}, {  195,   22}, {  195,   22}, {  194,   22}, {  194,   22}, {  194,   21}, {  194,   21}, {  193,   21},   // RL 13.12 dB
+  {  193,   21}, {  193,   21}, {  193,   21}, {  192,   21}, {  192,   21}, {  192,   21}, {  192,   21}, {  192,   21},   // RL 13.20 dB
+  {  191,   21}, {  191,   21}, {  191,   21}, {  191,   21}, {  190,   21}, {  190,   21}, {  190,   21}, {  190,   21},   // RL 13.28 dB
+  {  190,   21}, {  189,   20}, {  189,   20}, {  189,   20}, {  189,   20}, {  188,   20}, {  188,   20}, {  188,   20},   // RL 13.36 dB
+  {  188,   20}, {  187,   20}, {  187,   20}, {  187,   20}, {  187,   20}, {  187,   20}, {  186,   20}, {  186,   20},   // RL 13.44 dB
+  {  186,   20}, {  186,   20}, {  186,   20}, {  185,   20}, {  185,   20}, {  185,   20}, {  185,   19}, {  184,   19},   // RL 13.52 dB
+  {  184,   19}, {  184,   19}, {  184,   19}, {  184,   19}, {  183,   19}, {  183,   19}, {  183,   19}, {  183,   19},   // RL 13.60 dB
+  {  182,   19}, {  182,   19}, {  182,   19}, {  182,   19}, {  182,   19}, {  181,   19}, {  181,   19}, {  181,   19},   // RL 13.68 dB
+  {  181,   19}, {  181,   19}, {  180,   19}, {  180,   19}, {  180,   18}, {  180,   18}, {  179,   18}, {  179,   18},   // RL 13.76 dB
+  {  179,   18}, {  179,   18}, {  179,   18}, {  178,   18}, {  178,   18}, {  178,   18}, {  178,   18}, {  178,   18},   // RL 13.84 dB
+  {  177,   18}, {  177,   18}, {  177,   18}, {  177,   18}, {  176,   18}, {  176,   18}, {  176,   18}, {  176,   18},   // RL 13.92 dB
+  {  176,   18}, {  175,   18}, {  175,   18}, {  175,   18}, {  175,   17}, {  175,   17}, {  174,   17}, {  174,   17},   // RL 14.00 dB
+  {  174,   17}, {  174,   17}, {  174,   17}, {  173,   17}, {  173,   17}, {  173,   17}, {  173,   17}, {  173,   17},   // RL 14.08 dB
+  {  172,   17}, {  172,   17}, {  172,   17}, {  172,   17}, {  172,   17}, {  171,   17}, {  171,   17}, {  171,   17},   // RL 14.16 dB
+  {  171,   17}, {  171,   17}, {  170,   17}, {  170,   17}, {  170,   17}, {  170,   16}, {  170,   16}, {  169,   16},   // RL 14.24 dB
+  {  169,   16}, {  169,   16}, {  169,   16}, {  169,   16}, {  168,   16}, {  168,   16}, {  168,   16}, {  168,   16},   // RL 14.32 dB
+  {  168,   16}, {  167,   16}, {  167,   16}, {  167,   16}, {  167,   16}, {  167,   16}, {  166,   16}, {  166,   16},   // RL 14.40 dB
+  {  166,   16}, {  166,   16}, {  166,   16}, {  165,   16}, {  165,   16}, {  165,   16}, {  165,   16}, {  165,   16},   // RL 14.48 dB
+  {  164,   15}, {  164,   15}, {  164,   15}, {  164,   15}, {  164,   15}, {  163,   15}, {  163,   15}, {  163,   15},   // RL 14.56 dB
+  {  163,   15}, {  163,   15}, {  162,   15}, {  162,   15}, {  162,   15}, {  162,   15}, {  162,   15}, {  162,   15},   // RL 14.64 dB
+  {  161,   15}, {  161,   15}, {  161,   15}, {  161,   15}, {  161,   15}, {  160,   15}, {  160,   15}, {  160,   15},   // RL 14.72 dB
+  {  160,   15}, {  160,   15}, {  159,   15}, {  159,   15}, {  159,   14}, {  159,   14}, {  159,   14}, {  159,   14},   // RL 14.80 dB
+  {  158,   14}, {  158,   14}, {  158,   14}, {  158,   14}, {  158,   14}, {  157,   14}, {  157,   14}, {  157,   14},   // RL 14.88 dB
+  {  157,   14}, {  157,   14}, {  156,   14}, {  156,   14}, {  156,   14}, {  156,   14}, {  156,   14}, {  156,   14},   // RL 14.96 dB
+  {  155,   14}, {  155,   14}, {  155,   14}, {  155,   14}, {  155,   14}, {  154,   14}, {  154,   14}, {  154,   14},   // RL 15.04 dB
+  {  154,   14}, {  154,   14}, {  154,   14}, {  153,   13}, {  153,   13}, {  153,   13}, {  153,   13}, {  153,   13},   // RL 15.12 dB
+  {  152,   13}, {  152,   13}, {  152,   13}, {  152,   13}, {  152,   13}, {  152,   13}, {  151,   13}, {  151,   13},   // RL 15.20 dB
+  {  151,   13}, {  151,   13}, {  151,   13}, {  151,   13}, {  150,   13}, {  150,   13}, {  150,   13}, {  150,   13},   // RL 15.28 dB
+  {  150,   13}, {  149,   13}, {  149,   13}, {  149,   13}, {  149,   13}, {  149,   13}, {  149,   13}, {  148,   13},   // RL 15.36 dB
+  {  148,   13}, {  148,   13}, {  148,   13}, {  148,   13}, {  148,   12}, {  147,   12}, {  147,   12}, {  147,   12},   // RL 15.44 dB
+  {  147,   12}, {  147,   12}, {  147,   12}, {  146,   12}, {  146,   12}, {  146,   12}, {  146,   12}, {  146,   12},   // RL 15.52 dB
+  {  145,   12}, {  145,   12}, {  145,   12}, {  145,   12}, {  145,   12}, {  145,   12}, {  144,   12}, {  144,   12},   // RL 15.60 dB
+  {  144,   12}, {  144,   12}, {  144,   12}, {  144,   12}, {  143,   12}, {  143,   12}, {  143,   12}, {  143,   12},   // RL 15.68 dB
+  {  143,   12}, {  143,   12}, {  142,   12}, {  142,   12}, {  142,   12}, {  142,   12}, {  142,   12}, {  142,   11},   // RL 15.76 dB
+  {  141,   11}, {  141,   11}, {  141,   11}, {  141,   11}, {  141,   11}, {  141,   11}, {  140,   11}, {  140,   11},   // RL 15.84 dB
+  {  140,   11}, {  140,   11}, {  140,   11}, {  140,   11}, {  139,   11}, {  139,   11}, {  139,   11}, {  139,   11},   // RL 15.92 dB
+  {  139,   11}, {  139,   11}, {  139,   11}, {  138,   11}, {  138,   11}, {  138,   11}, {  138,   11}, {  138,   11},   // RL 16.00 dB
+  {  138,   11}, {  137,   11}, {  137,   11}, {  137,   11}, {  137,   11}, {  137,   11}, {  137,   11}, {  136,   11},   // RL 16.08 dB
+  {  136,   11}, {  136,   11}, {  136,   11}, {  136,   11}, {  136,   11}, {  135,   11}, {  135,   10}, {  135,   10},   // RL 16.16 dB
+  {  135,   10}, {  135,   10}, {  135,   10}, {  135,   10}, {  134,   10}, {  134,   10}, {  134,   10}, {  134,   10},   // RL 16.24 dB
+  {  134,   10}, {  134,   10}, {  133,   10}, {  133,   10}, {  133,   10}, {  133,   10}, {  133,   10}, {  133,   10},   // RL 16.32 dB
+  {  132,   10}, {  132,   10}, {  132,   10}, {  132,   10}, {  132,   10}, {  132,   10}, {  132,   10}, {  131,   10},   // RL 16.40 dB
+  {  131,   10}, {  131,   10}, {  131,   10}, {  131,   10}, {  131,   10}, {  130,   10}, {  130,   10}, {  130,   10},   // RL 16.48 dB
+  {  130,   10}, {  130,   10}, {  130,   10}, {  130,   10}, {  129,   10}, {  129,   10}, {  129,   10}, {  129,   10},   // RL 16.56 dB
+  {  129,   10}, {  129,    9}, {  129,    9}, {  128,    9}, {  128,    9}, {  128,    9}, {  128,    9}, {  128,    9},   // RL 16.64 dB
+  {  128,    9}, {  127,    9}, {  127,    9}, {  127,    9}, {  127,    9}, {  127,    9}, {  127,    9}, {  127,    9},   // RL 16.72 dB
+  {  126,    9}, {  126,    9}, {  126,    9}, {  126,    9}, {  126,    9}, {  126,    9}, {  126,    9}, {  125,    9},   // RL 16.80 dB
+  {  125,    9}, {  125,    9}, {  125,    9}, {  125,    9}, {  125,    9}, {  125,    9}, {  124,    9}, {  124,    9},   // RL 16.88 dB
+  {  124,    9}, {  124,    9}, {  124,    9}, {  124,    9}, {  124,    9}, {  123,    9}, {  123,    9}, {  123,    9},   // RL 16.96 dB
+  {  123,    9}, {  123,    9}, {  123,    9}, {  123,    9}, {  122,    9}, {  122,    9}, {  122,    9}, {  122,    9},   // RL 17.04 dB
+  {  122,    9}, {  122,    8}, {  122,    8}, {  121,    8}, {  121,    8}, {  121,    8}, {  121,    8}, {  121,    8},   // RL 17.12 dB
+  {  121,    8}, {  121,    8}, {  120,    8}, {  120,    8}, {  120,    8}, {  120,    8}, {  120,    8}, {  120,    8},   // RL 17.20 dB
+  {  120,    8}, {  119,    8}, {  119,    8}, {  119,    8}, {  119,    8}, {  119,    8}, {  119,    8}, {  119,    8},   // RL 17.28 dB
+  {  118,    8}, {  118,    8}, {  118,    8}, {  118,    8}, {  118,    8}, {  118,    8}, {  118,    8}, {  117,    8},   // RL 17.36 dB
+  {  117,    8}, {  117,    8}, {  117,    8}, {  117,    8}, {  117,    8}, {  117,    8}, {  117,    8}, {  116,    8},   // RL 17.44 dB
+  {  116,    8}, {  116,    8}, {  116,    8}, {  116,    8}, {  116,    8}, {  116,    8}, {  115,    8}, {  115,    8},   // RL 17.52 dB
+  {  115,    8}, {  115,    8}, {  115,    8}, {  115,    8}, {  115,    8}, {  115,    8}, {  114,    8}, {  114,    7},   // RL 17.60 dB
+  {  114,    7}, {  114,    7}, {  114,    7}, {  114,    7}, {  114,    7}, {  113,    7}, {  113,    7}, {  113,    7},   // RL 17.68 dB
+  {  113,    7}, {  113,    7}, {  113,    7}, {  113,    7}, {  113,    7}, {  112,    7}, {  112,    7}, {  112,    7},   // RL 17.76 dB
+  {  112,    7}, {  112,    7}, {  112,    7}, {  112,    7}, {  111,    7}, {  111,    7}, {  111,    7}, {  111,    7},   // RL 17.84 dB
+  {  111,    7}, {  111,    7}, {  111,    7}, {  111,    7}, {  110,    7}, {  110,    7}, {  110,    7}, {  110,    7},   // RL 17.92 dB
+  {  110,    7}, {  110,    7}, {  110,    7}, {  110,    7}, {  109,    7}, {  109,    7}, {  109,    7}, {  109,    7},   // RL 18.00 dB
+  {  109,    7}, {  109,    7}, {  109,    7}, {  109,    7}, {  108,    7}, {  108,    7}, {  108,    7}, {  108,    7},   // RL 18.08 dB
+  {  108,    7}, {  108,    7}, {  108,    7}, {  108,    7}, {  107,    7}, {  107,    7}, {  107,    7}, {  107,    7},   // RL 18.16 dB
+  {  107,    7}, {  107,    7}, {  107,    7}, {  107,    7}, {  106,    7}, {  106,    6}, {  106,    6}, {  106,    6},   // RL 18.24 dB
+  {  106,    6}, {  106,    6}, {  106,    6}, {  106,    6}, {  105,    6}, {  105,    6}, {  105,    6}, {  105,    6},   // RL 18.32 dB
+  {  105,    6}, {  105,    6}, {  105,    6}, {  105,    6}, {  104,    6}, {  104,    6}, {  104,    6}, {  104,    6},   // RL 18.40 dB
+  {  104,    6}, {  104,    6}, {  104,    6}, {  104,    6}, {  103,    6}, {  103,    6}, {  103,    6}, {  103,    6},   // RL 18.48 dB
+  {  103,    6}, {  103,    6}, {  103,    6}, {  103,    6}, {  103,    6}, {  102,    6}, {  102,    6}, {  102,    6},   // RL 18.56 dB
+  {  102,    6}, {  102,    6}, {  102,    6}, {  102,    6}, {  102,    6}, {  101,    6}, {  101,    6}, {  101,    6},   // RL 18.64 dB
+  {  101,    6}, {  101,    6}, {  101,    6}, {  101,    6}, {  101,    6}, {  101,    6}, {  100,    6}, {  100,    6},   // RL 18.72 dB
+  {  100,    6}, {  100,    6}, {  100,    6}, {  100,    6}, {  100,    6}, {  100,    6}, {   99,    6}, {   99,    6},   // RL 18.80 dB
+  {   99,    6}, {   99,    6}, {   99,    6}, {   99,    6}, {   99,    6}, {   99,    6}, {   99,    6}, {   98,    6},   // RL 18.88 dB
+  {   98,    6}, {   98,    6}, {   98,    6}, {   98,    6}, {   98,    6}, {   98,    5}, {   98,    5}, {   98,    5},   // RL 18.96 dB
+  {   97,    5}, {   97,    5}, {   97,    5}, {   97,    5}, {   97,    5}, {   97,    5}, {   97,    5}, {   97,    5},   // RL 19.04 dB
+  {   97,    5}, {   96,    5}, {   96,    5}, {   96,    5}, {   96,    5}, {   96,    5}, {   96,    5}, {   96,    5},   // RL 19.12 dB
+  {   96,    5}, {   96,    5}, {   95,    5}, {   95,    5}, {   95,    5}, {   95,    5}, {   95,    5}, {   95,    5},   // RL 19.20 dB
+  {   95,    5}, {   95,    5}, {   95,    5}, {   94,    5}, {   94,    5}, {   94,    5}, {   94,    5}, {   94,    5},   // RL 19.28 dB
+  {   94,    5}, {   94,    5}, {   94,    5}, {   94,    5}, {   93,    5}, {   93,    5}, {   93,    5}, {   93,    5},   // RL 19.36 dB
+  {   93,    5}, {   93,    5}, {   93,    5}, {   93,    5}, {   93,    5}, {   92,    5}, {   92,    5}, {   92,    5},   // RL 19.44 dB
+  {   92,    5}, {   92,    5}, {   92,    5}, {   92,    5}, {   92,    5}, {   92,    5}, {   91,    5}, {   91,    5},   // RL 19.52 dB
+  {   91,    5}, {   91,    5}, {   91,    5}, {   91,    5}, {   91,    5}, {   91,    5}, {   91,    5}, {   91,    5},   // RL 19.60 dB
+  {   90,    5}, {   90,    5}, {   90,    5}, {   90,    5}, {   90,    5}, {   90,    5}, {   90,    5}, {   90,    5},   // RL 19.68 dB
+  {   90,    5}, {   90,    5}, {   89,    5}, {   89,    5}, {   89,    5}, {   89,    5}, {   89,    5}, {   89,    5},   // RL 19.76 dB
+  {   89,    5}, {   89,    5}, {   89,    5}, {   88,    4}, {   88,    4}, {   88,    4}, {   88,    4}, {   88,    4},   // RL 19.84 dB
+  {   88,    4}, {   88,    4}, {   88,    4}, {   88,    4}, {   88,    4}, {   87,    4}, {   87,    4}, {   87,    4},   // RL 19.92 dB
+  {   87,    4}, {   87,    4}, {   87,    4}, {   87,    4}, {   87,    4}, {   87,    4}, {   87,    4}, {   86,    4},   // RL 20.00 dB
+  {   86,    4}, {   86,    4}, {   86,    4}, {   86,    4}, {   86,    4}, {   86,    4}, {   86,    4}, {   86,    4},   // RL 20.08 dB
+  {   86,    4}, {   85,    4}, {   85,    4}, {   85,    4}, {   85,    4}, {   85,    4}, {   85,    4}, {   85,    4},   // RL 20.16 dB
+  {   85,    4}, {   85,    4}, {   85,    4}, {   84,    4}, {   84,    4}, {   84,    4}, {   84,    4}, {   84,    4},   // RL 20.24 dB
+  {   84,    4}, {   84,    4}, {   84,    4}, {   84,    4}, {   84,    4}, {   83,    4}, {   83,    4}, {   83,    4},   // RL 20.32 dB
+  {   83,    4}, {   83,    4}, {   83,    4}, {   83,    4}, {   83,    4}, {   83,    4}, {   83,    4}, {   83,    4},   // RL 20.40 dB
+  {   82,    4}, {   82,    4}, {   82,    4}, {   82,    4}, {   82,    4}, {   82,    4}, {   82,    4}, {   82,    4},   // RL 20.48 dB
+  {   82,    4}, {   82,    4}, {   81,    4}, {   81,    4}, {   81,    4}, {   81,    4}, {   81,    4}, {   81,    4},   // RL 20.56 dB
+  {   81,    4}, {   81,    4}, {   81,    4}, {   81,    4}, {   81,    4}, {   80,    4}, {   80,    4}, {   80,    4},   // RL 20.64 dB
+  {   80,    4}, {   80,    4}, {   80,    4}, {   80,    4}, {   80,    4}, {   80,    4}, {   80,    4}, {   80,    4},   // RL 20.72 dB
+  {   79,    4}, {   79,    4}, {   79,    4}, {   79,    4}, {   79,    4}, {   79,    4}, {   79,    4}, {   79,    4},   // RL 20.80 dB
+  {   79,    4}, {   79,    4}, {   79,    4}, {   78,    4}, {   78,    4}, {   78,    4}, {   78,    4}, {   78,    4},   // RL 20.88 dB
+  {   78,    3}, {   78,    3}, {   78,    3}, {   78,    3}, {   78,    3}, {   78,    3}, {   77,    3}, {   77,    3},   // RL 20.96 dB
+  {   77,    3}, {   77,    3}, {   77,    3}, {   77,    3}, {   77,    3}, {   77,    3}, {   77,    3}, {   77,    3},   // RL 21.04 dB
+  {   77,    3}, {   76,    3}, {   76,    3}, {   76,    3}, {   76,    3}, {   76,    3}, {   76,    3}, {   76,    3},   // RL 21.12 dB
+  {   76,    3}, {   76,    3}, {   76,    3}, {   76,    3}, {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3},   // RL 21.20 dB
+  {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3}, {   75,    3},   // RL 21.28 dB
+  {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3},   // RL 21.36 dB
+  {   74,    3}, {   74,    3}, {   74,    3}, {   74,    3}, {   73,    3}, {   73,    3}, {   73,    3}, {   73,    3},   // RL 21.44 dB
+  {   73,    3}, {   73,    3}, {   73,    3}, {   73,    3}, {   73,    3}, {   73,    3}, {   73,    3}, {   72,    3},   // RL 21.52 dB
+  {   72,    3}, {   72,    3}, {   72,    3}, {   72,    3}, {   72,    3}, {   72,    3}, {   72,    3}, {   72,    3},   // RL 21.60 dB
+  {   72,    3}, {   72,    3}, {   72,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3},   // RL 21.68 dB
+  {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3}, {   71,    3},   // RL 21.76 dB
+  {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3},   // RL 21.84 dB
+  {   70,    3}, {   70,    3}, {   70,    3}, {   70,    3}, {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3},   // RL 21.92 dB
+  {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3}, {   69,    3},   // RL 22.00 dB
+  {   69,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3},   // RL 22.08 dB
+  {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   68,    3}, {   67,    3}, {   67,    3}, {   67,    3},   // RL 22.16 dB
+  {   67,    3}, {   67,    3}, {   67,    3}, {   67,    3}, {   67,    3}, {   67,    3}, {   67,    3}, {   67,    3},   // RL 22.24 dB
+  {   67,    3}, {   67,    3}, {   66,    3}, {   66,    3}, {   66,    3}, {   66,    3}, {   66,    3}, {   66,    3},   // RL 22.32 dB
+  {   66,    3}, {   66,    3}, {   66,    2}, {   66,    2}, {   66,    2}, {   66,    2}, {   66,    2}, {   65,    2},   // RL 22.40 dB
+  {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2},   // RL 22.48 dB
+  {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   65,    2}, {   64,    2}, {   64,    2}, {   64,    2},   // RL 22.56 dB
+  {   64,    2}, {   64,    2}, {   64,    2}, {   64,    2}, {   64,    2}, {   64,    2}, {   64,    2}, {   64,    2},   // RL 22.64 dB
+  {   64,    2}, {   64,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2},   // RL 22.72 dB
+  {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2}, {   63,    2},   // RL 22.80 dB
+  {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2},   // RL 22.88 dB
+  {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   62,    2}, {   61,    2}, {   61,    2},   // RL 22.96 dB
+  {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2},   // RL 23.04 dB
+  {   61,    2}, {   61,    2}, {   61,    2}, {   61,    2}, {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2},   // RL 23.12 dB
+  {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2}, {   60,    2},   // RL 23.20 dB
+  {   60,    2}, {   60,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2},   // RL 23.28 dB
+  {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2}, {   59,    2},   // RL 23.36 dB
+  {   59,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2},   // RL 23.44 dB
+  {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2}, {   58,    2},   // RL 23.52 dB
+  {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2},   // RL 23.60 dB
+  {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   57,    2}, {   56,    2},   // RL 23.68 dB
+  {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2},   // RL 23.76 dB
+  {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   56,    2}, {   55,    2},   // RL 23.84 dB
+  {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2},   // RL 23.92 dB
+  {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   55,    2}, {   54,    2}, {   54,    2},   // RL 24.00 dB
+  {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2},   // RL 24.08 dB
+  {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   54,    2}, {   53,    2},   // RL 24.16 dB
+  {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2},   // RL 24.24 dB
+  {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   53,    2}, {   52,    2},   // RL 24.32 dB
+  {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2},   // RL 24.40 dB
+  {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2}, {   52,    2},   // RL 24.48 dB
+  {   51,    2}, {   51,    2}, {   51,    2}, {   51,    2}, {   51,    2}, {   51,    2}, {   51,    2}, {   51,    1},   // RL 24.56 dB
+  {   51,    1}, {   51,    1}, {   51,    1}, {   51,    1}, {   51,    1}, {   51,    1}, {   51,    1}, {   51,    1},   // RL 24.64 dB
+  {   51,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1},   // RL 24.72 dB
+  {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1}, {   50,    1},   // RL 24.80 dB
+  {   50,    1}, {   50,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1},   // RL 24.88 dB
+  {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1},   // RL 24.96 dB
+  {   49,    1}, {   49,    1}, {   49,    1}, {   49,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1},   // RL 25.04 dB
+  {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1},   // RL 25.12 dB
+  {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   48,    1}, {   47,    1}, {   47,    1},   // RL 25.20 dB
+  {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1},   // RL 25.28 dB
+  {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1}, {   47,    1},   // RL 25.36 dB
+  {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1},   // RL 25.44 dB
+  {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1}, {   46,    1},   // RL 25.52 dB
+  {   46,    1}, {   46,    1}, {   46,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1},   // RL 25.60 dB
+  {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1},   // RL 25.68 dB
+  {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   45,    1}, {   44,    1}, {   44,    1},   // RL 25.76 dB
+  {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1},   // RL 25.84 dB
+  {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1}, {   44,    1},   // RL 25.92 dB
+  {   44,    1}, {   44,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1},   // RL 26.00 dB
+  {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1},   // RL 26.08 dB
+  {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   43,    1}, {   42,    1}, {   42,    1},   // RL 26.16 dB
+  {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1},   // RL 26.24 dB
+  {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1}, {   42,    1},   // RL 26.32 dB
+  {   42,    1}, {   42,    1}, {   42,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1},   // RL 26.40 dB
+  {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1},   // RL 26.48 dB
+  {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1}, {   41,    1},   // RL 26.56 dB
+  {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1},   // RL 26.64 dB
+  {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1},   // RL 26.72 dB
+  {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   40,    1}, {   39,    1}, {   39,    1},   // RL 26.80 dB
+  {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1},   // RL 26.88 dB
+  {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1},   // RL 26.96 dB
+  {   39,    1}, {   39,    1}, {   39,    1}, {   39,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1},   // RL 27.04 dB
+  {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1},   // RL 27.12 dB
+  {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1}, {   38,    1},   // RL 27.20 dB
+  {   38,    1}, {   38,    1}, {   38,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1},   // RL 27.28 dB
+  {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1},   // RL 27.36 dB
+  {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1}, {   37,    1},   // RL 27.44 dB
+  {   37,    1}, {   37,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1},   // RL 27.52 dB
+  {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1},   // RL 27.60 dB
+  {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1}, {   36,    1},   // RL 27.68 dB
+  {   36,    1}, {   36,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1},   // RL 27.76 dB
+  {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1},   // RL 27.84 dB
+  {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1}, {   35,    1},   // RL 27.92 dB
+  {   35,    1}, {   35,    1}, {   35,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1},   // RL 28.00 dB
+  {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1},   // RL 28.08 dB
+  {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1},   // RL 28.16 dB
+  {   34,    1}, {   34,    1}, {   34,    1}, {   34,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1},   // RL 28.24 dB
+  {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1},   // RL 28.32 dB
+  {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1},   // RL 28.40 dB
+  {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   33,    1}, {   32,    1},   // RL 28.48 dB
+  {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1},   // RL 28.56 dB
+  {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1},   // RL 28.64 dB
+  {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1}, {   32,    1},   // RL 28.72 dB
+  {   32,    1}, {   32,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1},   // RL 28.80 dB
+  {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1},   // RL 28.88 dB
+  {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1},   // RL 28.96 dB
+  {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   31,    1}, {   30,    1}, {   30,    1},   // RL 29.04 dB
+  {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1},   // RL 29.12 dB
+  {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1},   // RL 29.20 dB
+  {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1}, {   30,    1},   // RL 29.28 dB
+  {   30,    1}, {   30,    1}, {   30,    1}, {   29,    1}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0},   // RL 29.36 dB
+  {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0},   // RL 29.44 dB
+  {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0},   // RL 29.52 dB
+  {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0}, {   29,    0},   // RL 29.60 dB
+  {   29,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0},   // RL 29.68 dB
+  {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0},   // RL 29.76 dB
+  {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0},   // RL 29.84 dB
+  {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0}, {   28,    0},   // RL 29.92 dB
+  {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0},   // RL 30.00 dB
+  {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0},   // RL 30.08 dB
+  {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0},   // RL 30.16 dB
+  {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0}, {   27,    0},   // RL 30.24 dB
+  {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0},   // RL 30.32 dB
+  {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0},   // RL 30.40 dB
+  {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0},   // RL 30.48 dB
+  {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0}, {   26,    0},   // RL 30.56 dB
+  {   26,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0},   // RL 30.64 dB
+  {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0},   // RL 30.72 dB
+  {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0},   // RL 30.80 dB
+  {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0},   // RL 30.88 dB
+  {   25,    0}, {   25,    0}, {   25,    0}, {   25,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0},   // RL 30.96 dB
+  {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0},   // RL 31.04 dB
+  {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0},   // RL 31.12 dB
+  {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0},   // RL 31.20 dB
+  {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0}, {   24,    0},   // RL 31.28 dB
+  {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0},   // RL 31.36 dB
+  {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0},   // RL 31.44 dB
+  {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0},   // RL 31.52 dB
+  {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0},   // RL 31.60 dB
+  {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   23,    0}, {   22,    0}, {   22,    0},   // RL 31.68 dB
+  {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0},   // RL 31.76 dB
+  {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0},   // RL 31.84 dB
+  {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0},   // RL 31.92 dB
+  {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0},   // RL 32.00 dB
+  {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   22,    0}, {   21,    0}, {   21,    0}, {   21,    0},   // RL 32.08 dB
+  {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0},   // RL 32.16 dB
+  {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0},   // RL 32.24 dB
+  {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0},   // RL 32.32 dB
+  {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0},   // RL 32.40 dB
+  {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   21,    0}, {   20,    0},   // RL 32.48 dB
+  {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0},   // RL 32.56 dB
+  {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0},   // RL 32.64 dB
+  {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0},   // RL 32.72 dB
+  {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0},   // RL 32.80 dB
+  {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0}, {   20,    0},   // RL 32.88 dB
+  {   20,    0}, {   20,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 32.96 dB
+  {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 33.04 dB
+  {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 33.12 dB
+  {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 33.20 dB
+  {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 33.28 dB
+  {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0}, {   19,    0},   // RL 33.36 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.44 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.52 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.60 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.68 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.76 dB
+  {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0}, {   18,    0},   // RL 33.84 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 33.92 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 34.00 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 34.08 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 34.16 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 34.24 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0}, {   17,    0},   // RL 34.32 dB
+  {   17,    0}, {   17,    0}, {   17,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.40 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.48 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.56 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.64 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.72 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.80 dB
+  {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0}, {   16,    0},   // RL 34.88 dB
+  {   16,    0}, {   16,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 34.96 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.04 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.12 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.20 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.28 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.36 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0}, {   15,    0},   // RL 35.44 dB
+  {   15,    0}, {   15,    0}, {   15,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.52 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.60 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.68 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.76 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.84 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 35.92 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 36.00 dB
+  {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0}, {   14,    0},   // RL 36.08 dB
+  {   14,    0}, {   14,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.16 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.24 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.32 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.40 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.48 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.56 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.64 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0},   // RL 36.72 dB
+  {   13,    0}, {   13,    0}, {   13,    0}, {   13,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 36.80 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 36.88 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 36.96 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.04 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.12 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.20 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.28 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.36 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0},   // RL 37.44 dB
+  {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   12,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.52 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.60 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.68 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.76 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.84 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 37.92 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 38.00 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 38.08 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 38.16 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0},   // RL 38.24 dB
+  {   11,    0}, {   11,    0}, {   11,    0}, {   11,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.32 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.40 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.48 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.56 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.64 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.72 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.80 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.88 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 38.96 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 39.04 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0}, {   10,    0},   // RL 39.12 dB
+  {   10,    0}, {   10,    0}, {   10,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.20 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.28 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.36 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.44 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.52 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.60 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.68 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.76 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.84 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 39.92 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 40.00 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0}, {    9,    0},   // RL 40.08 dB
+  {    9,    0}, {    9,    0}, {    9,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.16 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.24 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.32 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.40 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.48 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.56 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.64 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.72 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.80 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.88 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 40.96 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 41.04 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 41.12 dB
+  {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0}, {    8,    0},   // RL 41.20 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.28 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.36 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.44 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.52 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.60 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.68 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.76 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.84 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 41.92 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.00 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.08 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.16 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.24 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.32 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0},   // RL 42.40 dB
+  {    7,    0}, {    7,    0}, {    7,    0}, {    7,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.48 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.56 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.64 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.72 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.80 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.88 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 42.96 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.04 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.12 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.20 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.28 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.36 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.44 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.52 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.60 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.68 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.76 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0},   // RL 43.84 dB
+  {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    6,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 43.92 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.00 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.08 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.16 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.24 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.32 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.40 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.48 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.56 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.64 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.72 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.80 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.88 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 44.96 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.04 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.12 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.20 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.28 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.36 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.44 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.52 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0},   // RL 45.60 dB
+  {    5,    0}, {    5,    0}, {    5,    0}, {    5,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 45.68 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 45.76 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 45.84 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 45.92 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.00 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.08 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.16 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.24 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.32 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.40 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.48 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.56 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.64 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.72 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.80 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.88 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 46.96 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.04 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.12 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.20 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.28 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.36 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.44 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.52 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.60 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.68 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0},   // RL 47.76 dB
+  {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    4,    0}, {    3,    0}, {    3,    0},   // RL 47.84 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 47.92 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.00 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.08 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.16 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.24 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.32 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.40 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.48 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.56 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.64 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.72 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.80 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.88 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 48.96 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.04 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.12 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.20 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.28 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.36 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.44 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.52 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.60 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.68 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.76 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.84 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 49.92 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.00 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.08 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.16 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.24 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.32 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.40 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.48 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.56 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.64 dB
+  {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0}, {    3,    0},   // RL 50.72 dB
+  {    3,    0}, {    3,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 50.80 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 50.88 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 50.96 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.04 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.12 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.20 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.28 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.36 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.44 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.52 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.60 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.68 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.76 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.84 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 51.92 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.00 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.08 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.16 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.24 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.32 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.40 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.48 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.56 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.64 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.72 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.80 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.88 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 52.96 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.04 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.12 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.20 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.28 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.36 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.44 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.52 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.60 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.68 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.76 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.84 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 53.92 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.00 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.08 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.16 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.24 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.32 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.40 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.48 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.56 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.64 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.72 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.80 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.88 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 54.96 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 55.04 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0},   // RL 55.12 dB
+  {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    2,    0}, {    1,    0}, {    1,    0},   // RL 55.20 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.28 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.36 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.44 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.52 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.60 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.68 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.76 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.84 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 55.92 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.00 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.08 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.16 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.24 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.32 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.40 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.48 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.56 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.64 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.72 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.80 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.88 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 56.96 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.04 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.12 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.20 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.28 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.36 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.44 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.52 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.60 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.68 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.76 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.84 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 57.92 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.00 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.08 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.16 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.24 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.32 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.40 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.48 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.56 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.64 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.72 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.80 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.88 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 58.96 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.04 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.12 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.20 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.28 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.36 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.44 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.52 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.60 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.68 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.76 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.84 dB
+  {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0}, {    1,    0},   // RL 59.92 dB
+  {    1,    0}    // RL 60.00 dB
+};
@@ -0,0 +1,54 @@
+//*********************************************************************************
+//**
+//** Host benchmarks: timing helper.  Each result is printed as one line of
+//** key=value pairs, for scripts to pick up.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_bench_h_
+#define _HOST_bench_h_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+
+#define BENCH_RUNS  7                   // Best of, against scheduling noise
+
+// Keeps a result alive without costing more than a store
+static volatile double bench_sink;
+
+// Best time of BENCH_RUNS runs of fn(), nanoseconds per item
+template <typename FN>
+static double bench_ns(uint32_t items, FN fn)
+{
+  double best = 1e30;
+
+  for (uint8_t r = 0; r < BENCH_RUNS; r++)
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / items;
+    if (ns < best) best = ns;
+  }
+  return best;
+}
+
+#endif
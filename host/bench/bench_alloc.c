@@ -0,0 +1,51 @@
+//*********************************************************************************
+//**
+//** Host benchmarks: allocation count.  Takes the place of the glibc malloc,
+//** calloc and realloc, counting each call on to the glibc allocator.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+
+#include <stddef.h>
+#include "bench_alloc.h"
+
+extern void *__libc_malloc(size_t);
+extern void *__libc_calloc(size_t, size_t);
+extern void *__libc_realloc(void *, size_t);
+
+volatile unsigned long bench_allocs;
+
+void *malloc(size_t n)
+{
+  bench_allocs++;
+  return __libc_malloc(n);
+}
+
+void *calloc(size_t n, size_t size)
+{
+  bench_allocs++;
+  return __libc_calloc(n, size);
+}
+
+void *realloc(void *p, size_t n)
+{
+  bench_allocs++;
+  return __libc_realloc(p, n);
+}
@@ -0,0 +1,72 @@
+//*********************************************************************************
+//**
+//** Host benchmark: fast log and exp (common/fastmath.h) against libm single
+//** precision, time per call and maximum error against libm double, over
+//** -100 to +100 dB in 0.001 dB steps.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include <vector>
+#include "fastmath.h"
+#include "bench.h"
+
+#define STEPS   200001                  // -100 to +100 dB, 0.001 dB steps
+
+static std::vector<float> db, lin;
+
+// Time and error of one function against its libm counterpart, err() is the
+// error of result y for input x
+template <typename FAST, typename LIBM, typename ERR>
+static void compare(const char *name, const std::vector<float> &in, FAST fast, LIBM libm, ERR err)
+{
+  double err_fast = 0, err_libm = 0;
+  double ns_fast, ns_libm;
+
+  for (float x : in)
+  {
+    if (err(x, fast(x)) > err_fast) err_fast = err(x, fast(x));
+    if (err(x, libm(x)) > err_libm) err_libm = err(x, libm(x));
+  }
+  ns_fast = bench_ns(in.size(), [&]() { float s = 0; for (float x : in) s += fast(x); bench_sink = s; });
+  ns_libm = bench_ns(in.size(), [&]() { float s = 0; for (float x : in) s += libm(x); bench_sink = s; });
+  printf("bench=fastmath fn=%s fast_ns=%.2f libm_ns=%.2f speedup=%.2f fast_err=%.2e libm_err=%.2e\n",
+         name, ns_fast, ns_libm, ns_libm / ns_fast, err_fast, err_libm);
+}
+
+int main(void)
+{
+  for (int32_t i = 0; i < STEPS; i++)
+  {
+    db.push_back((i - STEPS / 2) / 1000.0f);
+    lin.push_back((float) pow(10, db.back() / 10.0));
+  }
+
+  // Errors in dB, of the result or of the ratio, and in decades for log10/exp10
+  compare("lin_to_db", lin, fast_lin_to_db, [](float x) { return 10 * log10f(x); },
+          [](float x, float y) { return fabs(y - 10 * log10((double) x)); });
+  compare("db_to_lin", db, fast_db_to_lin, [](float x) { return powf(10, x / 10); },
+          [](float x, float y) { return fabs(10 * log10((double) y) - x); });
+  compare("log10", lin, fast_log10, log10f,
+          [](float x, float y) { return fabs(y - log10((double) x)); });
+  compare("exp10", db, [](float x) { return fast_exp10(x / 10); }, [](float x) { return powf(10, x / 10); },
+          [](float x, float y) { return fabs(log10((double) y) - x / 10.0); });
+  return 0;
+}
@@ -0,0 +1,137 @@
+//*********************************************************************************
+//**
+//** Host benchmark: PM firmware Phase Detector build, the impedance path per
+//** sample and the derived values every 100ms, with the allocations made while
+//** timed.  Built once for the fixed point path and once for the floating point
+//** path it replaced, which samples 4x slower and takes the derived values with
+//** each sample.  per_second_us is the time taken by one second of samples, at
+//** the sample rate of each.  On the AVR the gap is far wider, there being no FPU.
+//** Plain C, as the firmware.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include <time.h>
+#include "PM.h"
+#include "bench_alloc.h"
+
+#define SAMPLES		80000				// 100s at 800 samples per second
+#define RUNS		7					// Best of, against scheduling noise
+#define BLOCK		(6250 / SAMPLE_TICKS)	// Samples per 100ms, Timer1 at 62500 ticks per second
+
+// Globals of PM.c
+var_t		R;
+uint16_t	Status;
+int16_t		ad8307_adV, ad8307_adI, mck12140pos, mck12140neg;
+double		ad8307_VdBm, ad8307_IdBm, phase, Gamma, imp_R, imp_jX;
+BOOL		Reverse;
+double		fwd_power_db, ref_power_db, power_db, power_db_pep, power_db_pk, power_db_avg;
+double		fwd_power_mw, ref_power_mw, power_mw, power_mw_pep, power_mw_pk, power_mw_avg;
+double		swr;
+uint16_t	swr_bar;
+
+static int16_t	in[SAMPLES][4];			// V, I and the phase detector outputs
+
+static double now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// The impedance path of one sample, as PM.c runs it
+static void sample(uint32_t n)
+{
+	ad8307_adV  = in[n][0];
+	ad8307_adI  = in[n][1];
+	mck12140pos = in[n][2];
+	mck12140neg = in[n][3];
+	imp_determine_dBm();
+	imp_determine_phase();
+	imp_calc_Power();
+}
+
+#if FIXEDPOINT_ENABLED
+// The values for display and USB, once per 100ms
+static void derived(uint32_t n)
+{
+	(void) n;
+	imp_calc_Derived();
+}
+#endif
+
+// Best time of RUNS runs of fn() over all samples, nanoseconds per call
+static double bench(void (*fn)(uint32_t))
+{
+	double	best = 1e30;
+
+	for (uint8_t r = 0; r < RUNS; r++)
+	{
+		double t = now_ns();
+		for (uint32_t n = 0; n < SAMPLES; n++) fn(n);
+		t = (now_ns() - t) / SAMPLES;
+		if (t < best) best = t;
+	}
+	return best;
+}
+
+int main(void)
+{
+	unsigned long	allocs;
+	double			ns_sample, ns_derived;
+
+	R.cal_AD[0].db10m = CAL1_NOR_VALUE;
+	R.cal_AD[0].V = CALV1_RAW_DEFAULT;
+	R.cal_AD[0].I = CALI1_RAW_DEFAULT;
+	R.cal_AD[1].db10m = CAL2_NOR_VALUE;
+	R.cal_AD[1].V = CALV2_RAW_DEFAULT;
+	R.cal_AD[1].I = CALI2_RAW_DEFAULT;
+	R.U.pos90deg = PH_U_90_DEG_AVG;
+	R.U.zerodeg  = PH_U_0_DEG_AVG;
+	R.U.neg90deg = PH_U_270DEG_AVG;
+	R.D.pos90deg = PH_D_90_DEG_AVG;
+	R.D.zerodeg  = PH_D_0_DEG_AVG;
+	R.D.neg90deg = PH_D_270DEG_AVG;
+	R.PEP_period = PEP_PERIOD;
+	R.SWR_alarm_trig = 40;
+
+	// Random V, I and phase detector outputs, as test_pm_impedance
+	srand(12);
+	for (uint32_t n = 0; n < SAMPLES; n++)
+	{
+		in[n][0] = 900 + rand() % 1100;
+		in[n][1] = in[n][0] - 560 + rand() % 1120;
+		in[n][2] = 740 + rand() % 1440;
+		in[n][3] = 740 + rand() % 1440;
+	}
+
+	allocs = bench_allocs;
+	ns_sample = bench(sample);
+	#if FIXEDPOINT_ENABLED
+	ns_derived = bench(derived);
+	#else
+	ns_derived = 0;							// Taken with each sample by imp_calc_Power()
+	#endif
+	printf("bench=pm_impedance path=%s sample_ns=%.2f derived_ns=%.2f per_second_us=%.1f allocs=%lu\n",
+		   FIXEDPOINT_ENABLED ? "fixed" : "float", ns_sample, ns_derived,
+		   (ns_sample * BLOCK + ns_derived) * 10 / 1000, bench_allocs - allocs);
+	return 0;
+}
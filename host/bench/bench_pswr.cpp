@@ -0,0 +1,134 @@
+//*********************************************************************************
+//**
+//** Host benchmark: the stages of the PSWR_T_1xx measurement pipeline, as
+//** compiled into the sketch for one build selection of detector, coupler and
+//** sample rate, see bench_pswr_* in host/CMakeLists.txt.  Runs on the simulated
+//** two tone input of $bench, and counts the allocations made while timed.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+
+#include <vector>
+#include "PSWR_T.h"
+#include "PSWRacquire.h"
+#include "bench.h"
+#include "bench_alloc.h"
+
+#define BLOCKS      400                 // Blocks of AD_BLOCK samples, 100s at SAMPLE_TIMER
+#define POLLS       100000              // calc_SWR_and_power() and adddata() calls
+
+// From the sketch
+void setup(void);
+void determine_power_pep_pk(uint16_t x);
+void calc_SWR_and_power(void);
+void pswr_keying_feed(void);
+void pswr_scope_feed(void);
+void pswr_sync_from_interrupt(void);
+extern pswr_kernel_t   kernel;
+extern adbuffer_t      measure;
+extern var_t           R;
+extern double          adc_ref, power_mw_long;
+extern bool            modScopeActive;
+extern ModulationScope ModScope;
+
+static std::vector<uint32_t> ad;        // Simulated AD value pairs
+
+static void feed(uint32_t pair) { ad.push_back(pair); }
+
+// One stage, fn() runs it over items, less the time per item of what else
+// fn() has to run.  Returns the time per item
+template <typename FN>
+static double bench_stage(const char *name, uint32_t items, FN fn, double less_ns = 0)
+{
+  unsigned long allocs = bench_allocs;
+  double ns = bench_ns(items, fn) - less_ns;
+
+  printf("bench=stage fn=%s ad8307=%d twentytoone=%d sample_timer=%d ns=%.2f allocs=%lu\n",
+         name, AD8307_INSTALLED, TWENTYTOONE, SAMPLE_TIMER, ns, bench_allocs - allocs);
+  return ns;
+}
+
+//-----------------------------------------------------------------------------
+// Per block and per sample, as pswr_sync_from_interrupt() runs them.  The
+// kernel decode of a block, into dBm if AD8307, is what pswr_determine_dBm()
+// did per sample before the kernel; determine_power_pep_pk() includes the
+// power distribution, quantiles, burst log and history it feeds
+static void decode(size_t b)
+{
+  kernel.decode(&ad[b], AD_BLOCK);
+}
+
+static void power_pep_pk(size_t b)
+{
+  for (uint16_t x = 0; x < AD_BLOCK; x++)
+  {
+    fwd = ad[b + x];
+    rev = ad[b + x] >> 16;
+    determine_power_pep_pk(x);
+  }
+}
+
+int main(void)
+{
+  AcqSimulated sim;
+  double       ns_decode;
+  uint32_t     n = BLOCKS * AD_BLOCK;
+
+  setup();                              // Tables, windows, analyses and the Modulation Scope
+  kernel.check(R, adc_ref);
+
+  ad.reserve(n);
+  sim.signal(AcqSimulated::TWOTONE, 3000, 2000, 1000, 3);
+  sim.begin(feed, SAMPLE_TIMER);
+  sim.run(n);
+
+  ns_decode = bench_stage("decode", n, [&]() {
+    for (size_t b = 0; b < n; b += AD_BLOCK) decode(b);
+  });
+  // Each block decoded first, as it has to be, then that is taken off
+  bench_stage("determine_power_pep_pk", n, [&]() {
+    for (size_t b = 0; b < n; b += AD_BLOCK) { decode(b); power_pep_pk(b); }
+  }, ns_decode);
+  bench_stage("keying_feed", n, [&]() {
+    for (uint32_t i = 0; i < n; i++) pswr_keying_feed();
+  });
+  bench_stage("scope_feed", n, [&]() {
+    for (uint32_t i = 0; i < n; i++) pswr_scope_feed();
+  });
+
+  // Per POLL_TIMER, and per Modulation Scope pixel
+  bench_stage("calc_SWR_and_power", POLLS, [&]() {
+    for (uint32_t i = 0; i < POLLS; i++) calc_SWR_and_power();
+  });
+  bench_stage("adddata", POLLS, [&]() {
+    for (uint32_t i = 0; i < POLLS; i++) ModScope.adddata(power_mw * (i & 0x3f) / 64, power_mw_long);
+  });
+
+  // All of it, from the sample ring, with the Modulation Scope active
+  modScopeActive = true;
+  bench_stage("sync_from_interrupt", n, [&]() {
+    for (size_t b = 0; b < n; b += AD_BLOCK)
+    {
+      for (uint16_t x = 0; x < AD_BLOCK; x++) measure.push(ad[b + x]);
+      pswr_sync_from_interrupt();
+    }
+  });
+  return 0;
+}
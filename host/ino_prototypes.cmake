@@ -0,0 +1,32 @@
+#*********************************************************************************
+#**
+#** Host build: function prototypes of an Arduino sketch, as the Arduino IDE
+#** generates them before compiling the .ino files as one translation unit.
+#** A function definition starts at column 0 and its body on the same or the
+#** next line.  Default arguments are not supported, as by the Arduino IDE.
+#**
+#**   cmake -DOUT=<header> -DINO="<a.ino;b.ino;...>" -P ino_prototypes.cmake
+#**
+#*********************************************************************************
+
+set(ident "[A-Za-z_][A-Za-z0-9_]*")
+set(head  "\n[A-Za-z_][A-Za-z0-9_ \t*&:<>,]*[ \t*&]${ident}[ \t]*\\([^;{}()=]*\\)")
+set(tail  "[ \t]*(//[^\n]*)?[ \t\n]*{")
+
+set(protos "// Generated by ino_prototypes.cmake, do not edit\n")
+foreach(ino ${INO})
+  file(READ ${ino} text)
+  string(REPLACE "\r" "" text "${text}")
+  string(REGEX MATCHALL "${head}${tail}" defs "\n${text}")
+  foreach(def ${defs})
+    string(REGEX REPLACE "${tail}$" "" def "${def}")
+    string(REGEX REPLACE "^\n" "" def "${def}")
+    if(NOT def MATCHES "^(if|else|while|for|switch|return)[ \t(]")
+      string(APPEND protos "${def};\n")
+    endif()
+  endforeach()
+endforeach()
+
+file(WRITE ${OUT}.tmp "${protos}")
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different ${OUT}.tmp ${OUT})
+file(REMOVE ${OUT}.tmp)
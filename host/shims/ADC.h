@@ -0,0 +1,80 @@
+//*********************************************************************************
+//**
+//** Host build shim: the ADC library of the Teensy 3.x, both ADCs, and the PDB
+//** registers.  Conversions return host_adc_value[] (ADC0, ADC1), for a test to set,
+//** a conversion complete interrupt function is kept, for a test to call it.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_ADC_h_
+#define _HOST_ADC_h_
+
+#include <Arduino.h>
+
+#define ADC_ERROR_VALUE   -70000
+
+enum class ADC_REFERENCE        { REF_3V3, REF_1V2, REF_EXT };
+enum class ADC_SAMPLING_SPEED   { VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED };
+enum class ADC_CONVERSION_SPEED { VERY_LOW_SPEED, LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED };
+
+extern uint16_t host_adc_value[2];
+extern volatile uint32_t PDB0_SC;
+#define PDB_SC_PDBIF      0x40
+
+class ADC_Module
+{
+  public:
+    ADC_Module(uint8_t n) : num(n) { }
+    void setReference(ADC_REFERENCE)                     { }
+    void setSamplingSpeed(ADC_SAMPLING_SPEED)            { }
+    void setConversionSpeed(ADC_CONVERSION_SPEED)        { }
+    void setResolution(uint8_t)                          { }
+    void setAveraging(uint8_t)                           { }
+    bool startSingleRead(uint8_t)                        { return true; }
+    int  readSingle(void)                                { return host_adc_value[num]; }
+    bool isComplete(void)                                { return true; }
+    void enableInterrupts(void (*fn)(void))              { isr = fn; }
+    void disableInterrupts(void)                         { isr = 0; }
+    void startPDB(uint32_t freq)                         { pdb_freq = freq; }
+    void stopPDB(void)                                   { pdb_freq = 0; }
+
+    uint32_t pdb_freq = 0;
+    void   (*isr)(void) = 0;
+
+  private:
+    uint8_t  num;
+};
+
+class ADC
+{
+  public:
+    struct Sync_result { int32_t result_adc0, result_adc1; };
+
+    ADC_Module *adc0 = new ADC_Module(0);
+    ADC_Module *adc1 = new ADC_Module(1);
+
+    Sync_result analogSynchronizedRead(uint8_t, uint8_t)
+    {
+      Sync_result r = { host_adc_value[0], host_adc_value[1] };
+      return r;
+    }
+};
+
+#endif
@@ -0,0 +1,39 @@
+//*********************************************************************************
+//**
+//** Host build shim: the FT6206 capacitive touch controller library, a screen
+//** which is never touched.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_Adafruit_FT6206_h_
+#define _HOST_Adafruit_FT6206_h_
+
+#include <Arduino.h>
+#include "XPT2046_Touchscreen.h"
+
+class Adafruit_FT6206
+{
+  public:
+    bool     begin(uint8_t = 128)                        { return true; }
+    bool     touched(void)                               { return false; }
+    TS_Point getPoint(void)                              { return TS_Point(); }
+};
+
+#endif
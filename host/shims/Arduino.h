@@ -0,0 +1,173 @@
+//*********************************************************************************
+//**
+//** Host build shim: the parts of the Arduino / Teensyduino core which the
+//** firmware uses.  Nothing here talks to hardware.  Time is a virtual clock,
+//** which only moves by delay() or host_advance_us(), hence Metro timers and
+//** millis() are deterministic.  Serial reads from host_serial_input(), its
+//** output is kept for host_serial_output() and also written to stdout if
+//** host_serial_echo is set.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_Arduino_h_
+#define _HOST_Arduino_h_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+// Host tests run the producer and consumer sides from one thread, or use
+// PSWRring.h, whose atomics do not depend on interrupts being masked
+#define noInterrupts()
+#define interrupts()
+
+#ifdef __cplusplus
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifndef F_CPU
+#define F_CPU             96000000
+#endif
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define PROGMEM
+#define pgm_read_byte(p)  (*(const uint8_t *)(p))
+#define pgm_read_word(p)  (*(const uint16_t *)(p))
+
+#define HIGH              1
+#define LOW               0
+#define INPUT             0
+#define OUTPUT            1
+#define INPUT_PULLUP      2
+#define A0               14
+#define A1               15
+#define A2               16
+#define A3               17
+#define DEC              10
+#define HEX              16
+
+//-----------------------------------------------------------------------------
+// Virtual clock, see host/shims/teensy_host.cpp
+extern uint64_t host_clock_us;
+static inline void     host_advance_us(uint64_t us) { host_clock_us += us; }
+static inline uint32_t millis(void)                 { return host_clock_us / 1000; }
+static inline uint32_t micros(void)                 { return host_clock_us; }
+static inline void     delay(uint32_t ms)           { host_clock_us += 1000ULL * ms; }
+static inline void     delayMicroseconds(uint32_t us) { host_clock_us += us; }
+
+template <class A, class B> static inline auto min(A a, B b) -> decltype(a < b ? a : b) { return (b < a) ? b : a; }
+template <class A, class B> static inline auto max(A a, B b) -> decltype(a < b ? a : b) { return (a < b) ? b : a; }
+static inline long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static inline void     pinMode(uint8_t, uint8_t)    { }
+static inline void     digitalWrite(uint8_t, uint8_t) { }
+static inline uint8_t  digitalRead(uint8_t)         { return HIGH; }
+static inline void     analogWrite(uint8_t, int)    { }
+static inline int      analogRead(uint8_t)          { return 0; }
+
+//-----------------------------------------------------------------------------
+// Cortex-M4 cycle counter, at F_CPU from the host monotonic clock
+uint32_t host_cycle_count(void);
+extern volatile uint32_t ARM_DEMCR, ARM_DWT_CTRL;
+#define ARM_DEMCR_TRCENA        (1 << 24)
+#define ARM_DWT_CTRL_CYCCNTENA  (1 << 0)
+#define ARM_DWT_CYCCNT          host_cycle_count()
+
+//-----------------------------------------------------------------------------
+// Print, as Teensyduino, for Serial and the TFT
+class __FlashStringHelper;
+#define F(s)              ((const __FlashStringHelper *) (s))
+
+class Print
+{
+  public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t n)
+    {
+      for (size_t i = 0; i < n; i++) write(buf[i]);
+      return n;
+    }
+    size_t write(const char *s)                   { return write((const uint8_t *) s, strlen(s)); }
+    size_t print(const char *s)                   { return write(s); }
+    size_t print(const __FlashStringHelper *s)    { return write((const char *) s); }
+    size_t print(char c)                          { return write((uint8_t) c); }
+    size_t print(int n, int base = DEC)           { return print((long long) n, base); }
+    size_t print(unsigned n, int base = DEC)      { return print((unsigned long long) n, base); }
+    size_t print(long n, int base = DEC)          { return print((long long) n, base); }
+    size_t print(unsigned long n, int base = DEC) { return print((unsigned long long) n, base); }
+    size_t print(long long n, int base = DEC)
+    {
+      if ((n < 0) && (base == DEC)) return print('-') + print((unsigned long long) -n, base);
+      return print((unsigned long long) n, base);
+    }
+    size_t print(unsigned long long n, int base = DEC)
+    {
+      char buf[24];
+      snprintf(buf, sizeof(buf), (base == HEX) ? "%llX" : "%llu", n);
+      return write(buf);
+    }
+    size_t print(double d, int digits = 2)
+    {
+      char buf[48];
+      snprintf(buf, sizeof(buf), "%.*f", digits, d);
+      return write(buf);
+    }
+    size_t println(void)                          { return write("\r\n"); }
+    template <class T> size_t println(T x)        { return print(x) + println(); }
+    template <class T> size_t println(T x, int f) { return print(x, f) + println(); }
+};
+
+//-----------------------------------------------------------------------------
+// USB Serial
+void host_serial_input(const char *s);          // Queue input, as typed to the USB port
+const char *host_serial_output(void);           // Output since the last host_serial_clear()
+void host_serial_clear(void);
+void host_serial_put(char c);
+extern bool host_serial_echo;                   // Write output to stdout
+
+class usb_serial_class : public Print
+{
+  public:
+    void   begin(long)                            { }
+    int    available(void);
+    int    read(void);
+    size_t write(uint8_t c)
+    {
+      host_serial_put(c);
+      if (host_serial_echo) putchar(c);
+      return 1;
+    }
+    using Print::write;
+};
+extern usb_serial_class Serial;
+
+#endif
+#endif
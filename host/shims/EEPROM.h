@@ -0,0 +1,45 @@
+//*********************************************************************************
+//**
+//** Host build shim: the EEPROM library, 2 kB as on a Teensy 3.1 / 3.2, erased
+//** (all 0xff) at start, hence the firmware starts from its defaults.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_EEPROM_h_
+#define _HOST_EEPROM_h_
+
+#include <Arduino.h>
+
+#define HOST_EEPROM_SIZE  2048
+
+class EEPROMClass
+{
+  public:
+    EEPROMClass(void)                                    { memset(mem, 0xff, sizeof(mem)); }
+    uint8_t read(int a)                                  { return mem[a % HOST_EEPROM_SIZE]; }
+    void    write(int a, uint8_t v)                      { mem[a % HOST_EEPROM_SIZE] = v; }
+    void    update(int a, uint8_t v)                     { write(a, v); }
+
+  private:
+    uint8_t mem[HOST_EEPROM_SIZE];
+};
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,41 @@
+//*********************************************************************************
+//**
+//** Host build shim: the Encoder library, an encoder which is never turned
+//** unless the test writes to it.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_Encoder_h_
+#define _HOST_Encoder_h_
+
+#include <Arduino.h>
+
+class Encoder
+{
+  public:
+    Encoder(uint8_t, uint8_t)                            { }
+    int32_t read(void)                                   { return position; }
+    void    write(int32_t p)                             { position = p; }
+
+  private:
+    int32_t position = 0;
+};
+
+#endif
@@ -0,0 +1,117 @@
+//*********************************************************************************
+//**
+//** Host build shim: the ILI9341_t3 TFT library, as far as the PSWR_T_1xx
+//** display code uses it.  Drawing does nothing, text output is discarded.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_ILI9341_t3_h_
+#define _HOST_ILI9341_t3_h_
+
+#include <Arduino.h>
+
+#define ILI9341_TFTWIDTH    240
+#define ILI9341_TFTHEIGHT   320
+
+#define ILI9341_BLACK       0x0000
+#define ILI9341_BLUE        0x001F
+#define ILI9341_RED         0xF800
+#define ILI9341_GREEN       0x07E0
+#define ILI9341_DARKGREEN   0x03E0
+#define ILI9341_YELLOW      0xFFE0
+#define ILI9341_WHITE       0xFFFF
+#define ILI9341_ORANGE      0xFD20
+
+typedef struct {
+          const unsigned char *index;
+          const unsigned char *unicode;
+          const unsigned char *data;
+          unsigned char version;
+          unsigned char reserved;
+          unsigned char index1_first;
+          unsigned char index1_last;
+          unsigned char index2_first;
+          unsigned char index2_last;
+          unsigned char bits_index;
+          unsigned char bits_width;
+          unsigned char bits_height;
+          unsigned char bits_xoffset;
+          unsigned char bits_yoffset;
+          unsigned char bits_delta;
+          unsigned char line_space;
+          unsigned char cap_height;
+               }  ILI9341_t3_font_t;
+
+class ILI9341_t3 : public Print
+{
+  public:
+    ILI9341_t3(uint8_t, uint8_t, uint8_t = 255, uint8_t = 11, uint8_t = 13, uint8_t = 12) { }
+    void     begin(void)                                  { }
+    void     setRotation(uint8_t r)                       { rotation = r & 3; }
+    int16_t  width(void)  { return (rotation & 1) ? ILI9341_TFTHEIGHT : ILI9341_TFTWIDTH; }
+    int16_t  height(void) { return (rotation & 1) ? ILI9341_TFTWIDTH : ILI9341_TFTHEIGHT; }
+    void     fillScreen(uint16_t)                         { }
+    void     drawPixel(int16_t, int16_t, uint16_t)        { }
+    void     drawFastVLine(int16_t, int16_t, int16_t, uint16_t) { }
+    void     drawFastHLine(int16_t, int16_t, int16_t, uint16_t) { }
+    void     drawRect(int16_t, int16_t, int16_t, int16_t, uint16_t) { }
+    void     fillRect(int16_t, int16_t, int16_t, int16_t, uint16_t) { }
+    void     writeRect(int16_t, int16_t, int16_t, int16_t, const uint16_t *) { }
+    void     setCursor(int16_t x, int16_t y)              { cursor_x = x; cursor_y = y; }
+    int16_t  getCursorX(void)                             { return cursor_x; }
+    int16_t  getCursorY(void)                             { return cursor_y; }
+    void     setTextColor(uint16_t)                       { }
+    void     setTextColor(uint16_t, uint16_t)             { }
+    void     setTextSize(uint8_t)                         { }
+    void     setTextWrap(bool)                            { }
+    void     setFont(const ILI9341_t3_font_t &)           { }
+    void     setFontAdafruit(void)                        { }
+    size_t   write(uint8_t)                               { cursor_x += 6; return 1; }
+    using Print::write;
+
+  private:
+    uint8_t  rotation = 0;
+    int16_t  cursor_x = 0, cursor_y = 0;
+};
+
+class Adafruit_GFX_Button
+{
+  public:
+    void initButton(ILI9341_t3 *, int16_t x, int16_t y, uint8_t w, uint8_t h,
+                    uint16_t, uint16_t, uint16_t, const char *, uint8_t)
+    {
+      x0 = x - w/2; y0 = y - h/2; wd = w; ht = h;
+    }
+    void drawButton(bool = false)                         { }
+    bool contains(int16_t x, int16_t y)
+    {
+      return (x >= x0) && (x < x0 + wd) && (y >= y0) && (y < y0 + ht);
+    }
+    void press(bool p)                                    { last = now; now = p; }
+    bool isPressed(void)                                  { return now; }
+    bool justPressed(void)                                { return now && !last; }
+    bool justReleased(void)                               { return !now && last; }
+
+  private:
+    int16_t  x0 = 0, y0 = 0, wd = 0, ht = 0;
+    bool     now = false, last = false;
+};
+
+#endif
@@ -0,0 +1,50 @@
+//*********************************************************************************
+//**
+//** Host build shim: the Metro interval timer library, on the virtual clock of
+//** the Arduino.h shim.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_Metro_h_
+#define _HOST_Metro_h_
+
+#include <Arduino.h>
+
+class Metro
+{
+  public:
+    Metro(unsigned long interval_millis) : interval(interval_millis), previous(millis()) { }
+    void    reset(void)                                  { previous = millis(); }
+    uint8_t check(void)
+    {
+      if (millis() - previous >= interval)
+      {
+        previous = millis();
+        return 1;
+      }
+      return 0;
+    }
+
+  private:
+    unsigned long interval;
+    unsigned long previous;
+};
+
+#endif
@@ -0,0 +1,42 @@
+//*********************************************************************************
+//**
+//** Host build shim: the TimerOne library.  The interrupt function is kept, for
+//** a test to call it, but nothing calls it by itself.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_TimerOne_h_
+#define _HOST_TimerOne_h_
+
+#include <Arduino.h>
+
+class TimerOne
+{
+  public:
+    void initialize(unsigned long us)                    { period = us; }
+    void attachInterrupt(void (*fn)(void))               { isr = fn; }
+    void detachInterrupt(void)                           { isr = 0; }
+
+    unsigned long period = 0;
+    void        (*isr)(void) = 0;
+};
+extern TimerOne Timer1;
+
+#endif
@@ -0,0 +1,39 @@
+//*********************************************************************************
+//**
+//** Host build shim: the AVR I/O registers used by the PM measurement code, plain
+//** variables on the host, defined in avr_host.c
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_avr_io_h_
+#define _HOST_avr_io_h_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern volatile uint8_t  PORTD, DDRD, PORTE, DDRE, PINE;
+extern volatile uint16_t TCNT1;
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+//*********************************************************************************
+//**
+//** Host build shim: the i2c_t3 Wire library of the Teensy 3.x.  Nothing answers
+//** on the bus, hence no AD7991 is detected.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_i2c_t3_h_
+#define _HOST_i2c_t3_h_
+
+#include <Arduino.h>
+
+#define I2C_MASTER        0
+#define I2C_PINS_18_19    0
+#define I2C_PULLUP_EXT    0
+#define I2C_RATE_400      400000
+
+class i2c_t3
+{
+  public:
+    void    begin(uint8_t, uint8_t, uint8_t, uint8_t, uint32_t) { }
+    void    begin(void)                                  { }
+    void    beginTransmission(uint8_t)                   { }
+    uint8_t endTransmission(void)                        { return 2; }  // Address not acknowledged
+    size_t  write(uint8_t)                               { return 1; }
+    uint8_t requestFrom(uint8_t, uint8_t)                { return 0; }
+    int     available(void)                              { return 0; }
+    int     read(void)                                   { return -1; }
+};
+extern i2c_t3 Wire;
+
+#endif
@@ -0,0 +1,101 @@
+//*********************************************************************************
+//**
+//** Host build shim: the objects and registers of the Teensyduino core and
+//** libraries, as declared by the shims, for the PSWR_T_1xx sketch.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <time.h>
+#include <Arduino.h>
+#include <ILI9341_t3.h>
+#include <font_Arial.h>
+#include <i2c_t3.h>
+#include <EEPROM.h>
+#include <TimerOne.h>
+#include <ADC.h>
+#include "_fonts.h"
+
+uint64_t          host_clock_us;
+volatile uint32_t ARM_DEMCR, ARM_DWT_CTRL;
+volatile uint32_t PDB0_SC;
+uint16_t          host_adc_value[2];
+
+usb_serial_class  Serial;
+bool              host_serial_echo;
+i2c_t3            Wire;
+EEPROMClass       EEPROM;
+TimerOne          Timer1;
+
+const ILI9341_t3_font_t Arial_8 = { };
+const ILI9341_t3_font_t DroidSansMono_14 = { };
+const ILI9341_t3_font_t DroidSansMono_18 = { };
+const ILI9341_t3_font_t DroidSansMono_48 = { };
+const ILI9341_t3_font_t AwesomeF000_20 = { };
+
+uint32_t host_cycle_count(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t) ((t.tv_sec * 1000000000ULL + t.tv_nsec) * (F_CPU / 1000000) / 1000);
+}
+
+//-----------------------------------------------------------------------------
+// USB Serial input, a queue of what has been typed
+static char   serial_in[256];
+static size_t serial_head, serial_tail;
+
+void host_serial_input(const char *s)
+{
+  while (*s && (serial_head - serial_tail < sizeof(serial_in)))
+    serial_in[serial_head++ % sizeof(serial_in)] = *s++;
+}
+
+int usb_serial_class::available(void)
+{
+  return serial_head - serial_tail;
+}
+
+int usb_serial_class::read(void)
+{
+  if (serial_head == serial_tail) return -1;
+  return (uint8_t) serial_in[serial_tail++ % sizeof(serial_in)];
+}
+
+//-----------------------------------------------------------------------------
+// USB Serial output since the last clear, up to the size of the buffer
+static char   serial_out[16384];
+static size_t serial_len;
+
+void host_serial_put(char c)
+{
+  if (serial_len < sizeof(serial_out) - 1) serial_out[serial_len++] = c;
+}
+
+const char *host_serial_output(void)
+{
+  serial_out[serial_len] = '\0';
+  return serial_out;
+}
+
+void host_serial_clear(void)
+{
+  serial_len = 0;
+}
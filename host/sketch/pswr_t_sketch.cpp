@@ -0,0 +1,39 @@
+//*********************************************************************************
+//**
+//** Host build of the PSWR_T_1xx sketch: the .ino files compiled as one
+//** translation unit, in the order of the Arduino IDE, the main sketch first,
+//** then the others by name, after the prototypes the IDE would generate (see
+//** ino_prototypes.cmake).  The Teensy libraries are the stand-ins in shims/.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <Arduino.h>
+#include "PSWR_T.h"
+#include "PSWR_T_1xx_prototypes.h"
+
+#include "PSWR_T_1xx.ino"
+#include "PSWRdisplay.ino"
+#include "PSWRmeasure.ino"
+#include "PSWRmenu.ino"
+#include "PSWRperf.ino"
+#include "PSWRprintFunc.ino"
+#include "PSWRtouchscreen.ino"
+#include "PSWRtransient.ino"
+#include "PSWRusbSerial.ino"
@@ -0,0 +1,46 @@
+//*********************************************************************************
+//**
+//** Host tests: minimal checks, each failure is printed with file and line and
+//** the test exits non-zero, for ctest.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_check_h_
+#define _HOST_check_h_
+
+#include <stdio.h>
+#include <math.h>
+
+static int check_failed = 0;
+
+#define CHECK(c) \
+  do { if (!(c)) { check_failed++; printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #c); } } while (0)
+
+#define CHECK_NEAR(a, b, tol) \
+  do { double a_ = (a), b_ = (b); \
+       if (!(fabs(a_ - b_) <= (tol))) { check_failed++; \
+         printf("%s:%d: CHECK_NEAR(%s, %s, %s) failed, %.9g against %.9g\n", \
+                __FILE__, __LINE__, #a, #b, #tol, a_, b_); } } while (0)
+
+// At the end of main()
+#define CHECK_DONE() \
+  (check_failed ? (printf("%d check(s) failed\n", check_failed), 1) : (printf("all checks passed\n"), 0))
+
+#endif
@@ -0,0 +1,70 @@
+//*********************************************************************************
+//**
+//** Host tests: the accuracy claims of the integer db100_to_lin() of the AVR
+//** fixed point paths (A019b and PM), shared by both tests.  Plain C.
+//**
+//**   - table error within 0.001 dB, where the rounding to whole units of
+//**     2^-LIN_SHIFT mW is negligible
+//**   - within 0.05 dB with that rounding, down to -55 dBm
+//**   - PK_SAMPLES of the highest input summed without overflowing 64 bits
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#ifndef _HOST_lin_check_h_
+#define _HOST_lin_check_h_
+
+#include <math.h>
+#include "check.h"
+
+#define LIN_TABLE_DB     0.001          // Claimed table error, dB
+#define LIN_ROUND_DB     0.05           // Claimed error with rounding, dB
+#define LIN_ROUND_FLOOR  -5500          // down to -55 dBm
+#define LIN_EXACT_UNITS  1e6            // Units from which rounding is below 1e-6 relative
+
+static void check_db100_to_lin(uint64_t (*to_lin)(int16_t), int16_t lin_max, int16_t lin_shift,
+                               uint32_t samples)
+{
+  double   worst_table = 0, worst_round = 0;
+  int32_t  db;
+
+  for (db = -10000; db <= lin_max; db++)
+  {
+    double u   = (double) to_lin((int16_t) db);
+    double ref = pow(10, db / 1000.0) * ldexp(1, lin_shift);
+    double err;
+
+    if (u <= 0) { if (db >= LIN_ROUND_FLOOR) CHECK(u > 0); continue; }
+    err = fabs(10 * log10(u / ref));
+    if (u >= LIN_EXACT_UNITS) { if (err > worst_table) worst_table = err; }
+    else if ((db >= LIN_ROUND_FLOOR) && (err > worst_round)) worst_round = err;
+  }
+  printf("db100_to_lin: table error %.5f dB, with rounding %.4f dB down to %d dBm\n",
+         worst_table, worst_round, LIN_ROUND_FLOOR / 100);
+  CHECK(worst_table <= LIN_TABLE_DB);
+  CHECK(worst_round <= LIN_ROUND_DB);
+
+  // Bounded input, and headroom of the 64 bit sums
+  CHECK(to_lin(lin_max + 500) == to_lin(lin_max));
+  CHECK(to_lin(-15000) == to_lin(-10000));
+  CHECK((double) to_lin(lin_max) * samples < 18446744073709551615.0);
+  CHECK(to_lin(lin_max) <= UINT64_MAX / samples);
+}
+
+#endif
@@ -0,0 +1,50 @@
+//*********************************************************************************
+//**
+//** Host test: A019b lookup tables (PSWR_A_Lookup), dBm x 100 to mW, the
+//** integer db100_to_lin() of the fixed point path and the Return Loss table.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include "PSWR_A_Lookup.h"
+#include "lin_check.h"
+
+#define SAMPLES_1S  1000                // One second worth at up to 1000 per second
+
+int main(void)
+{
+  double worst = 0;
+
+  for (int32_t db = DB100_MIN; db <= DB100_MAX; db++)
+  {
+    double err = fabs(10 * log10(db100_to_mw(db)) - db / 100.0);
+    if (err > worst) worst = err;
+  }
+  printf("db100_to_mw: max error %.2e dB\n", worst);
+  CHECK(worst < 1e-5);
+
+  check_db100_to_lin(db100_to_lin, DB100_LIN_MAX, LIN_SHIFT, SAMPLES_1S);
+  CHECK(db100_to_lin(0) == (uint64_t) 1 << LIN_SHIFT);  // 0 dBm is 1 mW
+
+  CHECK(rl_lookup(0).swr_log == 65535);
+  CHECK_NEAR(db100_to_mw(rl_lookup(954).swr_log), 2.0, 0.01);
+  CHECK_NEAR(rl_lookup(954).ml, 51, 1);                  // SWR 2:1 loses 0.51 dB
+
+  return CHECK_DONE();
+}
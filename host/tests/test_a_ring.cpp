@@ -0,0 +1,66 @@
+//*********************************************************************************
+//**
+//** Host test: A019b sample ring (PSWR_A_Ring.h), fill, drop, and drain in
+//** contiguous blocks across the wrap and across index roll over.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include "PSWR_A_Ring.h"
+#include "check.h"
+
+static SpscRing<uint32_t, 128> ring;
+
+int main(void)
+{
+  const uint32_t *p;
+  uint32_t next = 0, expect = 0;
+  uint16_t n;
+
+  for (uint8_t i = 0; i < 100; i++) CHECK(ring.push(next++));
+  CHECK(ring.highwater() == 100 && ring.lag() == 100 && ring.lagmax() == 0);
+  CHECK(ring.available() == 100 && ring.lagmax() == 100);
+  for (uint8_t i = 100; i < 128; i++) CHECK(ring.push(next++));
+  CHECK(!ring.push(next));
+  CHECK(ring.dropped() == 1 && ring.highwater() == 128);
+  ring.clear_stats();
+  CHECK(ring.dropped() == 0 && ring.highwater() == 0 && ring.lagmax() == 0);
+  CHECK(ring.lag() == 128);
+
+  // Well past the 16 bit index roll over
+  for (uint32_t round = 0; round < 100000; round++)
+  {
+    n = ring.block(&p);
+    CHECK(n > 0 && n <= 128);
+    if (n > 37) n = 37;
+    for (uint16_t i = 0; i < n; i++) CHECK(p[i] == expect++);
+    ring.release(n);
+    while (ring.push(next)) next++;
+    if (check_failed) break;
+  }
+  CHECK(ring.dropped() == 100000);              // One failed push per refill
+  while ((n = ring.block(&p)) > 0)
+  {
+    for (uint16_t i = 0; i < n; i++) CHECK(p[i] == expect++);
+    ring.release(n);
+  }
+  CHECK(expect == next);
+
+  return CHECK_DONE();
+}
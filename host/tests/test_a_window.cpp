@@ -0,0 +1,84 @@
+//*********************************************************************************
+//**
+//** Host test: sliding window max of A019b (PSWR_A_Window.h), 16 and 32 bit,
+//** against a brute force scan, also across window length changes and stamp
+//** roll over.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+#include "PSWR_A_Window.h"
+#include "check.h"
+
+#define BUF 300
+
+static int32_t brute_max(const std::vector<int32_t> &v, uint16_t len)
+{
+  int32_t  m = SlidingMax<int32_t>::empty();
+  size_t   from = (v.size() > len) ? v.size() - len : 0;
+
+  for (size_t i = from; i < v.size(); i++) if (v[i] > m) m = v[i];
+  return m;
+}
+
+int main(void)
+{
+  static SlidingMax<int32_t>::entry_t buf[BUF];
+  static SlidingMax<int16_t>::entry_t abuf[BUF];
+  SlidingMax<int16_t> a;
+  SlidingMax<int32_t> t;
+  std::vector<int32_t> v;
+  uint16_t len = 100;
+
+  t.init(buf, BUF, len);
+  a.init(abuf, BUF, len);
+  CHECK(t.peak() == -0x7fffffff);
+  CHECK(a.peak() == -0x7fff);
+
+  srand(1);
+  for (uint32_t i = 0; i < 200000; i++)       // Well past the 16 bit stamp roll over
+  {
+    int32_t x = (rand() % 20001) - 10000;
+    if (i % 1000 < 50) x = 10000 - (int32_t) (i % 1000);  // Falling ramps, the queue grows long
+
+    if (i % 25000 == 0)                       // Length changes, also longer than the buffer
+    {
+      len = 1 + rand() % (BUF + 50);
+      t.length(len);
+      a.length(len);
+      if (len > BUF) len = BUF;
+      CHECK(t.length() == len);
+      CHECK(a.length() == len);
+    }
+    v.push_back(x);
+    if (v.size() > 2 * BUF) v.erase(v.begin(), v.begin() + BUF);
+
+    int32_t m = brute_max(v, len);
+    CHECK(t.add(x) == m);
+    CHECK(a.add(x) == m);
+    if (check_failed) break;
+  }
+
+  t.clear();
+  CHECK(t.peak() == SlidingMax<int32_t>::empty());
+  CHECK(t.add(-5) == -5);
+  return CHECK_DONE();
+}
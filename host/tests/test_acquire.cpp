@@ -0,0 +1,161 @@
+//*********************************************************************************
+//**
+//** Host test: simulated acquisition backend (PSWRacquire) through the sample
+//** ring (PSWRring.h) into the decimators (PSWRdecimate.h), the same path the
+//** main loop takes, for a carrier, a keyed carrier and a two tone signal.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include "PSWRacquire.h"
+#include "PSWRring.h"
+#include "PSWRdecimate.h"
+#include "check.h"
+
+#define PERIOD_US   1000                // 1 kS/s
+#define DECIM       10                  // 10 samples per decimated period
+
+static SpscRing<uint32_t, 1024>  ring;
+static AcqSimulated              sim;
+
+static void feed(uint32_t pair) { ring.push(pair); }
+
+//-----------------------------------------------------------------------------
+// Drain the ring, decimate forward AD values to max and mean per DECIM samples
+typedef struct {
+          uint32_t n;                   // Samples
+          int32_t  min_max, max_max;    // Range of the decimated max
+          int32_t  min_mean, max_mean;  // Range of the decimated mean
+          uint32_t low;                 // Samples below AD 1000 (key up)
+               }  stats_t;
+
+static stats_t drain(void)
+{
+  DecimateMax<int32_t>           dmax;
+  DecimateMean<int32_t, int64_t> dmean;
+  stats_t  s = { 0, 0x7fffffff, -0x7fffffff, 0x7fffffff, -0x7fffffff, 0 };
+  const uint32_t *p;
+  uint16_t n;
+
+  while ((n = ring.block(&p)) > 0)
+  {
+    for (uint16_t i = 0; i < n; i++)
+    {
+      int32_t f = p[i] & 0xffff;
+      CHECK(f >= 0 && f <= 4095);
+      CHECK((p[i] >> 16) <= 4095);
+      if (f < 1000) s.low++;
+      dmax.add(f);
+      dmean.add(f);
+      s.n++;
+      if (dmax.count() == DECIM)
+      {
+        CHECK(dmean.count() == DECIM);
+        int32_t m = dmax.take(), a = dmean.take();
+        CHECK(m >= a);
+        if (m < s.min_max)  s.min_max = m;
+        if (m > s.max_max)  s.max_max = m;
+        if (a < s.min_mean) s.min_mean = a;
+        if (a > s.max_mean) s.max_mean = a;
+        CHECK(dmax.count() == 0 && dmean.count() == 0);
+      }
+    }
+    ring.release(n);
+  }
+  return s;
+}
+
+int main(void)
+{
+  stats_t s;
+
+  //------------------------------------------
+  // Decimators on their own, mean rounds to nearest
+  DecimateMean<int16_t, int32_t> m16;
+  CHECK(m16.take() == 0);                       // Empty period
+  m16.add(1); m16.add(2);
+  CHECK(m16.take() == 2);                       // 1.5 rounds up
+  m16.add(-3); m16.add(-3); m16.add(-4);
+  CHECK(m16.take() == -3);
+  DecimateMax<int16_t> x16;
+  x16.add(-7); x16.add(-9);
+  CHECK(x16.count() == 2);
+  CHECK(x16.take() == -7);
+  x16.add(-20);                                 // New period forgets the old max
+  CHECK(x16.take() == -20);
+
+  //------------------------------------------
+  // Carrier, noise free, every sample the same
+  sim.signal(AcqSimulated::CARRIER, 3000, 1000, 0, 0);
+  sim.begin(feed, PERIOD_US);
+  sim.run(1000);
+  CHECK(sim.now_us() == 1000UL * PERIOD_US);
+  s = drain();
+  CHECK(s.n == 1000);
+  CHECK(s.min_max == 3000 && s.max_max == 3000);
+  CHECK(s.min_mean == 3000 && s.max_mean == 3000);
+
+  //------------------------------------------
+  // Carrier with noise, within +/- noise of the set level
+  sim.signal(AcqSimulated::CARRIER, 3000, 1000, 0, 20);
+  sim.begin(feed, PERIOD_US);
+  sim.run(1000);
+  s = drain();
+  CHECK(s.max_max <= 3020 && s.min_max > 2980);
+  CHECK(abs(s.min_mean - 3000) <= 20 && abs(s.max_mean - 3000) <= 20);
+
+  //------------------------------------------
+  // Keyed at 10 Hz, key down half the time
+  sim.signal(AcqSimulated::KEYED, 3000, 1000, 10, 0);
+  sim.begin(feed, PERIOD_US);
+  sim.run(1000);
+  s = drain();
+  CHECK(s.low == 500);
+  CHECK(s.max_max == 3000 && s.min_max == 3000 - 80 * SIM_AD_PER_DB);  // Key up is 80 dB down
+
+  //------------------------------------------
+  // Two tone, 100 Hz spacing, the envelope reaches peak every 10 ms and
+  // drops deep in between
+  sim.signal(AcqSimulated::TWOTONE, 3000, 1000, 100, 0);
+  sim.begin(feed, PERIOD_US);
+  sim.run(1000);
+  s = drain();
+  CHECK(s.max_max == 3000);
+  CHECK(s.min_max == 3000);                     // Every decimated period holds a peak
+  CHECK(s.max_mean < 3000 - 2 * SIM_AD_PER_DB); // The mean is well below peak
+
+  //------------------------------------------
+  // More samples than the ring holds, the newest are dropped and counted
+  ring.clear_stats();
+  sim.signal(AcqSimulated::CARRIER, 3000, 1000, 0, 0);
+  sim.begin(feed, PERIOD_US);
+  sim.run(1500);
+  CHECK(ring.dropped() == 1500 - 1024);
+  CHECK(ring.highwater() == 1024);
+  s = drain();
+  CHECK(s.n == 1024);
+
+  //------------------------------------------
+  // Stopped backend produces nothing
+  sim.end();
+  sim.run(100);
+  CHECK(ring.available() == 0);
+
+  return CHECK_DONE();
+}
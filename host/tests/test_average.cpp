@@ -0,0 +1,101 @@
+//*********************************************************************************
+//**
+//** Host test: the 100ms and 1s power averages of determine_power_pep_pk(),
+//** integer microwatts decimated to 10ms means (PSWRdecimate.h) and held in a
+//** ring with exact running sums, over 5M random samples.  The running sums
+//** have to equal a full recount at every step, and the averages have to agree
+//** with double precision to within the microwatt quantization.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include <deque>
+#include "PSWRdecimate.h"
+#include "check.h"
+
+#define SAMPLES         5000000
+#define DECIM_TICKS          10         // 10ms periods per 100ms
+#define AVG_TICKS1S         100         // 10ms periods per 1s
+#define PER_TICK             15         // 1500 samples per second
+
+int main(void)
+{
+  DecimateMean<uint32_t,uint64_t> avg_dec;
+  static uint32_t p_avg_buf[AVG_TICKS1S];
+  uint64_t p_plus = 0, p_1splus = 0;
+  uint16_t avg_old = AVG_TICKS1S - DECIM_TICKS, avg_new = 0;
+  std::deque<double> mw_short, mw_1s;           // Reference, every sample as mW
+  double   worst = 0, worst_1s = 0;
+  uint32_t ticks = 0;
+
+  srand(15);
+  for (uint32_t i = 0; i < SAMPLES; i++)
+  {
+    // Random power over 60 dB, and now and then above the 4kW clamp
+    double   power_mw = pow(10, (rand() % 6000) / 100.0 - 1) * ((rand() % 1000) ? 1 : 2e3);
+    uint32_t p_uw;
+
+    if (power_mw < 4000000) p_uw = power_mw * 1000 + 0.5;
+    else p_uw = 4000000000UL;
+    avg_dec.add(p_uw);
+    mw_short.push_back(p_uw / 1000.0);
+    mw_1s.push_back(p_uw / 1000.0);
+    if (avg_dec.count() < PER_TICK) continue;
+
+    // End of a 10ms period, as in determine_power_pep_pk()
+    uint32_t m_uw = avg_dec.take();
+    p_plus   = p_plus + m_uw - p_avg_buf[avg_old];
+    p_1splus = p_1splus + m_uw - p_avg_buf[avg_new];
+    p_avg_buf[avg_new] = m_uw;
+    if (++avg_old == AVG_TICKS1S) avg_old = 0;
+    if (++avg_new == AVG_TICKS1S) avg_new = 0;
+    double power_mw_avg   = p_plus   / (1000.0 * DECIM_TICKS);
+    double power_mw_1savg = p_1splus / (1000.0 * AVG_TICKS1S);
+
+    while (mw_short.size() > DECIM_TICKS * PER_TICK) mw_short.pop_front();
+    while (mw_1s.size() > AVG_TICKS1S * PER_TICK)    mw_1s.pop_front();
+    if (++ticks < AVG_TICKS1S) continue;        // Until the 1s window is full
+
+    // The running sums are exact, a recount gives the same integers
+    if ((ticks % 997) == 0)
+    {
+      uint64_t s = 0, s1 = 0;
+      for (uint16_t k = 0; k < AVG_TICKS1S; k++) s1 += p_avg_buf[k];
+      for (uint16_t k = 0; k < DECIM_TICKS; k++) s += p_avg_buf[(avg_new + AVG_TICKS1S - 1 - k) % AVG_TICKS1S];
+      CHECK(s == p_plus);
+      CHECK(s1 == p_1splus);
+    }
+
+    // Against double, each 10ms mean is rounded to the microwatt
+    double ref = 0, ref1 = 0;
+    for (double v : mw_short) ref  += v;
+    for (double v : mw_1s)    ref1 += v;
+    ref  /= mw_short.size();
+    ref1 /= mw_1s.size();
+    if (fabs(power_mw_avg - ref)    > worst)    worst    = fabs(power_mw_avg - ref);
+    if (fabs(power_mw_1savg - ref1) > worst_1s) worst_1s = fabs(power_mw_1savg - ref1);
+    CHECK_NEAR(power_mw_avg, ref, 0.0005 + 1e-9 * ref);
+    CHECK_NEAR(power_mw_1savg, ref1, 0.0005 + 1e-9 * ref1);
+    if (check_failed) break;
+  }
+  printf("%u samples, worst 100ms average %.2e mW, worst 1s average %.2e mW\n",
+         (unsigned) SAMPLES, worst, worst_1s);
+  return CHECK_DONE();
+}
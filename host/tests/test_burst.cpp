@@ -0,0 +1,112 @@
+//*********************************************************************************
+//**
+//** Host test: transmission burst log (PSWRburst.h), start and end with
+//** hysteresis, record contents and the round robin of records.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include "PSWRburst.h"
+#include "check.h"
+
+#define PERIOD_US   500                 // 2000 samples per second
+#define ON_DB       1000                // Threshold, 10 dBm
+
+static BurstLog<8> log8;
+static uint32_t    now_ms;
+
+// n samples at a power level, dBm x 100, with SWR if within a burst
+static void run(uint32_t n, int16_t db, bool reverse = false, float swr = 0)
+{
+  uint32_t uw = lroundf(1000 * powf(10, db / 1000.0f));
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    if (log8.add(db, uw, reverse, ON_DB, now_ms) && (swr > 0)) log8.swr(swr);
+    if ((i & 1) == 1) now_ms++;
+  }
+}
+
+int main(void)
+{
+  log8.clear();
+  log8.period(PERIOD_US);
+
+  //------------------------------------------
+  // One 1s burst at 40 dBm, then below the threshold but within the
+  // hysteresis, which does not end it, then well below
+  run(100, 0);
+  CHECK(log8.count() == 0);
+  run(2000, 4000, false, 1.5f);
+  run(100, ON_DB - 200, false, 2.5f);
+  run(100, -2000);
+  CHECK(log8.count() == 1);
+  const burst_t &b = log8.get(0);
+  CHECK(b.start_ms == 50);
+  CHECK(b.duration_us == 2100UL * PERIOD_US);
+  CHECK(b.peak == 4000);
+  CHECK_NEAR(b.energy_j, (2000 * 10.0 + 100 * 0.00631) * PERIOD_US * 1e-6, 0.01);
+  CHECK_NEAR(b.avg, 100 * 10 * log10((2000 * 10000.0 + 100 * 6.31) / 2100), 2);
+  CHECK(b.swr_min == 150 && b.swr_max == 250);
+  CHECK(b.flags == 0);
+  CHECK(b.seq == 0);
+
+  //------------------------------------------
+  // Reverse power seen, no meaningful SWR
+  run(10, 3000, true);
+  run(10, -2000);
+  CHECK(log8.count() == 2);
+  CHECK(log8.get(1).flags == BURST_REVERSE);
+  CHECK(log8.get(1).swr_min == 0 && log8.get(1).swr_max == 0);
+
+  //------------------------------------------
+  // A burst in progress is ended by a change of sample period
+  run(10, 3000);
+  log8.period(PERIOD_US);
+  CHECK(log8.count() == 3);
+  run(10, -2000);
+  CHECK(log8.count() == 3);
+
+  //------------------------------------------
+  // Round robin, the oldest records go, sequence numbers show the gap
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    run(10, 2000 + i);
+    run(10, -2000);
+  }
+  CHECK(log8.recorded() == 13);
+  CHECK(log8.count() == 8);
+  CHECK(log8.get(0).seq == 5);
+  CHECK(log8.get(7).seq == 12);
+  CHECK(log8.get(7).peak == 2009);
+
+  //------------------------------------------
+  // A burst longer than the duration can hold, 72 minutes at 10 samples per
+  // second, is held at the longest
+  log8.period(100000);
+  run(43200, 3000);
+  run(10, -2000);
+  CHECK(log8.get(7).duration_us == 0xffffffffUL);
+  CHECK_NEAR(log8.get(7).energy_j, 43200 * 1.0 * 0.1, 1);
+
+  log8.clear();
+  CHECK(log8.count() == 0 && log8.recorded() == 0);
+
+  return CHECK_DONE();
+}
@@ -0,0 +1,79 @@
+//*********************************************************************************
+//**
+//** Host test: fast log and exp (PSWRfastmath.h) against libm in double, over
+//** -100 to +100 dB, with the claimed maximum errors:
+//**
+//**   fast_lin_to_db()   6e-5 dB
+//**   fast_db_to_lin()   4e-5 dB
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include "PSWRfastmath.h"
+#include "check.h"
+
+#define LIN_TO_DB_MAX   6e-5            // dB
+#define DB_TO_LIN_MAX   4e-5            // dB
+
+int main(void)
+{
+  double worst_log = 0, worst_exp = 0, worst_log10 = 0, worst_exp10 = 0;
+  fast_float_t u;
+
+  //------------------------------------------
+  // Every float mantissa in two octaves, 2^-23 apart, then powers across the
+  // range, the error depends on the mantissa only
+  for (u.f = 1.0f; u.f < 4.0f; u.i++)
+  {
+    double e = fabs(fast_lin_to_db(u.f) - 10 * log10((double) u.f));
+    if (e > worst_log) worst_log = e;
+  }
+  for (int32_t db = -100000; db <= 100000; db++)           // 0.001 dB steps
+  {
+    float  x = (float) pow(10, db / 10000.0);
+    double e = fabs(fast_lin_to_db(x) - 10 * log10((double) x));
+    if (e > worst_log) worst_log = e;
+    e = fabs(fast_log10(x) - log10((double) x));
+    if (e > worst_log10) worst_log10 = e;
+
+    float d = db / 1000.0f;
+    e = fabs(10 * log10((double) fast_db_to_lin(d)) - d);
+    if (e > worst_exp) worst_exp = e;
+    e = fabs(log10((double) fast_exp10(d / 10)) - d / 10);
+    if (e > worst_exp10) worst_exp10 = e;
+  }
+  printf("fast_lin_to_db %.2e dB, fast_db_to_lin %.2e dB, fast_log10 %.2e, fast_exp10 %.2e decades\n",
+         worst_log, worst_exp, worst_log10, worst_exp10);
+  CHECK(worst_log <= LIN_TO_DB_MAX);
+  CHECK(worst_exp <= DB_TO_LIN_MAX);
+  CHECK(worst_log10 <= LIN_TO_DB_MAX / 10);
+  CHECK(worst_exp10 <= DB_TO_LIN_MAX / 10);
+
+  //------------------------------------------
+  // Edges, documented in the header
+  CHECK(fast_log2(0) == -126.0f);
+  CHECK(fast_log2(-1) == -126.0f);
+  CHECK(fast_log2(NAN) == -126.0f);
+  CHECK_NEAR(fast_exp2(-200), ldexp(1, -126), ldexp(1, -140));
+  CHECK(isfinite(fast_exp2(200)));
+  CHECK_NEAR(fast_exp2(-0.5f), sqrt(0.5), 1e-5);
+
+  return CHECK_DONE();
+}
@@ -0,0 +1,150 @@
+//*********************************************************************************
+//**
+//** Host test: power distribution histogram (PSWRhistogram.h) and the P-square
+//** quantile estimators (PSWRquantile.h), against sorted samples.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+#include <algorithm>
+#include "PSWRhistogram.h"
+#include "PSWRquantile.h"
+#include "check.h"
+
+#define SAMPLES   200000
+#define P2_SAMPLES  30000               // 30s at 1000 samples per second
+#define P2_LONG   4000000               // Far beyond any window, against drift
+
+static PowerHistogram hist;
+
+// Exact quantile of sorted samples, nearest rank
+static double exact(const std::vector<int32_t> &v, double q)
+{
+  size_t i = (size_t) (q * v.size());
+  return v[(i < v.size()) ? i : v.size() - 1];
+}
+
+int main(void)
+{
+  static const double q[HIST_QUANTILES] = { 0.5, 0.9, 0.99, 0.999, 0.9999, 0.99999 };
+  std::vector<int32_t> v, v2;
+  P2Quantiles p2;
+  quant_t  r;
+  hist_t   s;
+  double   lin = 0;
+
+  //------------------------------------------
+  // Empty
+  hist.clear();
+  hist.summary(s);
+  CHECK(s.samples == 0 && s.peak == HIST_DB_MIN && s.p[0] == HIST_DB_MIN);
+  p2.init();
+  p2.result(r);
+  CHECK(r.n == 0 && r.p50 == 0);
+
+  //------------------------------------------
+  // Mostly just above 30 dBm, a long tail up to 69 dBm
+  srand(21);
+  for (uint32_t i = 0; i < SAMPLES; i++)
+  {
+    double  u = (rand() + 1.0) / (RAND_MAX + 2.0);
+    int32_t db = 3000 + (int32_t) (-434.3 * log(u));      // dB above 30 dBm, exponential tail
+    if (db > 6900) db = 6900;
+    v.push_back(db);
+    hist.add(db);
+    if (i < P2_SAMPLES) { p2.add(db); v2.push_back(db); }
+    lin += pow(10, db / 1000.0);
+  }
+  std::sort(v.begin(), v.end());
+  std::sort(v2.begin(), v2.end());
+
+  hist.summary(s);
+  CHECK_NEAR(s.samples, SAMPLES, 1);
+  CHECK(hist.counted() == SAMPLES * HIST_ONE);
+  CHECK(s.peak >= v.back() && s.peak <= v.back() + HIST_BIN);
+  CHECK_NEAR(s.avg, 100 * 10 * log10(lin / SAMPLES), HIST_BIN);
+  for (uint8_t k = 0; k < HIST_QUANTILES - 1; k++)      // P99.999 is 2 samples
+  {
+    printf("P%-7g histogram %5d, exact %5.0f\n", 100 * q[k], (int) s.p[k], exact(v, q[k]));
+    CHECK_NEAR(s.p[k], exact(v, q[k]), HIST_BIN);
+  }
+
+  p2.result(r);
+  printf("P-square  P50 %.0f P90 %.0f P99 %.0f, exact %.0f %.0f %.0f\n",
+         r.p50, r.p90, r.p99, exact(v2, 0.5), exact(v2, 0.9), exact(v2, 0.99));
+  CHECK(r.n == P2_SAMPLES);
+  CHECK_NEAR(r.p50, exact(v2, 0.50), 10);
+  CHECK_NEAR(r.p90, exact(v2, 0.90), 20);
+  CHECK_NEAR(r.p99, exact(v2, 0.99), 50);
+
+  //------------------------------------------
+  // Decay keeps the shape and halves the count, out of range goes to the end bins
+  hist.decay(HIST_HOLD / 2);
+  hist.summary(s);
+  CHECK_NEAR(s.samples, SAMPLES / 2, SAMPLES / 1000);
+  CHECK_NEAR(s.p[0], exact(v, 0.5), HIST_BIN);
+  hist.decay(hist_keep(0));                              // No change
+  CHECK_NEAR(hist.counted(), SAMPLES / 2 * HIST_ONE, SAMPLES / 1000 * HIST_ONE);
+  hist.clear();
+  hist.add(-9999);
+  hist.add(9999);
+  CHECK(hist.count(0) == HIST_ONE && hist.count(HIST_BINS - 1) == HIST_ONE);
+
+  //------------------------------------------
+  // A single sample halves in ln(2) x the time constant, decay once per 100ms
+  static const uint16_t tc[3] = { 60, 600, 3600 };
+  static const double   half[3] = { 41.6, 416, 2495 };
+  for (uint8_t k = 0; k < 3; k++)
+  {
+    uint32_t steps = 0;
+    hist.clear();
+    hist.add(4000);
+    while (hist.counted() > HIST_ONE / 2) { hist.decay(hist_keep(tc[k])); steps++; }
+    printf("Half-life %gs at time constant %us\n", steps / 10.0, tc[k]);
+    CHECK_NEAR(steps / 10.0, half[k], 0.5);
+  }
+
+  //------------------------------------------
+  // Uniform 0 to 9999, long enough for float sums of the desired marker positions
+  // to have drifted away
+  uint32_t seed = 1;
+  p2.init();
+  for (uint32_t i = 0; i < P2_LONG; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    p2.add((seed >> 8) % 10000);
+  }
+  p2.result(r);
+  printf("P-square  P50 %.0f P90 %.0f P99 %.0f of %u uniform\n", r.p50, r.p90, r.p99, (unsigned) r.n);
+  CHECK(r.n == P2_LONG);
+  CHECK_NEAR(r.p50, 5000, 20);
+  CHECK_NEAR(r.p90, 9000, 20);
+  CHECK_NEAR(r.p99, 9900, 20);
+
+  //------------------------------------------
+  // Fewer than five observations, exact
+  P2Quantile few;
+  few.init(0.5);
+  few.add(3); few.add(1); few.add(2);
+  CHECK(few.count() == 3 && few.value() == 2);
+
+  return CHECK_DONE();
+}
@@ -0,0 +1,90 @@
+//*********************************************************************************
+//**
+//** Host test: multi resolution power history (PSWRhistory.h), encoding, the
+//** aggregation of 100ms slots into 1s and 1 minute slots, and the round robin
+//** of each tier.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include "PSWRhistory.h"
+#include "check.h"
+
+typedef PowerHistory<50, 120, 30> history_t;
+static history_t hist;
+
+int main(void)
+{
+  uint32_t now = 0;
+
+  //------------------------------------------
+  // Encoding, 0.5 dB steps from -30 dBm, SWR in 1/250 decade steps
+  CHECK(history_t::dbm(0) == HISTORY_DBM_MIN);
+  CHECK(history_t::dbm(1) == HISTORY_DBM_MIN);
+  CHECK(history_t::dbm(254) == HISTORY_DBM_MIN + 253 / 2.0f);
+  CHECK(history_t::swr(0) == 0);
+  CHECK_NEAR(history_t::swr(1), 1.0, 1e-4);
+  CHECK_NEAR(history_t::swr(1 + 75), 2.0, 0.01);
+
+  //------------------------------------------
+  // 2 minutes of 100ms slots: power alternates between 20 and 40 dBm each
+  // second, SWR climbs slowly
+  for (uint32_t i = 0; i < 1200; i++)
+  {
+    float db  = ((i / 10) & 1) ? 40 : 20;
+    float swr = 1 + i / 1200.0f;
+    now += 100;
+    hist.add(db - 1, powf(10, db / 10), db, swr, now);
+  }
+  CHECK(hist.count(0) == 50);                   // Full, round robin
+  CHECK(hist.count(1) == 120);
+  CHECK(hist.count(2) == 2);
+  CHECK(hist.last_ms(0) == now && hist.last_ms(1) == now && hist.last_ms(2) == now);
+
+  // 100ms, most recent first
+  CHECK_NEAR(history_t::dbm(hist.get(0, 0).max), 40, 0.25);
+  CHECK_NEAR(history_t::dbm(hist.get(0, 0).min), 39, 0.25);
+  CHECK_NEAR(history_t::dbm(hist.get(0, 10).max), 20, 0.25);
+  CHECK_NEAR(history_t::swr(hist.get(0, 0).swr), 1 + 1199 / 1200.0, 0.01);
+
+  // 1s, each second is one level
+  CHECK_NEAR(history_t::dbm(hist.get(1, 0).avg), 40, 0.25);
+  CHECK_NEAR(history_t::dbm(hist.get(1, 1).avg), 20, 0.25);
+  CHECK_NEAR(history_t::dbm(hist.get(1, 1).min), 19, 0.25);
+
+  // 1 minute, the average is the linear mean of 20 and 40 dBm
+  const hslot_t &m = hist.get(2, 0);
+  CHECK_NEAR(history_t::dbm(m.avg), 10 * log10((100.0 + 10000.0) / 2), 0.25);
+  CHECK_NEAR(history_t::dbm(m.min), 19, 0.25);
+  CHECK_NEAR(history_t::dbm(m.max), 40, 0.25);
+  CHECK_NEAR(history_t::swr(m.swr), 2.0, 0.01);
+  CHECK_NEAR(history_t::swr(hist.get(2, 1).swr), 1.5, 0.01);
+
+  //------------------------------------------
+  // Below the range, and no meaningful SWR
+  now += 100;
+  hist.add(-80, 0, -60, 0, now);
+  CHECK(history_t::dbm(hist.get(0, 0).min) == HISTORY_DBM_MIN);
+  CHECK(history_t::dbm(hist.get(0, 0).avg) == HISTORY_DBM_MIN);
+  CHECK(history_t::dbm(hist.get(0, 0).max) == HISTORY_DBM_MIN);
+  CHECK(hist.get(0, 0).swr == 0);
+
+  return CHECK_DONE();
+}
@@ -0,0 +1,202 @@
+//*********************************************************************************
+//**
+//** Host test: measurement kernel (PSWRkernel.h) for all four combinations of
+//** detector (2x AD8307 or Diode) and coupler (20 to 1 or 30 to 1), against the
+//** per sample double precision arithmetic the kernel replaced, over a grid of
+//** forward and reverse AD values.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include "PSWR_T.h"
+#include "check.h"
+
+#define AD_STEP     5                   // Grid of AD values, 820 x 820 pairs per combination
+
+// Instantaneous values, written by the kernel
+int16_t  fwd, rev;
+double   f_inst, r_inst;
+double   ad8307_FdBm, ad8307_RdBm;
+int16_t  ad8307_Fdb100, ad8307_Rdb100;
+uint16_t swr_log;
+double   fwd_power_mw, ref_power_mw, power_mw, power_db;
+bool     Reverse;
+
+static const double adc_ref = ADC_RES;
+
+//-----------------------------------------------------------------------------
+// The arithmetic the kernel replaced, from determine_power_pep_pk() and
+// pswr_determine_dBm(), one sample at a time
+typedef struct {
+          double   fwd_mw, ref_mw, power_db, swr;
+          bool     reverse;
+               }  ref_t;
+
+static ref_t ref_ad8307(const var_t &r, int16_t f, int16_t v)
+{
+  ref_t  o;
+  double delta_db  = (double)((r.cal_AD[1].db10m - r.cal_AD[0].db10m)/10.0);
+  double delta_Fdb = delta_db/(r.cal_AD[1].Fwd - r.cal_AD[0].Fwd);
+  double delta_Rdb = delta_db/(r.cal_AD[1].Rev - r.cal_AD[0].Rev);
+  double fdbm = (adc_ref * (f/4096.0) - r.cal_AD[0].Fwd) * delta_Fdb + r.cal_AD[0].db10m/10.0;
+  double rdbm = (adc_ref * (v/4096.0) - r.cal_AD[0].Rev) * delta_Rdb + r.cal_AD[0].db10m/10.0;
+  double fi, ri;
+
+  o.reverse = !(fdbm > rdbm);
+  if (o.reverse) { double t = rdbm; rdbm = fdbm; fdbm = t; }
+  fi = pow(10, fdbm/20.0);
+  ri = pow(10, rdbm/20.0);
+  o.fwd_mw   = SQR(fi);
+  o.ref_mw   = SQR(ri);
+  if (o.fwd_mw > 4000000) o.fwd_mw = 4000000;
+  if (o.ref_mw > 4000000) o.ref_mw = 4000000;
+  o.power_db = 10 * log10(o.fwd_mw - o.ref_mw);
+  o.swr      = (1+(ri/fi))/(1-(ri/fi));
+  return o;
+}
+
+static ref_t ref_diode(const var_t &r, int16_t f, int16_t v)
+{
+  ref_t  o;
+  double fi, ri;
+
+  o.reverse = !(f > v);
+  if (o.reverse) { int16_t t = v; v = f; f = t; }
+  fi = (double) f * adc_ref/4096.0;
+  if (fi >= D_VDROP) fi = 1/1.4142135 * (fi - D_VDROP) + D_VDROP;
+  fi = fi * BRIDGE_COUPLING * r.meter_cal/100.0;
+  ri = (double) v * adc_ref/4096.0;
+  if (ri >= D_VDROP) ri = 1/1.4142135 * (ri - D_VDROP) + D_VDROP;
+  ri = ri * BRIDGE_COUPLING * r.meter_cal/100.0;
+  o.fwd_mw   = 1000 * SQR(fi)/50.0;
+  o.ref_mw   = 1000 * SQR(ri)/50.0;
+  o.power_db = 10 * log10(fabs(o.fwd_mw - o.ref_mw));
+  o.swr      = (1+(ri/fi))/(1-(ri/fi));
+  return o;
+}
+
+//-----------------------------------------------------------------------------
+// One detector and coupler combination over the whole grid
+template <class KERNEL>
+static void check_combo(const char *name, uint8_t meter_cal)
+{
+  typedef typename KERNEL::coupler  coupler;
+  typedef typename KERNEL::detector detector;
+  static KERNEL k;
+  static uint32_t ad[AD_BLOCK];
+  static int16_t  af[AD_BLOCK], av[AD_BLOCK];
+  var_t    r;
+  uint16_t n = 0;
+  double   worst_db = 0, worst_swr = 0;
+  uint32_t compared = 0;
+
+  r.cal_AD[0].db10m = coupler::cal1_nor_value;
+  r.cal_AD[0].Fwd   = coupler::calfwd1_default;
+  r.cal_AD[0].Rev   = coupler::calrev1_default;
+  r.cal_AD[1].db10m = coupler::cal2_nor_value;
+  r.cal_AD[1].Fwd   = coupler::calfwd2_default;
+  r.cal_AD[1].Rev   = coupler::calrev2_default;
+  r.meter_cal       = meter_cal;
+  k.check(r, adc_ref);
+
+  for (int32_t f = 0; f < 4096; f += AD_STEP)
+  {
+    for (int32_t v = 0; v < 4096; v += AD_STEP)
+    {
+      af[n] = f;
+      av[n] = v;
+      ad[n++] = (uint32_t) f | ((uint32_t) v << 16);
+      if ((n < AD_BLOCK) && !((f + AD_STEP >= 4096) && (v + AD_STEP >= 4096))) continue;
+
+      k.decode(ad, n);
+      for (uint16_t x = 0; x < n; x++)
+      {
+        fwd = af[x];
+        rev = av[x];
+        int32_t p_db = k.power(x);
+        ref_t   o = detector::log_detector ? ref_ad8307(r, af[x], av[x]) : ref_diode(r, af[x], av[x]);
+        double  rl_db = 10 * log10(o.fwd_mw / o.ref_mw);
+        int16_t pk = k.db100(ad[x]);
+
+        if (detector::log_detector)
+        {
+          // Tables round to 0.01 dB.  Below 3 dB Return Loss the Mismatch Loss is
+          // steep and the subtraction the reference does is ill conditioned
+          if (rl_db < 0.05) continue;
+          CHECK(pk == ad8307_Fdb100);
+          CHECK_NEAR(10 * log10(fwd_power_mw), 10 * log10(o.fwd_mw), 0.006);
+          CHECK_NEAR(10 * log10(ref_power_mw), 10 * log10(o.ref_mw), 0.006);
+          CHECK(Reverse == o.reverse);
+          // The reference clamps Forward power at 4kW before the subtraction
+          if (rl_db < 3 || o.fwd_mw >= 4000000) continue;
+          CHECK_NEAR(power_db, o.power_db, 0.03);
+          CHECK_NEAR(p_db / 100.0, o.power_db, 0.03);
+        }
+        else
+        {
+          // Float table of bridge voltages, the difference is ill conditioned
+          // within a couple of AD counts
+          if (abs(af[x] - av[x]) < 2 || o.fwd_mw < 1e-3) continue;
+          CHECK(Reverse == o.reverse);
+          CHECK_NEAR(fwd_power_mw, o.fwd_mw, 1e-6 * o.fwd_mw);
+          CHECK_NEAR(ref_power_mw, o.ref_mw, 1e-6 * o.fwd_mw);
+          CHECK_NEAR(power_db, o.power_db, 0.005);
+          CHECK(abs(p_db - (int32_t) (100 * power_db)) <= 1);
+          CHECK(abs(pk - (int32_t) lround(100 * fast_lin_to_db(o.fwd_mw))) <= 1);
+          if (rl_db < 3) continue;
+        }
+        double swr = k.swr();
+        if (fabs(power_db - o.power_db) > worst_db) worst_db = fabs(power_db - o.power_db);
+        if (fabs(swr / o.swr - 1) > worst_swr) worst_swr = fabs(swr / o.swr - 1);
+        CHECK_NEAR(swr / o.swr, 1.0, 0.005);
+        compared++;
+        if (check_failed) return;
+      }
+      n = 0;
+    }
+  }
+
+  // Threshold AD values, the lowest AD value at which the power is reached
+  for (double mw = 1; mw < 1e6; mw *= 10)
+  {
+    uint16_t x = k.ad_at(mw, false);
+    if (x == 0 || x == 4095) continue;
+    ref_t hi = detector::log_detector ? ref_ad8307(r, x, 0)     : ref_diode(r, x, 0);
+    ref_t lo = detector::log_detector ? ref_ad8307(r, x - 1, 0) : ref_diode(r, x - 1, 0);
+    CHECK(hi.fwd_mw >= mw * 0.995);
+    CHECK(lo.fwd_mw <= mw * 1.005);
+  }
+
+  printf("%-22s %7u pairs, worst power %.4f dB, worst SWR %.3f%%\n",
+         name, (unsigned) compared, worst_db, 100 * worst_swr);
+}
+
+int main(void)
+{
+  check_combo<PswrKernel<DetectorAD8307<AD_BLOCK>, Coupler20to1> >("AD8307, 20 to 1", 100);
+  check_combo<PswrKernel<DetectorAD8307<AD_BLOCK>, Coupler30to1> >("AD8307, 30 to 1", 100);
+  check_combo<PswrKernel<DetectorDiode<AD_BLOCK>,  Coupler20to1> >("Diode, 20 to 1", 100);
+  check_combo<PswrKernel<DetectorDiode<AD_BLOCK>,  Coupler30to1> >("Diode, 30 to 1, cal 87%", 87);
+
+  // The build time selection
+  CHECK(pswr_kernel_t::detector::log_detector == (AD8307_INSTALLED != 0));
+  CHECK(pswr_kernel_t::min_pwr_for_swr_calc == (AD8307_INSTALLED ? pswr_coupler::min_pwr_for_swr_calc : 30));
+
+  return CHECK_DONE();
+}
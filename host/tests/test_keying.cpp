@@ -0,0 +1,111 @@
+//*********************************************************************************
+//**
+//** Host test: CW keying analyzer (PSWRkeying.h) on synthetic key down events
+//** with known rise and fall times, overshoot and droop.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include "PSWRkeying.h"
+#include "check.h"
+
+#define PERIOD_US   20                  // The $burst capture rate
+#define LEVEL       5000                // Key down power, 50 dBm
+#define RAMP        100                 // Linear amplitude ramp, samples (2 ms)
+
+static KeyingAnalyzer key;
+
+// Power in dBm x 100 of an amplitude, relative to LEVEL
+static int16_t db_of(double amp)
+{
+  return (amp > 1e-4) ? LEVEL + lround(2000 * log10(amp)) : -3000;
+}
+
+// One key down: linear amplitude ramps up and down, flat top of n samples
+// with an overshoot (dB x 100) at the start of the top and a droop (dB x 100)
+// across it
+static void key_down(uint32_t n, int16_t overshoot, int16_t droop)
+{
+  for (uint32_t i = 0; i < 100; i++) key.add(-3000);
+  for (uint32_t i = 1; i <= RAMP; i++) key.add(db_of((double) i / RAMP));
+  for (uint32_t i = 0; i < n; i++)
+  {
+    int16_t os = (i < 10) ? overshoot * (10 - i) / 10 : 0;
+    key.add(LEVEL + os - (int32_t) droop * i / n);
+  }
+  for (uint32_t i = RAMP; i > 0; i--) key.add(db_of((double) (i - 1) / RAMP) - droop);
+  for (uint32_t i = 0; i < 100; i++) key.add(-3000);
+}
+
+int main(void)
+{
+  // 10% to 90% of a linear ramp is 80% of its length
+  const double rise = 0.8 * RAMP * PERIOD_US;
+
+  key.init(PERIOD_US);
+  key.threshold(LEVEL - 3000);                  // Key down 30 dB below full power
+
+  //------------------------------------------
+  // Long key down, no overshoot nor droop
+  key_down(5000, 0, 0);
+  CHECK(key.last().count == 1);
+  CHECK_NEAR(key.last().level, LEVEL, 5);
+  CHECK_NEAR(key.last().rise_us, rise, 2 * PERIOD_US);
+  CHECK_NEAR(key.last().fall_us, rise, 2 * PERIOD_US);
+  CHECK_NEAR(key.last().length_us, (5000 + 0.9 * RAMP * 2) * PERIOD_US, 3 * PERIOD_US);
+  CHECK(key.last().overshoot <= 5);
+  CHECK(abs(key.last().droop) <= 5);
+  CHECK(key.last().full_us > key.last().rise_us);
+
+  //------------------------------------------
+  // Overshoot of 1 dB
+  key_down(5000, 100, 0);
+  CHECK(key.last().count == 2);
+  CHECK_NEAR(key.last().overshoot, 100, 10);
+  CHECK(key.worst().overshoot == key.last().overshoot);
+
+  //------------------------------------------
+  // 0.5 dB of droop across the key down
+  key_down(5000, 0, 50);
+  CHECK(key.last().count == 3);
+  CHECK_NEAR(key.last().droop, 50, 12);         // Level and full power from the middle
+  CHECK_NEAR(key.last().fall_us, rise, 3 * PERIOD_US);     // From the drooped power
+  CHECK(key.worst().droop == key.last().droop);
+
+  //------------------------------------------
+  // Short key down, only the kept parts, no middle.  The level is the average
+  // within 3 dB of the peak, which takes in part of the ramps
+  key_down(100, 0, 0);
+  CHECK(key.last().count == 4);
+  CHECK_NEAR(key.last().level, LEVEL, 100);
+  CHECK_NEAR(key.last().rise_us, rise, 8 * PERIOD_US);
+  CHECK(key.worst().overshoot >= 90);            // Worst kept
+
+  //------------------------------------------
+  // Key down in progress at the end of input
+  for (uint32_t i = 0; i < 1000; i++) key.add(LEVEL);
+  key.flush();
+  CHECK(key.last().count == 5);
+
+  key.reset();
+  CHECK(key.last().count == 0 && key.worst().overshoot == 0);
+
+  return CHECK_DONE();
+}
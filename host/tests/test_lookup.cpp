@@ -0,0 +1,66 @@
+//*********************************************************************************
+//**
+//** Host test: T_1xx dBm x 100 to mW tables and the Return Loss table
+//** (PSWRlookup) against the double precision formulas, over the full range.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <math.h>
+#include "PSWRlookup.h"
+#include "check.h"
+
+int main(void)
+{
+  double worst = 0;
+
+  //------------------------------------------
+  // dBm x 100 to mW, every step, as dB error
+  for (int32_t db = DB100_MIN; db <= DB100_MAX; db++)
+  {
+    double err = fabs(10 * log10(db100_to_mw(db)) - db / 100.0);
+    if (err > worst) worst = err;
+  }
+  printf("db100_to_mw: max error %.2e dB\n", worst);
+  CHECK(worst < 1e-5);
+  CHECK(db100_to_mw(DB100_MIN - 500) == db100_to_mw(DB100_MIN));   // Bounded
+  CHECK(db100_to_mw(DB100_MAX + 500) == db100_to_mw(DB100_MAX));
+  CHECK_NEAR(db100_to_mw(0), 1.0, 1e-6);
+  CHECK_NEAR(db100_to_mw(3000), 1000.0, 1e-3);
+
+  //------------------------------------------
+  // Return Loss to SWR and Mismatch Loss, within rounding of the table units
+  for (int32_t rl = 1; rl <= RL100_MAX; rl++)
+  {
+    double g   = pow(10, -rl / 2000.0);
+    double swr = (1 + g) / (1 - g);
+    double ml  = -10 * log10(1 - g * g);
+    rl_t   t   = rl_lookup(rl);
+
+    if (1000 * log10(swr) < 65535) CHECK_NEAR(t.swr_log, 1000 * log10(swr), 0.5 + 1e-6);
+    if (100 * ml < 65535)          CHECK_NEAR(t.ml, 100 * ml, 0.5 + 1e-6);
+    if (check_failed) break;
+  }
+  CHECK(rl_lookup(0).swr_log == 65535);                 // Infinite SWR at 0 dB RL
+  CHECK(rl_lookup(-100).swr_log == 65535);              // Bounded
+  CHECK(rl_lookup(RL100_MAX + 100).swr_log == rl_lookup(RL100_MAX).swr_log);
+  CHECK_NEAR(db100_to_mw(rl_lookup(954).swr_log), 2.0, 0.01);   // 9.54 dB RL is SWR 2:1
+
+  return CHECK_DONE();
+}
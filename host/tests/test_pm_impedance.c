@@ -0,0 +1,203 @@
+//*********************************************************************************
+//**
+//** Host test: PM firmware Phase Detector build, the fixed point impedance path
+//** (PM_PowerImpedance_Meter.c) against the floating point calculation it replaces,
+//** from the same raw A/D values, and the cosine and log helpers in PM_Lookup.c.
+//** Plain C, as the firmware.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include "PM.h"
+#include "check.h"
+
+#define SAMPLES		200000
+
+// Globals of PM.c
+var_t		R;
+uint16_t	Status;
+int16_t		ad8307_adV, ad8307_adI, mck12140pos, mck12140neg;
+double		ad8307_VdBm, ad8307_IdBm, phase, Gamma, imp_R, imp_jX;
+BOOL		Reverse;
+double		fwd_power_db, ref_power_db, power_db, power_db_pep, power_db_pk, power_db_avg;
+double		fwd_power_mw, ref_power_mw, power_mw, power_mw_pep, power_mw_pk, power_mw_avg;
+double		swr;
+uint16_t	swr_bar;
+
+// The floating point calculation, as imp_determine_dBm(), imp_determine_phase()
+// and imp_calc_Power() without the fixed point path.  The inputs from the raw A/D
+// values, then the outputs from the inputs
+typedef struct {
+	double	v_dbm, i_dbm, phase, r, jx, power_db, gamma;
+} ref_t;
+
+static void reference_in(ref_t *x)
+{
+	double	delta_db, v_U, v_D;
+
+	delta_db = (R.cal_AD[1].db10m - R.cal_AD[0].db10m) / 10.0;
+	x->v_dbm = (ad8307_adV - R.cal_AD[0].V) * delta_db / (R.cal_AD[1].V - R.cal_AD[0].V) + R.cal_AD[0].db10m / 10.0;
+	x->i_dbm = (ad8307_adI - R.cal_AD[0].I) * delta_db / (R.cal_AD[1].I - R.cal_AD[0].I) + R.cal_AD[0].db10m / 10.0;
+
+	v_U = mck12140pos * 5.0 / 4096;
+	v_D = mck12140neg * 5.0 / 4096;
+	if (v_D > v_U)
+	{
+		if (v_D > R.D.zerodeg) x->phase = M_PI/2 * (v_D - R.D.zerodeg) / (R.D.pos90deg - R.D.zerodeg);
+		else x->phase = -M_PI/2 * (R.D.zerodeg - v_D) / (R.D.zerodeg - R.D.neg90deg);
+	}
+	else
+	{
+		if (v_U > R.U.zerodeg) x->phase = -M_PI/2 * (v_U - R.U.zerodeg) / (R.U.neg90deg - R.U.zerodeg);
+		else x->phase = M_PI/2 * (R.U.zerodeg - v_U) / (R.U.zerodeg - R.U.pos90deg);
+	}
+}
+
+static void reference_out(ref_t *x)
+{
+	double	v, i, r;
+
+	v = pow(10, x->v_dbm / 20);
+	i = pow(10, x->i_dbm / 20);
+	x->r  = v / i * cos(x->phase);
+	x->jx = v / i * sin(x->phase);
+	r = fabs(x->r);
+	x->power_db = 10 * log10(SQR(i) * r);
+	x->gamma = sqrt((SQR(r - 1) + SQR(x->jx)) / (SQR(r + 1) + SQR(x->jx)));
+}
+
+static void sample(void)
+{
+	imp_determine_dBm();
+	imp_determine_phase();
+	imp_calc_Power();
+}
+
+int main(void)
+{
+	double	worst_p = 0, worst_rl = 0, worst_z = 0;
+	int32_t	n;
+
+	//------------------------------------------
+	// Cosine and log helpers
+	for (n = -7200; n <= 7200; n++)
+	{
+		CHECK_NEAR(phase_cos(n), 32768 * cos(n * M_PI / 1800), 1.0);
+		if (check_failed) break;
+	}
+	srand(12);
+	for (n = 0; n < 100000; n++)
+	{
+		uint32_t den = 1 + rand() % 0x3fffffff;
+		uint32_t num = den + (uint32_t) ((0xffffffffUL - den) * (rand() / (RAND_MAX + 1.0)));
+		CHECK_NEAR(ratio_db100(num, den), 1000 * log10((double) num / den), 0.7);
+		if (check_failed) break;
+	}
+	CHECK(ratio_db100(1, 2) == 0);
+
+	//------------------------------------------
+	// Calibration, the defaults
+	R.cal_AD[0].db10m = CAL1_NOR_VALUE;
+	R.cal_AD[0].V = CALV1_RAW_DEFAULT + 8;
+	R.cal_AD[0].I = CALI1_RAW_DEFAULT - 5;
+	R.cal_AD[1].db10m = CAL2_NOR_VALUE;
+	R.cal_AD[1].V = CALV2_RAW_DEFAULT;
+	R.cal_AD[1].I = CALI2_RAW_DEFAULT;
+	R.U.pos90deg = PH_U_90_DEG_AVG;
+	R.U.zerodeg  = PH_U_0_DEG_AVG;
+	R.U.neg90deg = PH_U_270DEG_AVG;
+	R.D.pos90deg = PH_D_90_DEG_AVG;
+	R.D.zerodeg  = PH_D_0_DEG_AVG;
+	R.D.neg90deg = PH_D_270DEG_AVG;
+	R.PEP_period = PEP_PERIOD;
+	R.SWR_alarm_trig = 40;
+
+	//------------------------------------------
+	// Random V, I and phase detector outputs, 0 to 50 dBm, |Z| from 2 to 1250 ohm
+	for (n = 0; n < SAMPLES; n++)
+	{
+		ref_t	x, q;
+		double	rl;
+
+		ad8307_adV = 900 + rand() % 1100;
+		ad8307_adI = ad8307_adV - 560 + rand() % 1120;
+		mck12140pos = 740 + rand() % 1440;
+		mck12140neg = 740 + rand() % 1440;
+		sample();
+		imp_calc_Derived();
+
+		// The inputs are quantized to 0.01 dB and 0.1 degree, finer than the A/D
+		// values, 0.03 dB and 0.13 degree
+		reference_in(&x);
+		CHECK_NEAR(ad8307_VdBm, x.v_dbm, 0.011);
+		CHECK_NEAR(ad8307_IdBm, x.i_dbm, 0.011);
+		CHECK_NEAR(phase, x.phase, 0.07 * M_PI / 180);
+		reference_out(&x);
+		if (fabs(hypot(x.r, x.jx) - 1) > worst_z) worst_z = fabs(hypot(x.r, x.jx) - 1);
+
+		// The outputs from the quantized inputs
+		q.v_dbm = ad8307_VdBm;
+		q.i_dbm = ad8307_IdBm;
+		q.phase = phase * M_PI / 3.14159;
+		reference_out(&q);
+		CHECK(Reverse == (q.r < 0));
+		CHECK_NEAR(imp_R,  q.r,  0.0005 * hypot(q.r, q.jx));
+		CHECK_NEAR(imp_jX, q.jx, 0.0005 * hypot(q.r, q.jx));
+
+		// The power of the real part goes to zero at 90 degrees, where the cosine
+		// error of 3e-5 becomes noticeable
+		if (fabs(cos(q.phase)) > 0.002)
+		{
+			double tol = 0.02 + 1e-4 / fabs(cos(q.phase));
+			if (fabs(power_db - q.power_db) / tol > worst_p) worst_p = fabs(power_db - q.power_db) / tol;
+			CHECK_NEAR(power_db, q.power_db, tol);
+		}
+
+		// Return Loss up to 40 dB.  The cosine, within 3e-5, is an error of about
+		// 1e-4/Gamma^2 dB at most, which is 0.1 dB at 30 dB and 1 dB at 40 dB
+		rl = -20 * log10(q.gamma);
+		if (rl < 40)
+		{
+			double tol = 0.02 + 1e-4 * pow(10, rl / 10);
+			if (fabs(-20 * log10(Gamma) - rl) / tol > worst_rl) worst_rl = fabs(-20 * log10(Gamma) - rl) / tol;
+			CHECK_NEAR(-20 * log10(Gamma), rl, tol);
+		}
+		if (check_failed > 10) break;
+	}
+	printf("%d samples: worst power %.2f, worst Return Loss %.2f of the tolerance, |Z| up to %.0f ohm\n",
+		   (int) n, worst_p, worst_rl, 50 * (1 + worst_z));
+
+	//------------------------------------------
+	// Matched, 50 ohm at 40 dBm, then steady for one second: Peak, PEP and Average
+	ad8307_adV = R.cal_AD[0].V;
+	ad8307_adI = R.cal_AD[0].I;
+	mck12140pos = R.U.zerodeg * 4096 / 5.0;
+	mck12140neg = mck12140pos - 1;
+	for (n = 0; n < (int32_t) (AVG_BLOCKS + 1) * PK_SAMPLES; n++) sample();
+	imp_calc_Derived();
+	CHECK_NEAR(power_db, 40.1, 0.01);
+	CHECK(Gamma < 0.002 && swr < 1.01);
+	CHECK_NEAR(power_db_pk, power_db, 0.001);
+	CHECK(power_db_pep >= power_db);						// Random input above within the PEP window
+	CHECK_NEAR(power_db_avg, power_db, 0.01);
+	CHECK_NEAR(fwd_power_db, power_db, 0.01);
+
+	return CHECK_DONE();
+}
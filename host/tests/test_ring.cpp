@@ -0,0 +1,95 @@
+//*********************************************************************************
+//**
+//** Host test: T_1xx sample ring (PSWRring.h), wrap around in contiguous blocks,
+//** drop and lag statistics, and a producer thread against a consumer thread,
+//** every value received once and in order.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <thread>
+#include "PSWRring.h"
+#include "check.h"
+
+#define THREADED_N   500000
+
+static SpscRing<uint32_t, 16>   ring16;
+static SpscRing<uint32_t, 1024> ring1k;
+
+int main(void)
+{
+  const uint32_t *p;
+  uint32_t next = 0, expect = 0;
+  uint16_t n;
+
+  //------------------------------------------
+  // Single threaded, fill, overflow and drain in blocks across the wrap
+  for (uint8_t i = 0; i < 16; i++) CHECK(ring16.push(next++));
+  CHECK(!ring16.push(next));                     // Full, dropped
+  CHECK(ring16.dropped() == 1);
+  CHECK(ring16.highwater() == 16);
+  CHECK(ring16.available() == 16);
+  CHECK(ring16.lagmax() == 16);
+
+  for (uint8_t round = 0; round < 100; round++)
+  {
+    n = ring16.block(&p);
+    if (n > 5) n = 5;                           // Consume part of a block
+    for (uint16_t i = 0; i < n; i++) CHECK(p[i] == expect++);
+    ring16.release(n);
+    while (ring16.push(next)) next++;            // Refill, the ring wraps
+  }
+  CHECK(ring16.lag() == 16);
+  ring16.clear_stats();
+  CHECK(ring16.dropped() == 0);
+  CHECK(ring16.highwater() == 0);
+  CHECK(ring16.lagmax() == 0);
+  while ((n = ring16.block(&p)) > 0)
+  {
+    CHECK(n <= 16);
+    for (uint16_t i = 0; i < n; i++) CHECK(p[i] == expect++);
+    ring16.release(n);
+  }
+  CHECK(expect == next);
+
+  //------------------------------------------
+  // Producer thread pushes a sequence, retrying when full, consumer checks it
+  std::thread producer([]() {
+    for (uint32_t v = 0; v < THREADED_N; )
+      if (ring1k.push(v)) v++;
+      else std::this_thread::yield();
+  });
+  for (expect = 0; expect < THREADED_N; )
+  {
+    if ((n = ring1k.block(&p)) == 0) std::this_thread::yield();
+    for (uint16_t i = 0; i < n; i++)
+    {
+      if (p[i] != expect) { CHECK(p[i] == expect); break; }
+      expect++;
+    }
+    ring1k.release(n);
+    if (check_failed) break;
+  }
+  producer.join();
+  CHECK(expect == THREADED_N);
+  printf("threaded: %u values, %u retries when full, high water %u\n",
+         (unsigned) expect, (unsigned) ring1k.dropped(), (unsigned) ring1k.highwater());
+
+  return CHECK_DONE();
+}
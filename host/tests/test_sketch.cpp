@@ -0,0 +1,89 @@
+//*********************************************************************************
+//**
+//** Host test: the PSWR_T_1xx sketch as built for the Teensy, setup() and then
+//** loop(), fed with a steady carrier through the ADC conversion complete
+//** interrupt at the sample rate, on the virtual clock of the shims.  Checks the
+//** meter readings, that no sample was dropped, and the replies to a few USB
+//** commands.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <string.h>
+#include <ADC.h>
+#include "PSWR_T.h"
+#include "check.h"
+
+#define FWD_AD      2000                // Steady carrier, AD values
+#define REV_AD      200
+
+// From the sketch
+void setup(void);
+void loop(void);
+extern ADC        *adc;
+extern adbuffer_t  measure;
+extern var_t       R;
+extern double      power_mw_pk, power_mw_avg, power_db_pk, power_db_pep;
+
+// Run the sketch for ms milliseconds, one ADC interrupt per sample period and
+// loop() after each
+static void run(uint32_t ms)
+{
+  for (uint64_t end = host_clock_us + 1000ULL * ms; host_clock_us < end; )
+  {
+    host_advance_us(R.sample_timer);
+    if (adc->adc1->isr) adc->adc1->isr();
+    loop();
+  }
+}
+
+static bool replied(const char *cmd, const char *expect)
+{
+  host_serial_clear();
+  host_serial_input(cmd);
+  loop();
+  return strstr(host_serial_output(), expect) != NULL;
+}
+
+int main(void)
+{
+  setup();
+  CHECK(adc->adc1->isr != NULL);              // No AD7991 on the host, the PDB backend
+  CHECK(adc->adc1->pdb_freq == 1000000 / R.sample_timer);
+
+  host_adc_value[0] = REV_AD;                 // ADC0 reverse, ADC1 forward
+  host_adc_value[1] = FWD_AD;
+  run(6000);                                  // Longer than the longest PEP period
+
+  // A steady carrier, peak, PEP and average all the same as the instantaneous power
+  CHECK(power_mw > 0);
+  CHECK(!Reverse);
+  CHECK_NEAR(power_mw_avg, power_mw, power_mw * 0.001);
+  CHECK_NEAR(power_mw_pk, power_mw, power_mw * 0.001);
+  CHECK_NEAR(power_db_pep, power_db_pk, 0.01);
+  CHECK_NEAR(power_db_pk, 10 * log10(power_mw), 0.01);
+  CHECK(measure.dropped() == 0);
+  CHECK(measure.available() == 0);            // loop() keeps up
+
+  CHECK(replied("$ringstat\r", "AD ring: backend pdb"));
+  CHECK(replied("$ramstat\r", "RAM: total"));
+  CHECK(replied("$ccdf\r", "ccdf samples="));
+
+  return CHECK_DONE();
+}
@@ -0,0 +1,76 @@
+//*********************************************************************************
+//**
+//** Host test: sliding window max of T_1xx (PSWRwindow) against a brute force
+//** scan, also across window length changes and stamp roll over.
+//**
+//** Copyright (C) 2026  Loftur E. Jonasson  (tf3lj [at] arrl [dot] net)
+//**
+//** This program is free software: you can redistribute it and/or modify
+//** it under the terms of the GNU General Public License as published by
+//** the Free Software Foundation, either version 3 of the License, or
+//** (at your option) any later version.
+//**
+//** This program is distributed in the hope that it will be useful,
+//** but WITHOUT ANY WARRANTY; without even the implied warranty of
+//** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//** GNU General Public License for more details.
+//**
+//** You should have received a copy of the GNU General Public License
+//** along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//**
+//** Platform........: Linux x86-64 host build (see host/CMakeLists.txt)
+//**
+//*********************************************************************************
+
+#include <stdlib.h>
+#include <vector>
+#include "PSWRwindow.h"
+#include "check.h"
+
+#define BUF 300
+
+static int32_t brute_max(const std::vector<int32_t> &v, uint16_t len)
+{
+  int32_t  m = SLIDINGMAX_EMPTY;
+  size_t   from = (v.size() > len) ? v.size() - len : 0;
+
+  for (size_t i = from; i < v.size(); i++) if (v[i] > m) m = v[i];
+  return m;
+}
+
+int main(void)
+{
+  static slidingmax_t buf[BUF];
+  SlidingMax t;
+  std::vector<int32_t> v;
+  uint16_t len = 100;
+
+  t.init(buf, BUF, len);
+  CHECK(t.peak() == SLIDINGMAX_EMPTY);
+
+  srand(1);
+  for (uint32_t i = 0; i < 200000; i++)       // Well past the 16 bit stamp roll over
+  {
+    int32_t x = (rand() % 20001) - 10000;
+    if (i % 1000 < 50) x = 10000 - (int32_t) (i % 1000);  // Falling ramps, the queue grows long
+
+    if (i % 25000 == 0)                       // Length changes, also longer than the buffer
+    {
+      len = 1 + rand() % (BUF + 50);
+      t.length(len);
+      if (len > BUF) len = BUF;
+      CHECK(t.length() == len);
+    }
+    v.push_back(x);
+    if (v.size() > 2 * BUF) v.erase(v.begin(), v.begin() + BUF);
+
+    int32_t m = brute_max(v, len);
+    CHECK(t.add(x) == m);
+    if (check_failed) break;
+  }
+
+  t.clear();
+  CHECK(t.peak() == SLIDINGMAX_EMPTY);
+  CHECK(t.add(-5) == -5);
+  return CHECK_DONE();
+}